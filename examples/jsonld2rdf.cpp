@@ -2,7 +2,7 @@
 // used. Not yet meant to be the very best example.
 
 // This application reads a jsonld file and, if possible, outputs
-// a normalized RDF dataset in NQuads format. This can then be piped
+// a canonicalized RDF dataset in NQuads format. This can then be piped
 // to a hashing utility like sha256sum and used to compare with RDF
 // generated from other documents.
 
@@ -11,6 +11,7 @@
 #include <jsonld-cpp/FileLoader.h>
 #include <jsonld-cpp/JsonLdOptions.h>
 #include <jsonld-cpp/JsonLdProcessor.h>
+#include <jsonld-cpp/RDFCanonicalization.h>
 #include <jsonld-cpp/RDFDataset.h>
 #include <iostream>
 #include <fstream>
@@ -48,7 +49,7 @@ int main (int argc, char *argv[]) {
     opts.setDocumentLoader(std::move(loader));
 
     RDF::RDFDataset dataset = JsonLdProcessor::toRDF(fileUri, opts);
-    std::cout << dataset;
+    std::cout << RDFCanonicalization::toCanonicalNQuads(dataset, opts);
     std::flush(std::cout);
 
     return 0;
@@ -1,6 +1,5 @@
 #include "jsonld-cpp/BlankNodeNames.h"
 #include "jsonld-cpp/JsonLdConsts.h"
-#include <sstream>
 #include <utility>
 #include <vector>
 
@@ -9,22 +8,75 @@ BlankNodeNames::BlankNodeNames() = default;
 BlankNodeNames::BlankNodeNames(std::string prefix)
         : prefix(std::move(prefix)) { }
 
+BlankNodeNames::BlankNodeNames(const BlankNodeNames & other)
+        : counter(other.counter.load()),
+          prefix(other.prefix),
+          keysToNames(other.keysToNames),
+          keysInInsertionOrder(other.keysInInsertionOrder) { }
+
+BlankNodeNames::BlankNodeNames(BlankNodeNames && other) noexcept
+        : counter(other.counter.load()),
+          prefix(std::move(other.prefix)),
+          keysToNames(std::move(other.keysToNames)),
+          keysInInsertionOrder(std::move(other.keysInInsertionOrder)) { }
+
+BlankNodeNames & BlankNodeNames::operator=(const BlankNodeNames & other) {
+    counter = other.counter.load();
+    prefix = other.prefix;
+    keysToNames = other.keysToNames;
+    keysInInsertionOrder = other.keysInInsertionOrder;
+    return *this;
+}
+
+BlankNodeNames & BlankNodeNames::operator=(BlankNodeNames && other) noexcept {
+    counter = other.counter.load();
+    prefix = std::move(other.prefix);
+    keysToNames = std::move(other.keysToNames);
+    keysInInsertionOrder = std::move(other.keysInInsertionOrder);
+    return *this;
+}
+
 std::string BlankNodeNames::get() {
-    std::stringstream ss;
-    ss << prefix << counter++;
-    return ss.str();
+    return getName(counter.fetch_add(1, std::memory_order_relaxed));
+}
+
+std::size_t BlankNodeNames::reserveBlock(std::size_t count) {
+    return counter.fetch_add(count, std::memory_order_relaxed);
+}
+
+std::string BlankNodeNames::getName(std::size_t number) const {
+    // format the digits backwards into a small buffer, instead of going
+    // through a stringstream, which is slow and allocates
+    char digits[20];
+    char * end = digits + sizeof(digits);
+    char * begin = end;
+    do {
+        *--begin = static_cast<char>('0' + number % 10);
+        number /= 10;
+    } while (number != 0);
+
+    std::string name;
+    name.reserve(prefix.size() + static_cast<std::size_t>(end - begin));
+    name.append(prefix);
+    name.append(begin, end);
+    return name;
 }
 
 std::string BlankNodeNames::get(const std::string & identifier) {
-    if(keysToNames.count(identifier))
-        return keysToNames.at(identifier);
+    auto it = keysToNames.find(identifier);
+    if(it != keysToNames.end())
+        return it->second;
 
     std::string name = get();
-    keysToNames[identifier] = name;
+    keysToNames.emplace(identifier, name);
     keysInInsertionOrder.push_back(identifier);
     return name;
 }
 
+std::size_t BlankNodeNames::getCount() const {
+    return counter.load();
+}
+
 std::vector<std::string> BlankNodeNames::getKeys() {
     return keysInInsertionOrder;
 }
@@ -38,7 +90,7 @@ bool BlankNodeNames::hasFormOfBlankNodeName(const std::string &name) {
 }
 
 bool BlankNodeNames::operator==(const BlankNodeNames &rhs) const {
-    return counter == rhs.counter &&
+    return counter.load() == rhs.counter.load() &&
            prefix == rhs.prefix &&
            keysToNames == rhs.keysToNames &&
            keysInInsertionOrder == rhs.keysInInsertionOrder;
@@ -1,8 +1,9 @@
 #ifndef LIBJSONLD_CPP_BLANKNODENAMES_H
 #define LIBJSONLD_CPP_BLANKNODENAMES_H
 
+#include <atomic>
 #include <string>
-#include <map>
+#include <unordered_map>
 #include <vector>
 
 /**
@@ -13,13 +14,17 @@
  * By default, identifiers are generated using the prefix "_:b" with a number appended, for
  * example: "_:b0", "_:b1", ... but the prefix can be set in the constructor.
  *
+ * Generating names without an identifier, using get() or reserveBlock(), is lock-free and
+ * may be done from several threads at once. Generating names for identifiers, and the
+ * other methods, must not be called concurrently.
+ *
  * See: https://www.w3.org/TR/json-ld11-api/#generate-blank-node-identifier
  */
 class BlankNodeNames {
 private:
-    int counter = 0;
+    std::atomic<std::size_t> counter{0};
     std::string prefix = "_:b";
-    std::map<std::string, std::string> keysToNames;
+    std::unordered_map<std::string, std::string> keysToNames;
     std::vector<std::string> keysInInsertionOrder;
 
 public:
@@ -39,6 +44,11 @@ public:
      */
     explicit BlankNodeNames(std::string prefix);
 
+    BlankNodeNames(const BlankNodeNames & other);
+    BlankNodeNames(BlankNodeNames && other) noexcept;
+    BlankNodeNames & operator=(const BlankNodeNames & other);
+    BlankNodeNames & operator=(BlankNodeNames && other) noexcept;
+
     /**
      * Generates a blank node name for the given identifier using the algorithm
      * specified in:
@@ -61,6 +71,31 @@ public:
      */
     std::string get(const std::string & identifier);
 
+    /**
+     * Reserves a block of count consecutive blank node numbers, so that a thread can
+     * generate their names, using getName(), without touching the shared counter again.
+     *
+     * @param count The number of names to reserve.
+     * @return The first number of the block.
+     */
+    std::size_t reserveBlock(std::size_t count);
+
+    /**
+     * Gets the blank node name for a number returned by reserveBlock(), for example
+     * "_:b12" for number 12.
+     *
+     * @param number The number.
+     * @return The blank node name.
+     */
+    std::string getName(std::size_t number) const;
+
+    /**
+     * Gets the number of blank node names generated so far.
+     *
+     * @return The number of generated names
+     */
+    std::size_t getCount() const;
+
     /**
      * Does key already exist as a name?
      *
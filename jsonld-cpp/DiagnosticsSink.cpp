@@ -0,0 +1,80 @@
+#include "jsonld-cpp/DiagnosticsSink.h"
+
+#include <ostream>
+
+constexpr std::size_t DiagnosticsSink::NUM_CODES;
+constexpr std::size_t DiagnosticsCollector::DEFAULT_MAX_MESSAGES;
+
+DiagnosticsSink::~DiagnosticsSink() = default;
+
+const char * DiagnosticsSink::codeName(Code code) {
+    switch (code) {
+        case Code::TermHasKeywordForm:
+            return "term has keyword form";
+        case Code::ReverseHasKeywordForm:
+            return "reverse has keyword form";
+        case Code::IdHasKeywordForm:
+            return "id has keyword form";
+        case Code::IriHasKeywordForm:
+            return "iri has keyword form";
+        case Code::MalformedLanguageTag:
+            return "malformed language tag";
+    }
+    return "unknown";
+}
+
+DiagnosticsCollector::DiagnosticsCollector(std::size_t maxMessages)
+        : maxMessages(maxMessages), totalCount(0) {
+    for (auto & count : counts)
+        count = 0;
+}
+
+void DiagnosticsCollector::warning(Code code, const std::string &message) {
+    counts[static_cast<std::size_t>(code)]++;
+    // only the warnings that may still be retained need to take the lock
+    if (totalCount++ < maxMessages) {
+        std::lock_guard<std::mutex> lock(mutex);
+        if (messages.size() < maxMessages)
+            messages.push_back({code, message});
+    }
+}
+
+std::size_t DiagnosticsCollector::getCount(Code code) const {
+    return counts[static_cast<std::size_t>(code)];
+}
+
+std::size_t DiagnosticsCollector::getTotalCount() const {
+    return totalCount;
+}
+
+std::vector<DiagnosticsCollector::Message> DiagnosticsCollector::getMessages() const {
+    std::lock_guard<std::mutex> lock(mutex);
+    return messages;
+}
+
+void DiagnosticsCollector::clear() {
+    std::lock_guard<std::mutex> lock(mutex);
+    for (auto & count : counts)
+        count = 0;
+    totalCount = 0;
+    messages.clear();
+}
+
+StreamDiagnosticsSink::StreamDiagnosticsSink(std::ostream &out, std::size_t maxMessagesPerCode)
+        : out(out), maxMessagesPerCode(maxMessagesPerCode), suppressedCount(0) {
+    for (auto & count : counts)
+        count = 0;
+}
+
+void StreamDiagnosticsSink::warning(Code code, const std::string &message) {
+    if (counts[static_cast<std::size_t>(code)]++ >= maxMessagesPerCode) {
+        suppressedCount++;
+        return;
+    }
+    std::lock_guard<std::mutex> lock(mutex);
+    out << "Warning: " << message << '\n';
+}
+
+std::size_t StreamDiagnosticsSink::getSuppressedCount() const {
+    return suppressedCount;
+}
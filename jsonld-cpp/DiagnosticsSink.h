@@ -0,0 +1,114 @@
+#ifndef LIBJSONLD_CPP_DIAGNOSTICSSINK_H
+#define LIBJSONLD_CPP_DIAGNOSTICSSINK_H
+
+#include <array>
+#include <atomic>
+#include <cstddef>
+#include <iosfwd>
+#include <mutex>
+#include <string>
+#include <vector>
+
+
+/**
+ * Receives the warnings that the JSON-LD algorithms say processors SHOULD generate, such
+ * as for terms that have the form of a keyword or language tags that are not well-formed.
+ *
+ * A sink is set on JsonLdOptions and is shared, not copied, when the options are copied,
+ * so a single sink sees every warning raised while processing a document. Sinks may be
+ * called from several threads at once if the same options are used concurrently. If no
+ * sink is set, warnings are discarded.
+ */
+class DiagnosticsSink {
+public:
+
+    enum class Code {
+        TermHasKeywordForm,
+        ReverseHasKeywordForm,
+        IdHasKeywordForm,
+        IriHasKeywordForm,
+        MalformedLanguageTag
+    };
+
+    static constexpr std::size_t NUM_CODES = 5;
+
+    // returns a short name for code, such as "iri has keyword form"
+    static const char * codeName(Code code);
+
+    DiagnosticsSink() = default;
+    DiagnosticsSink(const DiagnosticsSink&) = delete;
+    DiagnosticsSink& operator=(const DiagnosticsSink&) = delete;
+
+    // virtual destructor needed as this is an abstract base class
+    virtual ~DiagnosticsSink();
+
+    // called once for every warning raised during processing
+    virtual void warning(Code code, const std::string &message) = 0;
+
+};
+
+/**
+ * A DiagnosticsSink that counts warnings by code and retains the first maxMessages
+ * messages. Once the cap is reached, further warnings are only counted, so a
+ * misbehaving document cannot grow memory use without bound. A cap of zero keeps
+ * counts only.
+ */
+class DiagnosticsCollector : public DiagnosticsSink {
+public:
+
+    struct Message {
+        Code code;
+        std::string message;
+    };
+
+    static constexpr std::size_t DEFAULT_MAX_MESSAGES = 100;
+
+    explicit DiagnosticsCollector(std::size_t maxMessages = DEFAULT_MAX_MESSAGES);
+
+    void warning(Code code, const std::string &message) override;
+
+    // number of warnings with the given code seen so far, including those not retained
+    std::size_t getCount(Code code) const;
+
+    // number of warnings seen so far, including those not retained
+    std::size_t getTotalCount() const;
+
+    // the retained messages, in the order they were raised
+    std::vector<Message> getMessages() const;
+
+    // resets all counts and discards the retained messages
+    void clear();
+
+private:
+    std::size_t maxMessages;
+    std::array<std::atomic<std::size_t>, NUM_CODES> counts;
+    std::atomic<std::size_t> totalCount;
+    mutable std::mutex mutex;
+    std::vector<Message> messages;
+};
+
+/**
+ * A DiagnosticsSink that writes warnings to an output stream, one per line, but writes at
+ * most maxMessagesPerCode warnings of each code. Later warnings of the same code are
+ * dropped, so a document that repeats the same mistake many times produces a bounded
+ * amount of output.
+ */
+class StreamDiagnosticsSink : public DiagnosticsSink {
+public:
+
+    StreamDiagnosticsSink(std::ostream &out, std::size_t maxMessagesPerCode);
+
+    void warning(Code code, const std::string &message) override;
+
+    // number of warnings that were not written because their code reached the limit
+    std::size_t getSuppressedCount() const;
+
+private:
+    std::ostream &out;
+    std::size_t maxMessagesPerCode;
+    std::array<std::atomic<std::size_t>, NUM_CODES> counts;
+    std::atomic<std::size_t> suppressedCount;
+    std::mutex mutex;
+};
+
+#endif //LIBJSONLD_CPP_DIAGNOSTICSSINK_H
@@ -1,6 +1,8 @@
 #ifndef LIBJSONLD_CPP_JSONLDCONSTS_H
 #define LIBJSONLD_CPP_JSONLDCONSTS_H
 
+#include <cstddef>
+
 /**
  * Constants used in the JSON-LD parser.
  */
@@ -70,9 +72,17 @@ namespace JsonLdConsts {
     static constexpr const char PREFIX[] = "@prefix";
     static constexpr const char INCLUDED[] = "@included";
 
+    // JSON-LD 1.1 Framing
+    static constexpr const char ALWAYS[] = "@always";
+    static constexpr const char MERGED[] = "@merged";
+    static constexpr const char NEVER[] = "@never";
+    static constexpr const char OMIT_GRAPH[] = "@omitGraph";
+    static constexpr const char ONCE[] = "@once";
+
     static constexpr const char JSON_LD_1_0[] = "json-ld-1.0";
     static constexpr const char JSON_LD_1_1[] = "json-ld-1.1";
     static constexpr bool DEFAULT_COMPACT_ARRAYS = true;
+    static constexpr std::size_t DEFAULT_CANONICALIZATION_WORK_LIMIT = 1000000;
 
     // various flags used for term definitions
     static constexpr const char IS_PREFIX_FLAG[] = "@flag.prefix";
@@ -67,3 +67,9 @@ const char JsonLdError::InvalidImportValue[] = "invalid @import value";
 const char JsonLdError::InvalidPropagateValue[] = "invalid @propagate value";
 const char JsonLdError::InvalidIncludedValue[] = "invalid @included value";
 const char JsonLdError::ProtectedTermRedefinition[] = "protected term redefinition";
+const char JsonLdError::IriConfusedWithPrefix[] = "IRI confused with prefix";
+const char JsonLdError::InvalidJsonLiteral[] = "invalid JSON literal";
+const char JsonLdError::InvalidFrame[] = "invalid frame";
+const char JsonLdError::InvalidEmbedValue[] = "invalid @embed value";
+
+const char JsonLdError::CanonicalizationWorkLimitExceeded[] = "canonicalization work limit exceeded";
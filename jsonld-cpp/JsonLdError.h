@@ -59,6 +59,13 @@ public:
     static const char InvalidPropagateValue[];
     static const char InvalidIncludedValue[];
     static const char ProtectedTermRedefinition[];
+    static const char IriConfusedWithPrefix[];
+    static const char InvalidJsonLiteral[];
+    static const char InvalidFrame[];
+    static const char InvalidEmbedValue[];
+
+    // jsonld-cpp specific
+    static const char CanonicalizationWorkLimitExceeded[];
 
     JsonLdError(const std::string& type, const nlohmann::ordered_json& detail);
     explicit JsonLdError(const std::string& type);
@@ -4,14 +4,37 @@
 // The JsonLdOptions type as specified in "JSON-LD-API specification":
 // https://www.w3.org/TR/json-ld-api/#the-jsonldoptions-type
 
+#include <cstddef>
 #include <memory>
 #include <utility>
 #include <string>
 
 #include "jsonld-cpp/jsoninc.h"
+#include "jsonld-cpp/DiagnosticsSink.h"
 #include "jsonld-cpp/DocumentLoader.h"
 #include "jsonld-cpp/JsonLdConsts.h"
 
+class ProcessingStats;
+class ResultCache;
+
+
+/**
+ * The order of the quads of a dataset when it is serialized, for instance by
+ * NQuadsSerialization::toNQuads(). Only serialization orders quads, so the cost of an
+ * ordering is paid once, and not at all for Insertion.
+ */
+enum class QuadOrdering {
+    // Quads are output in the order they were added to the dataset. For a dataset from
+    // toRDF(), that is the order of graph names, then of subjects, then of properties,
+    // so the output is the same each time the same document is converted.
+    Insertion,
+    // Quads are output sorted lexicographically by their N-Quads serialization.
+    Sorted,
+    // Blank nodes are relabeled with their canonical identifiers, see
+    // RDFCanonicalization::canonicalize(), before the quads are sorted, so that isomorphic
+    // datasets are serialized identically.
+    Canonical
+};
 
 class JsonLdOptions {
 private:
@@ -122,6 +145,91 @@ private:
 
     std::string hashAlgorithm_;
 
+    // ///////////////////////////////////////////////////////////////////////
+    // JSON-LD 1.1 Framing options
+
+    /**
+     * Sets the value object embed flag used in the Framing Algorithm: @always, @once or
+     * @never.
+     * https://www.w3.org/TR/json-ld11-framing/#dom-jsonldoptions-embed
+     */
+    std::string embed_ = JsonLdConsts::ONCE;
+
+    /**
+     * Sets the value explicit inclusion flag used in the Framing Algorithm.
+     * https://www.w3.org/TR/json-ld11-framing/#dom-jsonldoptions-explicit
+     */
+    bool explicit_ = false;
+
+    /**
+     * Sets the value omit default flag used in the Framing Algorithm.
+     * https://www.w3.org/TR/json-ld11-framing/#dom-jsonldoptions-omitdefault
+     */
+    bool omitDefault_ = false;
+
+    /**
+     * Omits the top-level @graph entry of the framed output if there is only one node.
+     * https://www.w3.org/TR/json-ld11-framing/#dom-jsonldoptions-omitgraph
+     */
+    bool omitGraph_ = false;
+
+    /**
+     * Sets the value require all flag used in the Framing Algorithm.
+     * https://www.w3.org/TR/json-ld11-framing/#dom-jsonldoptions-requireall
+     */
+    bool requireAll_ = false;
+
+    // ///////////////////////////////////////////////////////////////////////
+    // jsonld-cpp specific options
+
+    /**
+     * If greater than zero, the top-level node objects of an expanded document are
+     * converted to RDF in chunks of this many nodes, and the resulting quads are emitted
+     * as each chunk completes. Only used by the toRDF() variants that emit quads instead
+     * of returning an RDFDataset. If zero, the whole document is converted at once.
+     */
+    std::size_t rdfChunkSize_ = 0;
+
+    /**
+     * The number of threads used to generate triples from a node map while converting to
+     * RDF. Subjects of each graph are partitioned across the threads, and the generated
+     * triples, and blank node identifiers, are the same as when converting on a single
+     * thread. If zero or one, triples are generated on the calling thread.
+     */
+    std::size_t rdfThreads_ = 1;
+
+    /**
+     * Limits the amount of work done while canonicalizing a dataset, counted in calls to,
+     * and permutations tried by, the Hash N-Degree Quads algorithm. Guards against
+     * "poison graphs" that would otherwise take exponential time. If zero, there is no limit.
+     */
+    std::size_t canonicalizationWorkLimit_ = JsonLdConsts::DEFAULT_CANONICALIZATION_WORK_LIMIT;
+
+    /**
+     * The order of the quads of a dataset when it is serialized. See QuadOrdering.
+     */
+    QuadOrdering quadOrdering_ = QuadOrdering::Sorted;
+
+    /**
+     * Receives the warnings generated during processing. Copies of these options share
+     * the same sink. If not set, warnings are discarded. See DiagnosticsSink.h for its API.
+     */
+    std::shared_ptr<DiagnosticsSink> diagnosticsSink_;
+
+    /**
+     * If set, the results of expand() and toRDF() are cached, and returned again when the
+     * same document is processed with the same options. Copies of these options share the
+     * same cache. See ResultCache.h for its API.
+     */
+    std::shared_ptr<ResultCache> resultCache_;
+
+    /**
+     * If set, the time spent in each phase of processing and counts of the work done are
+     * added to these stats. Copies of these options share the same stats. See
+     * ProcessingStats.h for its API.
+     */
+    std::shared_ptr<ProcessingStats> processingStats_;
+
 public:
 
     /**
@@ -140,25 +248,38 @@ public:
     }
 
     JsonLdOptions(const JsonLdOptions& other) {
+        *this = other;
+    }
+
+    JsonLdOptions & operator=(const JsonLdOptions& other) {
+        if(this == &other)
+            return *this;
         base_ = other.base_;
         compactArrays_ = other.compactArrays_;
         compactToRelative_ = other.compactToRelative_;
-        if(other.documentLoader_)
-            documentLoader_.reset( other.documentLoader_->clone() );
+        documentLoader_.reset(other.documentLoader_ ? other.documentLoader_->clone() : nullptr);
         expandContext_ = other.expandContext_;
         extractAllScripts_ = other.extractAllScripts_;
         frameExpansion_ = other.frameExpansion_;
         hashAlgorithm_ = other.hashAlgorithm_;
+        embed_ = other.embed_;
+        explicit_ = other.explicit_;
+        omitDefault_ = other.omitDefault_;
+        omitGraph_ = other.omitGraph_;
+        requireAll_ = other.requireAll_;
         ordered_ = other.ordered_;
         processingMode_ = other.processingMode_;
         produceGeneralizedRdf_ = other.produceGeneralizedRdf_;
         rdfDirection_ = other.rdfDirection_;
         useNativeTypes_ = other.useNativeTypes_;
         useRdfType_ = other.useRdfType_;
-    }
-
-    JsonLdOptions & operator=(const JsonLdOptions& other) {
-        documentLoader_.reset( other.documentLoader_->clone() );
+        rdfChunkSize_ = other.rdfChunkSize_;
+        rdfThreads_ = other.rdfThreads_;
+        canonicalizationWorkLimit_ = other.canonicalizationWorkLimit_;
+        quadOrdering_ = other.quadOrdering_;
+        diagnosticsSink_ = other.diagnosticsSink_;
+        resultCache_ = other.resultCache_;
+        processingStats_ = other.processingStats_;
         return *this;
     }
 
@@ -266,6 +387,102 @@ public:
         hashAlgorithm_ = hashAlgorithm;
     }
 
+    const std::string &getEmbed() const {
+        return embed_;
+    }
+
+    void setEmbed(const std::string &embed) {
+        embed_ = embed;
+    }
+
+    bool getExplicit() const {
+        return explicit_;
+    }
+
+    void setExplicit(bool explicitInclusion) {
+        explicit_ = explicitInclusion;
+    }
+
+    bool getOmitDefault() const {
+        return omitDefault_;
+    }
+
+    void setOmitDefault(bool omitDefault) {
+        omitDefault_ = omitDefault;
+    }
+
+    bool getOmitGraph() const {
+        return omitGraph_;
+    }
+
+    void setOmitGraph(bool omitGraph) {
+        omitGraph_ = omitGraph;
+    }
+
+    bool getRequireAll() const {
+        return requireAll_;
+    }
+
+    void setRequireAll(bool requireAll) {
+        requireAll_ = requireAll;
+    }
+
+    std::size_t getRdfChunkSize() const {
+        return rdfChunkSize_;
+    }
+
+    void setRdfChunkSize(std::size_t rdfChunkSize) {
+        rdfChunkSize_ = rdfChunkSize;
+    }
+
+    std::size_t getRdfThreads() const {
+        return rdfThreads_;
+    }
+
+    void setRdfThreads(std::size_t rdfThreads) {
+        rdfThreads_ = rdfThreads;
+    }
+
+    std::size_t getCanonicalizationWorkLimit() const {
+        return canonicalizationWorkLimit_;
+    }
+
+    void setCanonicalizationWorkLimit(std::size_t canonicalizationWorkLimit) {
+        canonicalizationWorkLimit_ = canonicalizationWorkLimit;
+    }
+
+    QuadOrdering getQuadOrdering() const {
+        return quadOrdering_;
+    }
+
+    void setQuadOrdering(QuadOrdering quadOrdering) {
+        quadOrdering_ = quadOrdering;
+    }
+
+    DiagnosticsSink * getDiagnosticsSink() const {
+        return diagnosticsSink_.get();
+    }
+
+    void setDiagnosticsSink(std::shared_ptr<DiagnosticsSink> diagnosticsSink) {
+        diagnosticsSink_ = std::move(diagnosticsSink);
+    }
+
+    ResultCache * getResultCache() const {
+        return resultCache_.get();
+    }
+
+    void setResultCache(std::shared_ptr<ResultCache> resultCache) {
+        resultCache_ = std::move(resultCache);
+    }
+
+    ProcessingStats * getProcessingStats() const {
+        return processingStats_.get();
+    }
+
+    void setProcessingStats(std::shared_ptr<ProcessingStats> processingStats) {
+        processingStats_ = std::move(processingStats);
+    }
+
 };
 
 #endif //LIBJSONLD_CPP_JSONLDOPTIONS_H
@@ -3,13 +3,343 @@
 #include "jsonld-cpp/detail/Context.h"
 #include "jsonld-cpp/RDFDataset.h"
 #include "jsonld-cpp/detail/ExpansionProcessor.h"
+#include "jsonld-cpp/detail/RDFDeserializationProcessor.h"
 #include "jsonld-cpp/detail/RDFSerializationProcessor.h"
 #include "jsonld-cpp/RemoteDocument.h"
 #include "jsonld-cpp/detail/ContextProcessor.h"
+#include "jsonld-cpp/detail/CompactionProcessor.h"
+#include "jsonld-cpp/detail/FlatteningProcessor.h"
+#include "jsonld-cpp/detail/FramingProcessor.h"
+#include "jsonld-cpp/detail/NodeMap.h"
+#include "jsonld-cpp/detail/Sha2.h"
+#include "jsonld-cpp/DocumentLoader.h"
+#include "jsonld-cpp/ProcessingStats.h"
+#include "jsonld-cpp/ResultCache.h"
+
+#include <mutex>
+#include <unordered_map>
 
 using RDF::RDFDataset;
 using json = nlohmann::ordered_json;
 
+namespace {
+
+    // Records the URL of every document loaded, so that the remote contexts a cached
+    // result depends on are known. Copies record into the same list.
+    class RecordingDocumentLoader : public DocumentLoader {
+    private:
+        std::unique_ptr<DocumentLoader> loader;
+        std::vector<std::string> * urls;
+
+    public:
+        RecordingDocumentLoader(std::unique_ptr<DocumentLoader> loader, std::vector<std::string> * urls)
+                : loader(std::move(loader)), urls(urls) {
+        }
+
+        DocumentLoader * clone() const override {
+            return new RecordingDocumentLoader(std::unique_ptr<DocumentLoader>(loader->clone()), urls);
+        }
+
+        std::unique_ptr<RemoteDocument> loadDocument(const std::string &url) override {
+            urls->push_back(url);
+            return loader->loadDocument(url);
+        }
+    };
+
+    // Contexts processed for compaction, keyed by processing mode, base URL and the
+    // serialized local context. Each has its inverse context built before it is cached,
+    // so the cached contexts are never modified and can be shared between threads.
+    // Contexts that load remote contexts are not cached, as what they load depends on
+    // the caller's document loader and may change.
+    const std::size_t MAX_CACHED_COMPACTION_CONTEXTS = 32;
+    std::mutex compactionContextsMutex;
+    std::unordered_map<std::string, std::shared_ptr<const Context>> compactionContexts;
+
+    Context processCompactionContext(const json & localContext, const std::string & baseUrl, JsonLdOptions & options) {
+        std::string key = options.getProcessingMode() + '\n' + baseUrl + '\n' + localContext.dump();
+
+        std::shared_ptr<const Context> processedContext;
+        {
+            std::lock_guard<std::mutex> lock(compactionContextsMutex);
+            auto it = compactionContexts.find(key);
+            if (it != compactionContexts.end())
+                processedContext = it->second;
+        }
+
+        if (processedContext == nullptr) {
+            std::vector<std::string> contextUrls;
+            JsonLdOptions contextOptions(options);
+            contextOptions.setDocumentLoader(std::unique_ptr<DocumentLoader>(new RecordingDocumentLoader(
+                    std::unique_ptr<DocumentLoader>(options.getDocumentLoader()->clone()), &contextUrls)));
+            Context activeContext(contextOptions);
+            std::shared_ptr<Context> result = std::make_shared<Context>(
+                    ContextProcessor::process(activeContext, localContext, baseUrl));
+            result->getInverseContext();
+            processedContext = result;
+
+            if (contextUrls.empty()) {
+                std::lock_guard<std::mutex> lock(compactionContextsMutex);
+                if (compactionContexts.size() >= MAX_CACHED_COMPACTION_CONTEXTS)
+                    compactionContexts.clear();
+                compactionContexts.emplace(key, processedContext);
+            }
+        }
+        else if (auto stats = options.getProcessingStats())
+            stats->add(ProcessingStats::Counter::CacheHits);
+
+        // the context was processed with other options than the caller's
+        Context context = *processedContext;
+        context.setOptions(options);
+        return context;
+    }
+
+    // Steps 3-4 of expand(): loads the document at documentLocation, or returns nullptr if
+    // documentLocation is not an IRI.
+    std::unique_ptr<RemoteDocument> loadRemoteDocument(const std::string & documentLocation, JsonLdOptions & options) {
+
+        // See JsonLdProcessor::expand() below for step descriptions.
+
+        // 3)
+        // Otherwise, if the provided input is a string representing the IRI of a remote
+        // document, await and dereference it as remote document using LoadDocumentCallback, passing
+        // input for url, the extractAllScripts option from options for extractAllScripts.
+        // 4)
+        // If document from remote document is a string, transform into the internal
+        // representation. If document cannot be transformed to the internal representation, reject
+        // promise passing a loading document failed error.
+        std::unique_ptr<RemoteDocument> remoteDocument;
+        if (documentLocation.find(':') != std::string::npos) {
+            try {
+                ProcessingStats::PhaseTimer timer(options.getProcessingStats(), ProcessingStats::Phase::DocumentLoading);
+                remoteDocument = options.getDocumentLoader()->loadDocument(documentLocation);
+
+                if (options.getBase().empty()) {
+                    options.setBase(documentLocation);
+                }
+            }
+            catch (const JsonLdError &e) {
+                throw e;
+            }
+            catch (const std::exception &e) {
+                throw JsonLdError(JsonLdError::LoadingDocumentFailed, e.what());
+            }
+        }
+        return remoteDocument;
+    }
+
+    // Steps 5-9 of expand(), for a document that has already been loaded.
+    json expandRemoteDocument(const RemoteDocument & remoteDocument, JsonLdOptions & options,
+                              std::vector<std::string> * contextUrls) {
+
+        // See JsonLdProcessor::expand() below for step descriptions.
+
+        // 5)
+        // Initialize a new empty active context. The base IRI and original base URL of the active
+        // context is set to the documentUrl from remote document, if available; otherwise to the
+        // base option from options. If set, the base option from options overrides the base IRI.
+        // Note: if contextUrls is not null, the URLs of the remote contexts loaded are added to it.
+        Context activeContext(options);
+        if (contextUrls != nullptr) {
+            JsonLdOptions contextOptions(options);
+            contextOptions.setDocumentLoader(std::unique_ptr<DocumentLoader>(new RecordingDocumentLoader(
+                    std::unique_ptr<DocumentLoader>(options.getDocumentLoader()->clone()), contextUrls)));
+            activeContext.setOptions(contextOptions);
+        }
+        // todo: set to the documentUrl from remote document, if available
+        activeContext.setBaseIri(options.getBase());
+        activeContext.setOriginalBaseUrl(options.getBase());
+
+        // 6)
+        // If the expandContext option in options is set, update the active context using the
+        // Context Processing algorithm, passing the expandContext as local context and the original
+        // base URL from active context as base URL. If expandContext is a map having an @context
+        // entry, pass that entry's value instead for local context.
+        if (!options.getExpandContext().empty()) {
+            json expandContext = options.getExpandContext();
+            if (expandContext.contains(JsonLdConsts::CONTEXT)) {
+                expandContext = expandContext[JsonLdConsts::CONTEXT];
+            }
+            activeContext = ContextProcessor::process(activeContext, expandContext, activeContext.getOriginalBaseUrl());
+        }
+
+        // 7)
+        // If remote document has a contextUrl, update the active context using the Context
+        // Processing algorithm, passing the contextUrl as local context, and contextUrl as base URL.
+        // todo: handle the contextUrl from remote document, if available
+
+        // 8)
+        // Set expanded output to the result of using the Expansion algorithm, passing the active
+        // context, document from remote document or input if there is no remote document as
+        // element, null as active property, documentUrl as base URL, if available, otherwise to
+        // the base option from options, and the frameExpansion and ordered flags from options.
+        json expandedOutput = ExpansionProcessor::expand(
+                activeContext,
+                nullptr,
+                remoteDocument.getJSONContent(),
+                activeContext.getOriginalBaseUrl());
+
+        // 8.1)
+        // If expanded output is a map that contains only an @graph entry, set expanded output to
+        // that value.
+        if (expandedOutput.is_object() && expandedOutput.contains(JsonLdConsts::GRAPH)
+            && expandedOutput.size() == 1) {
+            expandedOutput = expandedOutput.at(JsonLdConsts::GRAPH);
+        }
+
+        // 8.2)
+        // If expanded output is null, set expanded output to an empty array.
+        if (expandedOutput.is_null()) {
+            expandedOutput = json::array();
+        }
+
+        // 8.3)
+        // If expanded output is not an array, set expanded output to an array containing only
+        // expanded output.
+        if (!expandedOutput.is_array()) {
+            json tmp = json::array();
+            tmp.push_back(expandedOutput);
+            expandedOutput = tmp;
+        }
+
+        // 9)
+        // Resolve the promise with expanded output transforming expanded output from the internal
+        // representation to a JSON serialization.
+        return expandedOutput;
+    }
+
+    // Returns the hash used to identify the content of a loaded document in a ResultCache
+    std::string hashDocument(const RemoteDocument & remoteDocument) {
+        return Sha2::hexDigest(Sha2::Algorithm::SHA256, remoteDocument.getJSONContent().dump());
+    }
+
+    // Returns the key of the result of operation on a document in a ResultCache. It is
+    // made of the options that affect the result of expand() or toRDF(), and documentHash.
+    std::string resultCacheKey(const char * operation, const std::string & documentHash, const JsonLdOptions & options) {
+        std::string key = operation;
+        key += '\n';
+        key += options.getBase();
+        key += '\n';
+        key += options.getProcessingMode();
+        key += '\n';
+        key += options.getExpandContext().dump();
+        key += '\n';
+        key += options.isFrameExpansion() ? '1' : '0';
+        key += options.isOrdered() ? '1' : '0';
+        key += options.getProduceGeneralizedRdf() ? '1' : '0';
+        key += '\n';
+        key += options.getRdfDirection();
+        key += '\n';
+        key += documentHash;
+        return key;
+    }
+
+    // Steps 5-9 of expand() for a document whose expanded output may be in cache. Sets
+    // contextUrls to the URLs of the remote contexts the expanded output depends on.
+    json expandCached(const RemoteDocument & remoteDocument, const std::string & documentHash,
+                      JsonLdOptions & options, ResultCache & cache, std::vector<std::string> & contextUrls) {
+        std::string key = resultCacheKey("expand", documentHash, options);
+        std::shared_ptr<const json> cached = cache.findExpanded(key, &contextUrls);
+        if (cached != nullptr) {
+            if (auto stats = options.getProcessingStats())
+                stats->add(ProcessingStats::Counter::CacheHits);
+            return *cached;
+        }
+
+        contextUrls.clear();
+        json expandedOutput = expandRemoteDocument(remoteDocument, options, &contextUrls);
+        cache.addExpanded(key, expandedOutput, contextUrls);
+        return expandedOutput;
+    }
+
+    // Steps 4-9 of compact(), for a document that has already been expanded. If
+    // alwaysGraph is true, the compacted nodes are always put under a top-level @graph
+    // entry, even if there is only one.
+    json compactExpanded(const json & expandedInput, const json & context, JsonLdOptions & options, bool alwaysGraph) {
+
+        // See JsonLdProcessor::compact() below for step descriptions.
+
+        // 4)
+        // Initialize context base to the documentUrl from remote document, if available,
+        // otherwise to the base option from options.
+        // Note: expand() sets the base option to the document location if it was not set.
+        std::string contextBase = options.getBase();
+
+        // 5)
+        // If context is a map having an @context entry, set context to that entry's value,
+        // otherwise to context.
+        json localContext = context;
+        if (localContext.is_object() && localContext.contains(JsonLdConsts::CONTEXT))
+            localContext = localContext.at(JsonLdConsts::CONTEXT);
+
+        // 6-7)
+        // Initialize an active context using context; the base IRI is set to the base option
+        // from options, if set; otherwise, if the compactToRelative option is true, to the IRI
+        // of the currently being processed document, if available; otherwise to null.
+        // Note: IRIs are only made relative when compactToRelative is true, see
+        // CompactionProcessor::compactIri().
+        Context activeContext = processCompactionContext(localContext, contextBase, options);
+
+        // 8)
+        // Set compacted output to the result of using the Compaction algorithm, using active
+        // context, an empty map as inverse context, null as property, expanded input as
+        // element, and if passed, the compactArrays and ordered flags in options.
+        json compactedOutput = CompactionProcessor::compact(
+                activeContext, nullptr, expandedInput, options.getCompactArrays(), options.isOrdered());
+
+        // 8.1)
+        // If compacted output is an empty array, replace it with a new map.
+        // 8.2)
+        // Otherwise, if compacted output is an array, replace it with a new map with a single
+        // entry whose key is the result of IRI compacting @graph and value is compacted output.
+        if (alwaysGraph && !compactedOutput.is_array())
+            compactedOutput = json::array({compactedOutput});
+        if (compactedOutput.is_array()) {
+            json output = json::object();
+            if (alwaysGraph || !compactedOutput.empty())
+                output[CompactionProcessor::compactIri(activeContext, JsonLdConsts::GRAPH)] = compactedOutput;
+            compactedOutput = output;
+        }
+
+        // 8.3)
+        // If context was not null, add an @context entry to compacted output and set its value
+        // to the provided context.
+        if (!localContext.is_null() && !(localContext.is_structured() && localContext.empty())) {
+            json output = json::object();
+            output[JsonLdConsts::CONTEXT] = localContext;
+            for (auto & el : compactedOutput.items())
+                output[el.key()] = std::move(el.value());
+            compactedOutput = std::move(output);
+        }
+
+        // 9)
+        // Resolve the promise with compacted output transforming compacted output from the
+        // internal representation to a JSON serialization.
+        return compactedOutput;
+    }
+
+    // Steps 4-6 of flatten(), for a document whose node map has already been generated.
+    json flattenNodeMap(const NodeMap & nodeMap, const json & context, JsonLdOptions & options) {
+
+        // See JsonLdProcessor::flatten() below for step descriptions.
+
+        // 4)
+        // Set flattened output to the result of using the Flattening algorithm, passing
+        // expanded input as element, and the ordered flag from options.
+        json flattenedOutput = FlatteningProcessor::flatten(nodeMap);
+
+        // 5)
+        // If context is not null, set flattened output to the result of using the
+        // compact() method using flattened output, context, and options.
+        if (!context.is_null())
+            flattenedOutput = compactExpanded(flattenedOutput, context, options, true);
+
+        // 6)
+        // Resolve the promise with flattened output transforming flattened output from the
+        // internal representation to a JSON serialization.
+        return flattenedOutput;
+    }
+}
+
 json JsonLdProcessor::expand(const std::string& documentLocation, JsonLdOptions& options) {
 
     // Comments in this function are labeled with numbers that correspond to sections
@@ -24,99 +354,207 @@ json JsonLdProcessor::expand(const std::string& documentLocation, JsonLdOptions&
     // If the provided input is a RemoteDocument, initialize remote document to input.
     // todo: need to make separate function to handle RemoteDocument
 
+    // 3-4)
+    // Load the document, see loadRemoteDocument(). If input is not an IRI, there is
+    // nothing to expand.
+    std::unique_ptr<RemoteDocument> remoteDocument = loadRemoteDocument(documentLocation, options);
+    if (remoteDocument == nullptr)
+        return json::array();
+
+    // 5-9)
+    // Rest of the algorithm in expandRemoteDocument(). If options has a ResultCache, the
+    // expanded output is only computed if it is not already cached.
+    ResultCache * cache = options.getResultCache();
+    if (cache == nullptr)
+        return expandRemoteDocument(*remoteDocument, options, nullptr);
+
+    std::vector<std::string> contextUrls;
+    return expandCached(*remoteDocument, hashDocument(*remoteDocument), options, *cache, contextUrls);
+}
+
+json JsonLdProcessor::compact(const std::string& documentLocation, const json& context, JsonLdOptions& options) {
+
+    // Comments in this function are labeled with numbers that correspond to sections
+    // from the description of the compact() function in the JsonLdProcessor interface.
+    // See: https://www.w3.org/TR/json-ld11-api/#dom-jsonldprocessor-compact
+
+    // 1)
+    // Create a new Promise promise and return it. The following steps are then deferred.
+    // Note: the current implementation of jsonld-cpp does not use Promises.
+
+    // 2-3)
+    // Set expanded input to the result of using the expand() method using input and
+    // options with ordered set to false.
+    bool ordered = options.isOrdered();
+    options.setOrdered(false);
+    json expandedInput = expand(documentLocation, options);
+    options.setOrdered(ordered);
+
+    // 4-9)
+    // Rest of the algorithm in compactExpanded().
+    return compactExpanded(expandedInput, context, options, false);
+}
+
+json JsonLdProcessor::flatten(const std::string& documentLocation, const json& context, JsonLdOptions& options) {
+
+    // Comments in this function are labeled with numbers that correspond to sections
+    // from the description of the flatten() function in the JsonLdProcessor interface.
+    // See: https://www.w3.org/TR/json-ld11-api/#dom-jsonldprocessor-flatten
+
+    // 1)
+    // Create a new Promise promise and return it. The following steps are then deferred.
+    // Note: the current implementation of jsonld-cpp does not use Promises.
+
+    // 2)
+    // Set expanded input to the result of using the expand() method using input and
+    // options with ordered set to false.
+    bool ordered = options.isOrdered();
+    options.setOrdered(false);
+    json expandedInput = expand(documentLocation, options);
+    options.setOrdered(ordered);
+
     // 3)
-    // Otherwise, if the provided input is a string representing the IRI of a remote
-    // document, await and dereference it as remote document using LoadDocumentCallback, passing
-    // input for url, the extractAllScripts option from options for extractAllScripts.
-    // 4)
-    // If document from remote document is a string, transform into the internal
-    // representation. If document cannot be transformed to the internal representation, reject
-    // promise passing a loading document failed error.
-    std::unique_ptr<RemoteDocument> remoteDocument;
-    if (documentLocation.find(':') != std::string::npos) {
-        try {
-            remoteDocument = options.getDocumentLoader()->loadDocument(documentLocation);
+    // Create a new map, identifier map, used to generate blank node identifiers, and
+    // generate the node map of expanded input.
+    // Note: the Flattening algorithm generates the node map, but it is generated here so
+    // that it can be shared with toRDF(), see below.
+    NodeMap nodeMap;
+    {
+        ProcessingStats::PhaseTimer timer(options.getProcessingStats(), ProcessingStats::Phase::NodeMapGeneration);
+        nodeMap.add(expandedInput);
+    }
 
-            if (options.getBase().empty()) {
-                options.setBase(documentLocation);
-            }
-        }
-        catch (const JsonLdError &e) {
-            throw e;
-        }
-        catch (const std::exception &e) {
-            throw JsonLdError(JsonLdError::LoadingDocumentFailed, e.what());
-        }
+    // 4-6)
+    // Rest of the algorithm in flattenNodeMap().
+    return flattenNodeMap(nodeMap, context, options);
+}
+
+json JsonLdProcessor::flatten(const std::string& documentLocation, const json& context, JsonLdOptions& options,
+                              RDFDataset& dataset) {
+
+    // See JsonLdProcessor::flatten() above for step descriptions. The node map is
+    // generated once and used for both the flattened output and the dataset.
+
+    bool ordered = options.isOrdered();
+    options.setOrdered(false);
+    json expandedInput = expand(documentLocation, options);
+    options.setOrdered(ordered);
+
+    NodeMap nodeMap;
+    {
+        ProcessingStats::PhaseTimer timer(options.getProcessingStats(), ProcessingStats::Phase::NodeMapGeneration);
+        nodeMap.add(expandedInput);
     }
-    else
-        return json::array();
 
-    // 5)
-    // Initialize a new empty active context. The base IRI and original base URL of the active
-    // context is set to the documentUrl from remote document, if available; otherwise to the
-    // base option from options. If set, the base option from options overrides the base IRI.
-    Context activeContext(options);
-    // todo: set to the documentUrl from remote document, if available
+    json flattenedOutput = flattenNodeMap(nodeMap, context, options);
+    dataset = RDFSerializationProcessor::toRDF(nodeMap, options);
+    return flattenedOutput;
+}
+
+json JsonLdProcessor::frame(const std::string& documentLocation, const json& frame, JsonLdOptions& options) {
+
+    // Comments in this function are labeled with numbers that correspond to sections
+    // from the description of the frame() function in the JsonLdProcessor interface.
+    // See: https://www.w3.org/TR/json-ld11-framing/#dom-jsonldprocessor-frame
+
+    // 1)
+    // Create a new Promise promise and return it. The following steps are then deferred.
+    // Note: the current implementation of jsonld-cpp does not use Promises.
+
+    // 2-6)
+    // Set expanded input to the result of using the expand() method using input and
+    // options with ordered set to false.
+    bool ordered = options.isOrdered();
+    options.setOrdered(false);
+    json expandedInput = expand(documentLocation, options);
+    options.setOrdered(ordered);
+
+    // 7-8)
+    // Set expanded frame to the result of using the expand() method using frame and
+    // options with expandContext set to null and the frameExpansion option set to true.
+    JsonLdOptions frameOptions(options);
+    frameOptions.setFrameExpansion(true);
+    Context activeContext(frameOptions);
     activeContext.setBaseIri(options.getBase());
     activeContext.setOriginalBaseUrl(options.getBase());
+    json expandedFrame = ExpansionProcessor::expand(activeContext, nullptr, frame, options.getBase());
 
-    // 6)
-    // If the expandContext option in options is set, update the active context using the
-    // Context Processing algorithm, passing the expandContext as local context and the original
-    // base URL from active context as base URL. If expandContext is a map having an @context
-    // entry, pass that entry's value instead for local context.
-    if (!options.getExpandContext().empty()) {
-        json expandContext = options.getExpandContext();
-        if (expandContext.contains(JsonLdConsts::CONTEXT)) {
-            expandContext = expandContext[JsonLdConsts::CONTEXT];
-        }
-        activeContext = ContextProcessor::process(activeContext, expandContext, activeContext.getOriginalBaseUrl());
+    // 9-10)
+    // Set context to the value of @context from frame, if it exists, or to null.
+    json context;
+    if (frame.is_object() && frame.contains(JsonLdConsts::CONTEXT))
+        context = frame;
+
+    // 11)
+    // If frame has a top-level @graph entry, frame the default graph, otherwise the merged
+    // graph of all graphs.
+    bool merged = !(expandedFrame.is_object() && expandedFrame.contains(JsonLdConsts::GRAPH));
+    if (expandedFrame.is_object() && expandedFrame.contains(JsonLdConsts::GRAPH) && expandedFrame.size() == 1)
+        expandedFrame = expandedFrame.at(JsonLdConsts::GRAPH);
+    if (expandedFrame.is_null())
+        expandedFrame = json::array();
+
+    // 12)
+    // Initialize node map to the result of the Node Map Generation algorithm using
+    // expanded input.
+    NodeMap nodeMap;
+    {
+        ProcessingStats::PhaseTimer timer(options.getProcessingStats(), ProcessingStats::Phase::NodeMapGeneration);
+        nodeMap.add(expandedInput);
     }
 
-    // 7)
-    // If remote document has a contextUrl, update the active context using the Context
-    // Processing algorithm, passing the contextUrl as local context, and contextUrl as base URL.
-    // todo: handle the contextUrl from remote document, if available
+    // 13-15)
+    // Rest of the Framing algorithm in FramingProcessor::frame().
+    json framedOutput = FramingProcessor::frame(nodeMap, expandedFrame, options, merged);
 
-    // 8)
-    // Set expanded output to the result of using the Expansion algorithm, passing the active
-    // context, document from remote document or input if there is no remote document as
-    // element, null as active property, documentUrl as base URL, if available, otherwise to
-    // the base option from options, and the frameExpansion and ordered flags from options.
-    json expandedOutput = ExpansionProcessor::expand(
-            activeContext,
-            nullptr,
-            remoteDocument->getJSONContent(),
-            activeContext.getOriginalBaseUrl());
+    // 16-19)
+    // Set compacted results to the result of using the compact() method using results,
+    // context, and options. Unless omitGraph is true, the nodes are put under a top-level
+    // @graph entry, and @null placeholders are then replaced by null.
+    json compactedOutput = compactExpanded(framedOutput, context, options, !options.getOmitGraph());
+    FramingProcessor::removeNullPlaceholders(compactedOutput);
 
-    // 8.1)
-    // If expanded output is a map that contains only an @graph entry, set expanded output to
-    // that value.
-    if (expandedOutput.is_object() && expandedOutput.contains(JsonLdConsts::GRAPH)
-        && expandedOutput.size() == 1) {
-        expandedOutput = expandedOutput.at(JsonLdConsts::GRAPH);
-    }
+    // 20)
+    // Resolve the promise with compacted results transforming compacted results from the
+    // internal representation to a JSON serialization.
+    return compactedOutput;
+}
 
-    // 8.2)
-    // If expanded output is null, set expanded output to an empty array.
-    if (expandedOutput.is_null()) {
-        expandedOutput = json::array();
-    }
+json JsonLdProcessor::fromRDF(const std::string& documentLocation, JsonLdOptions& options) {
+
+    // Comments in this function are labeled with numbers that correspond to sections
+    // from the description of the fromRDF() function in the JsonLdProcessor interface.
+    // See: https://www.w3.org/TR/json-ld11-api/#dom-jsonldprocessor-fromrdf
 
-    // 8.3)
-    // If expanded output is not an array, set expanded output to an array containing only
-    // expanded output.
-    if (!expandedOutput.is_array()) {
-        json tmp = json::array();
-        tmp.push_back(expandedOutput);
-        expandedOutput = tmp;
+    // 1)
+    // Create a new Promise promise and return it. The following steps are then deferred.
+    // Note: the current implementation of jsonld-cpp does not use Promises.
+
+    // Note: input is the location of an RDF document, which is loaded into an RdfDataset
+    // using the documentLoader option.
+    std::unique_ptr<RemoteDocument> remoteDocument;
+    try {
+        ProcessingStats::PhaseTimer timer(options.getProcessingStats(), ProcessingStats::Phase::DocumentLoading);
+        remoteDocument = options.getDocumentLoader()->loadDocument(documentLocation);
     }
+    catch (const JsonLdError &e) {
+        throw e;
+    }
+    catch (const std::exception &e) {
+        throw JsonLdError(JsonLdError::LoadingDocumentFailed, e.what());
+    }
+
+    return fromRDF(remoteDocument->getRDFContent(), options);
+}
+
+json JsonLdProcessor::fromRDF(const RDF::RDFDataset& dataset, JsonLdOptions& options) {
 
-    // 9)
-    // Resolve the promise with expanded output transforming expanded output from the internal
-    // representation to a JSON serialization.
-    return expandedOutput;
+    // See JsonLdProcessor::fromRDF() above for step descriptions.
 
+    // 2)
+    // Create a new map expanded result and return the result of using the Serialize RDF
+    // as JSON-LD Algorithm, passing input and options.
+    return RDFDeserializationProcessor::fromRDF(dataset, options);
 }
 
 RDFDataset JsonLdProcessor::toRDF(const std::string& documentLocation, JsonLdOptions& options) {
@@ -133,11 +571,57 @@ RDFDataset JsonLdProcessor::toRDF(const std::string& documentLocation, JsonLdOpt
     // Set expanded input to the result of using the expand() method using input and options
     // with ordered set to false.
     options.setOrdered(false);
-    json expandedInput = expand(documentLocation, options);
+    ResultCache * cache = options.getResultCache();
+    if (cache == nullptr) {
+        json expandedInput = expand(documentLocation, options);
+
+        // 3-7)
+        // Rest of the algorithm in RDFSerializationProcessor::toRDF().
+        return RDFSerializationProcessor::toRDF(expandedInput, options);
+    }
+
+    // Note: if options has a ResultCache, the dataset is only computed if it is not
+    // already cached, and the document is then only expanded if its expanded input is not.
+    std::unique_ptr<RemoteDocument> remoteDocument = loadRemoteDocument(documentLocation, options);
+    if (remoteDocument == nullptr)
+        return RDFSerializationProcessor::toRDF(json::array(), options);
 
-    // 3-7)
-    // Rest of the algorithm in RDFSerializationProcessor::toRDF().
-    RDFDataset dataset = RDFSerializationProcessor::toRDF(expandedInput, options);
+    std::string documentHash = hashDocument(*remoteDocument);
+    std::string key = resultCacheKey("toRDF", documentHash, options);
+    std::shared_ptr<const RDFDataset> cached = cache->findDataset(key);
+    if (cached != nullptr) {
+        if (auto stats = options.getProcessingStats())
+            stats->add(ProcessingStats::Counter::CacheHits);
+        RDFDataset dataset(options);
+        for (const auto & graph : *cached)
+            dataset.setGraph(graph.second, graph.first);
+        return dataset;
+    }
 
+    std::vector<std::string> contextUrls;
+    json expandedInput = expandCached(*remoteDocument, documentHash, options, *cache, contextUrls);
+    RDFDataset dataset = RDFSerializationProcessor::toRDF(std::move(expandedInput), options);
+    cache->addDataset(key, dataset, contextUrls);
     return dataset;
 }
+
+void JsonLdProcessor::toRDF(const std::string& documentLocation, JsonLdOptions& options,
+                            const std::function<void(const RDF::RDFQuad &)>& quadCallback) {
+
+    // See JsonLdProcessor::toRDF() above for step descriptions.
+
+    options.setOrdered(false);
+    json expandedInput = expand(documentLocation, options);
+
+    RDFSerializationProcessor::toRDF(std::move(expandedInput), options, quadCallback);
+}
+
+void JsonLdProcessor::toRDF(const std::string& documentLocation, JsonLdOptions& options, RDF::QuadSink& sink) {
+
+    // See JsonLdProcessor::toRDF() above for step descriptions.
+
+    options.setOrdered(false);
+    json expandedInput = expand(documentLocation, options);
+
+    RDFSerializationProcessor::toRDF(std::move(expandedInput), options, sink);
+}
@@ -1,31 +1,99 @@
 #ifndef LIBJSONLD_CPP_JSONLDPROCESSOR_H
 #define LIBJSONLD_CPP_JSONLDPROCESSOR_H
 
+#include <functional>
+
 #include "jsonld-cpp/JsonLdOptions.h"
 
 namespace RDF {
     class RDFDataset;
+    class RDFQuad;
+    class QuadSink;
 }
 
 /**
  * Functions in this namespace implement the JsonLdProcessor interface.
  * See: https://www.w3.org/TR/json-ld11-api/#the-jsonldprocessor-interface
+ *
+ * If options has ProcessingStats, the time spent in each phase of processing, and counts
+ * of the work done, are added to them. See ProcessingStats.h.
  */
 
 namespace JsonLdProcessor {
 
     // Expands JSON-LD document located at filename or IRI according to the steps in the
-    // Expansion algorithm
+    // Expansion algorithm. If options has a ResultCache, a document that was expanded
+    // before with the same options is not expanded again.
     // See: https://www.w3.org/TR/json-ld11-api/#dom-jsonldprocessor-expand
     // See: https://www.w3.org/TR/json-ld11-api/#expansion-algorithm
     nlohmann::ordered_json expand(const std::string& documentLocation, JsonLdOptions& options);
 
+    // Compacts JSON-LD document located at filename or IRI according to the steps in the
+    // Compaction algorithm, using context. Processed contexts are cached together with
+    // their inverse context, so compacting many documents with the same context only
+    // processes it and builds its term selection tables once.
+    // See: https://www.w3.org/TR/json-ld11-api/#dom-jsonldprocessor-compact
+    // See: https://www.w3.org/TR/json-ld11-api/#compaction-algorithm
+    nlohmann::ordered_json compact(const std::string& documentLocation, const nlohmann::ordered_json& context,
+                                   JsonLdOptions& options);
+
+    // Flattens JSON-LD document located at filename or IRI according to the steps in the
+    // Flattening algorithm. If context is not null, the flattened document is compacted
+    // using context, with its nodes under a top-level @graph entry.
+    // See: https://www.w3.org/TR/json-ld11-api/#dom-jsonldprocessor-flatten
+    // See: https://www.w3.org/TR/json-ld11-api/#flattening-algorithm
+    nlohmann::ordered_json flatten(const std::string& documentLocation, const nlohmann::ordered_json& context,
+                                   JsonLdOptions& options);
+
+    // Flattens JSON-LD document located at filename or IRI, as flatten() above, and also
+    // transforms it into an RdfDataset, as toRDF() does. The document is only expanded
+    // and its node map generated once for both results, and blank nodes have the same
+    // identifiers in the flattened document and in dataset.
+    // See: https://www.w3.org/TR/json-ld11-api/#dom-jsonldprocessor-flatten
+    // See: https://www.w3.org/TR/json-ld11-api/#dom-jsonldprocessor-tordf
+    nlohmann::ordered_json flatten(const std::string& documentLocation, const nlohmann::ordered_json& context,
+                                   JsonLdOptions& options, RDF::RDFDataset& dataset);
+
+    // Frames JSON-LD document located at filename or IRI according to the steps in the
+    // Framing algorithm, using frame, and compacts the result using the @context entry of
+    // frame. The nodes that could match each frame are selected from indexes of the
+    // flattened document by @id, @type and property, instead of matching every node.
+    // See: https://www.w3.org/TR/json-ld11-framing/#dom-jsonldprocessor-frame
+    // See: https://www.w3.org/TR/json-ld11-framing/#framing-algorithm
+    nlohmann::ordered_json frame(const std::string& documentLocation, const nlohmann::ordered_json& frame,
+                                 JsonLdOptions& options);
+
+    // Transforms RDF document located at filename or IRI into a JSON-LD document in
+    // expanded form according to the steps in the Serialize RDF as JSON-LD Algorithm
+    // See: https://www.w3.org/TR/json-ld11-api/#dom-jsonldprocessor-fromrdf
+    // See: https://www.w3.org/TR/json-ld11-api/#serialize-rdf-as-json-ld-algorithm
+    nlohmann::ordered_json fromRDF(const std::string& documentLocation, JsonLdOptions& options);
+
+    // Transforms dataset into a JSON-LD document in expanded form, as fromRDF() above.
+    // See: https://www.w3.org/TR/json-ld11-api/#dom-jsonldprocessor-fromrdf
+    nlohmann::ordered_json fromRDF(const RDF::RDFDataset& dataset, JsonLdOptions& options);
+
     // Transforms JSON-LD document located at filename or IRI into an RdfDataset
-    // according to the steps in the Deserialize JSON-LD to RDF Algorithm
+    // according to the steps in the Deserialize JSON-LD to RDF Algorithm. If options has a
+    // ResultCache, a dataset built before from the same document and options is returned.
     // See: https://www.w3.org/TR/json-ld11-api/#dom-jsonldprocessor-tordf
     // See: https://www.w3.org/TR/json-ld11-api/#deserialize-json-ld-to-rdf-algorithm
     RDF::RDFDataset toRDF(const std::string& documentLocation, JsonLdOptions& options);
 
+    // Transforms JSON-LD document located at filename or IRI into RDF, passing each quad
+    // to quadCallback as it is generated instead of building an RdfDataset. If the
+    // rdfChunkSize option is set, top-level nodes are converted in chunks of that size
+    // and quads are emitted as each chunk completes.
+    // See: https://www.w3.org/TR/json-ld11-api/#dom-jsonldprocessor-tordf
+    void toRDF(const std::string& documentLocation, JsonLdOptions& options,
+               const std::function<void(const RDF::RDFQuad &)>& quadCallback);
+
+    // Transforms JSON-LD document located at filename or IRI into RDF, passing each quad
+    // to sink as it is generated. No RdfDataset, RDFTriple or Node objects are built, so
+    // this is the cheapest way to stream results into a store, serializer or hash function.
+    // See: https://www.w3.org/TR/json-ld11-api/#dom-jsonldprocessor-tordf
+    void toRDF(const std::string& documentLocation, JsonLdOptions& options, RDF::QuadSink& sink);
+
 }
 
 #endif //LIBJSONLD_CPP_JSONLDPROCESSOR_H
@@ -1,6 +1,73 @@
 #include "jsonld-cpp/JsonLdUrl.h"
 #include "jsonld-cpp/detail/Uri.h"
 
+#include <vector>
+
+namespace {
+
+    // The components of a URI reference, as split by the regular expression in
+    // https://www.rfc-editor.org/rfc/rfc3986#appendix-B
+    struct UriComponents {
+        std::string scheme;
+        bool hasAuthority = false;
+        std::string authority;
+        std::string path;
+        bool hasQuery = false;
+        std::string query;
+        bool hasFragment = false;
+        std::string fragment;
+
+        explicit UriComponents(const std::string & uri) {
+            std::size_t pos = 0;
+            std::size_t colon = uri.find_first_of(":/?#");
+            if (colon != std::string::npos && colon > 0 && uri[colon] == ':') {
+                scheme = uri.substr(0, colon);
+                pos = colon + 1;
+            }
+            if (uri.compare(pos, 2, "//") == 0) {
+                std::size_t end = uri.find_first_of("/?#", pos + 2);
+                if (end == std::string::npos)
+                    end = uri.size();
+                hasAuthority = true;
+                authority = uri.substr(pos + 2, end - pos - 2);
+                pos = end;
+            }
+            std::size_t end = uri.find_first_of("?#", pos);
+            if (end == std::string::npos)
+                end = uri.size();
+            path = uri.substr(pos, end - pos);
+            pos = end;
+            if (pos < uri.size() && uri[pos] == '?') {
+                end = uri.find('#', pos);
+                if (end == std::string::npos)
+                    end = uri.size();
+                hasQuery = true;
+                query = uri.substr(pos + 1, end - pos - 1);
+                pos = end;
+            }
+            if (pos < uri.size() && uri[pos] == '#') {
+                hasFragment = true;
+                fragment = uri.substr(pos + 1);
+            }
+        }
+    };
+
+    std::vector<std::string> splitPath(const std::string & path) {
+        std::vector<std::string> segments;
+        std::size_t start = 0;
+        while (true) {
+            std::size_t slash = path.find('/', start);
+            if (slash == std::string::npos) {
+                segments.push_back(path.substr(start));
+                return segments;
+            }
+            segments.push_back(path.substr(start, slash - start));
+            start = slash + 1;
+        }
+    }
+
+}
+
 std::string JsonLdUrl::resolve(const std::string *baseUri, const std::string *pathToResolve) {
     if (baseUri == nullptr) {
         if(pathToResolve == nullptr)
@@ -16,3 +83,51 @@ std::string JsonLdUrl::resolve(const std::string *baseUri, const std::string *pa
     else
         return "";
 }
+
+std::string JsonLdUrl::removeBase(const std::string &baseUri, const std::string &iri) {
+    UriComponents base(baseUri);
+    UriComponents target(iri);
+
+    if (base.scheme.empty() || base.scheme != target.scheme ||
+        base.hasAuthority != target.hasAuthority || base.authority != target.authority)
+        return iri;
+
+    std::string fragment = target.hasFragment ? "#" + target.fragment : "";
+
+    // references to the base document only need the parts that differ
+    if (target.path == base.path) {
+        if (target.hasQuery && !(base.hasQuery && base.query == target.query))
+            return "?" + target.query + fragment;
+        if (target.hasQuery == base.hasQuery && target.hasFragment)
+            return fragment;
+    }
+
+    // the last segment of each path is a file name, the others are directories
+    std::vector<std::string> baseSegments = splitPath(base.path);
+    std::vector<std::string> targetSegments = splitPath(target.path);
+    std::size_t baseDirectories = baseSegments.size() - 1;
+    std::size_t targetDirectories = targetSegments.size() - 1;
+
+    std::size_t common = 0;
+    while (common < baseDirectories && common < targetDirectories &&
+           baseSegments[common] == targetSegments[common])
+        common++;
+
+    std::string result;
+    for (std::size_t i = common; i < baseDirectories; i++)
+        result += "../";
+    for (std::size_t i = common; i < targetSegments.size(); i++) {
+        result += targetSegments[i];
+        if (i < targetDirectories)
+            result += "/";
+    }
+
+    // a first segment containing a colon would be mistaken for a scheme
+    std::size_t colon = result.find(':');
+    if (result.empty() || (colon != std::string::npos && colon < result.find('/')))
+        result = "./" + result;
+
+    if (target.hasQuery)
+        result += "?" + target.query;
+    return result + fragment;
+}
@@ -18,6 +18,19 @@ struct JsonLdUrl {
      */
     static std::string resolve(const std::string * baseUri, const std::string * pathToResolve);
 
+    /**
+     * Return the shortest relative reference that resolves to 'iri' against 'baseUri', or
+     * 'iri' unchanged if it has a different scheme or authority than 'baseUri'. This is
+     * the inverse of resolve(), and both URIs are expected to be normalized.
+     *
+     * Ex: if baseUri is "http://a/b/c/d;p?q" and iri is "http://a/b/g", result will be "../g"
+     *
+     * @param baseUri the base URI
+     * @param iri the absolute URI to make relative to base
+     * @return the relative reference, or iri if it cannot be made relative to base
+     */
+    static std::string removeBase(const std::string & baseUri, const std::string & iri);
+
 };
 
 #endif //LIBJSONLD_CPP_JSONLDURL_H
@@ -10,6 +10,9 @@
 #include "jsonld-cpp/RDFQuad.h"
 #include "jsonld-cpp/RDFTriple.h"
 #include "jsonld-cpp/RDFDataset.h"
+#include "jsonld-cpp/BlankNodeNames.h"
+#include "jsonld-cpp/RDFCanonicalization.h"
+#include "jsonld-cpp/JsonLdOptions.h"
 #include "jsonld-cpp/detail/RDFRegex.h"
 #include "jsonld-cpp/JsonLdError.h"
 
@@ -219,8 +222,9 @@ std::string NQuadsSerialization::toNQuads(const RDF::RDFDataset &dataset) {
     std::vector<std::string> nquads;
     std::stringstream ss;
 
-    for (const auto& quad : dataset.getAllGraphsAsQuads()) {
-        nquads.push_back(toNQuad(quad));
+    nquads.reserve(dataset.numTriples());
+    for (const auto& quad : dataset.quads()) {
+        nquads.push_back(toNQuad(quad.getTriple(), quad.getGraphName()));
     }
 
     std::sort(nquads.begin(), nquads.end());
@@ -232,11 +236,36 @@ std::string NQuadsSerialization::toNQuads(const RDF::RDFDataset &dataset) {
     return ss.str();
 }
 
+std::string NQuadsSerialization::toNQuads(const RDF::RDFDataset &dataset, const JsonLdOptions &options) {
+
+    switch (options.getQuadOrdering()) {
+        case QuadOrdering::Insertion: {
+            std::stringstream ss;
+            for (const auto& quad : dataset.quads()) {
+                ss << toNQuad(quad.getTriple(), quad.getGraphName());
+            }
+            return ss.str();
+        }
+        case QuadOrdering::Canonical:
+            return toNQuads(RDFCanonicalization::canonicalize(dataset, options));
+        case QuadOrdering::Sorted:
+        default:
+            return toNQuads(dataset);
+    }
+}
+
 std::string NQuadsSerialization::toNQuad(const RDF::RDFQuad& quad) {
+    std::shared_ptr<RDF::Node> g = quad.getGraph();
+    if (g == nullptr)
+        return toNQuad(RDF::RDFTriple(quad.getSubject(), quad.getPredicate(), quad.getObject()));
+    return toNQuad(RDF::RDFTriple(quad.getSubject(), quad.getPredicate(), quad.getObject()), g->getValue());
+}
+
+std::string NQuadsSerialization::toNQuad(const RDF::RDFTriple& triple, const std::string& graphName) {
     std::stringstream ss;
 
     // subject: IRI or bnode (https://www.w3.org/TR/rdf11-concepts/#section-triples)
-    std::shared_ptr<RDF::Node> s = quad.getSubject();
+    std::shared_ptr<RDF::Node> s = triple.getSubject();
     if (s->isIRI())
         outputIRI(s->getValue(), ss);
     else
@@ -245,7 +274,7 @@ std::string NQuadsSerialization::toNQuad(const RDF::RDFQuad& quad) {
     ss << " ";
 
     // predicate: only IRI (https://www.w3.org/TR/rdf11-concepts/#section-triples)
-    std::shared_ptr<RDF::Node> p = quad.getPredicate();
+    std::shared_ptr<RDF::Node> p = triple.getPredicate();
     if (p->isIRI())
         outputIRI(p->getValue(), ss);
     else
@@ -254,7 +283,7 @@ std::string NQuadsSerialization::toNQuad(const RDF::RDFQuad& quad) {
     ss << " ";
 
     // object: IRI, bnode or literal (https://www.w3.org/TR/rdf11-concepts/#section-triples)
-    std::shared_ptr<RDF::Node> o = quad.getObject();
+    std::shared_ptr<RDF::Node> o = triple.getObject();
     if (o->isIRI())
         outputIRI(o->getValue(), ss);
     else if (o->isBlankNode())
@@ -275,12 +304,11 @@ std::string NQuadsSerialization::toNQuad(const RDF::RDFQuad& quad) {
     ss << " ";
 
     // graph: IRI or bnode (https://www.w3.org/TR/rdf11-concepts/#section-triples)
-    std::shared_ptr<RDF::Node> g = quad.getGraph();
-    if (g != nullptr && g->getValue() != JsonLdConsts::DEFAULT) {
-        if (g->isIRI())
-            outputIRI(g->getValue(), ss);
+    if (graphName != JsonLdConsts::DEFAULT) {
+        if (!BlankNodeNames::hasFormOfBlankNodeName(graphName))
+            outputIRI(graphName, ss);
         else
-            ss << g->getValue();
+            ss << graphName;
 
         ss << " ";
     }
@@ -291,7 +319,7 @@ std::string NQuadsSerialization::toNQuad(const RDF::RDFQuad& quad) {
 }
 
 std::string NQuadsSerialization::toNQuad(const RDF::RDFTriple& triple) {
-    return toNQuad({triple.getSubject(), triple.getPredicate(), triple.getObject(), nullptr});
+    return toNQuad(triple, JsonLdConsts::DEFAULT);
 }
 
 RDF::RDFDataset NQuadsSerialization::parse(std::string input) {
@@ -4,6 +4,8 @@
 #include <string>
 #include <sstream>
 
+class JsonLdOptions;
+
 namespace RDF {
     class RDFDataset;
     class RDFTriple;
@@ -25,10 +27,17 @@ namespace NQuadsSerialization {
     RDF::RDFDataset parse(std::string input);
 
     /**
-     * Converts an RDFDataset into a string in the form of N-Quads
+     * Converts an RDFDataset into a string in the form of N-Quads, sorted lexicographically
      */
     std::string toNQuads(const RDF::RDFDataset &dataset);
 
+    /**
+     * Converts an RDFDataset into a string in the form of N-Quads, in the order given by
+     * the quadOrdering option. The canonicalizationWorkLimit option is used for
+     * QuadOrdering::Canonical.
+     */
+    std::string toNQuads(const RDF::RDFDataset &dataset, const JsonLdOptions &options);
+
     /**
      * Converts an RDFQuad into a string in the form of an N-Quad
      */
@@ -39,6 +48,12 @@ namespace NQuadsSerialization {
      */
     std::string toNQuad(const RDF::RDFTriple &triple);
 
+    /**
+     * Converts an RDFTriple in the graph named graphName into a string in the form of an
+     * N-Quad. graphName is JsonLdConsts::DEFAULT for the default graph.
+     */
+    std::string toNQuad(const RDF::RDFTriple &triple, const std::string &graphName);
+
     /**
      * Writes IRI value to given stringstream, escaping characters as necessary
      * See N-Quads escaping rules: https://www.w3.org/TR/turtle/#sec-escapes
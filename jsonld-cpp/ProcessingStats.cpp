@@ -0,0 +1,119 @@
+#include "jsonld-cpp/ProcessingStats.h"
+
+#include <sstream>
+
+constexpr std::size_t ProcessingStats::NUM_PHASES;
+constexpr std::size_t ProcessingStats::NUM_COUNTERS;
+
+namespace {
+
+    // the innermost running PhaseTimer of each thread, which is paused by a nested one
+    thread_local ProcessingStats::PhaseTimer * currentTimer = nullptr;
+
+}
+
+const char * ProcessingStats::phaseName(Phase phase) {
+    switch (phase) {
+        case Phase::DocumentLoading:
+            return "document loading";
+        case Phase::ContextProcessing:
+            return "context processing";
+        case Phase::Expansion:
+            return "expansion";
+        case Phase::NodeMapGeneration:
+            return "node map generation";
+        case Phase::TripleGeneration:
+            return "triple generation";
+        case Phase::DatasetInsertion:
+            return "dataset insertion";
+    }
+    return "unknown";
+}
+
+const char * ProcessingStats::counterName(Counter counter) {
+    switch (counter) {
+        case Counter::RemoteContextLoads:
+            return "remote context loads";
+        case Counter::CacheHits:
+            return "cache hits";
+        case Counter::TermsDefined:
+            return "terms defined";
+        case Counter::NodesExpanded:
+            return "nodes expanded";
+        case Counter::TriplesEmitted:
+            return "triples emitted";
+        case Counter::DuplicateTriplesDropped:
+            return "duplicate triples dropped";
+    }
+    return "unknown";
+}
+
+ProcessingStats::ProcessingStats() {
+    clear();
+}
+
+void ProcessingStats::add(Counter counter, std::size_t n) {
+    counts[static_cast<std::size_t>(counter)].fetch_add(n, std::memory_order_relaxed);
+}
+
+void ProcessingStats::addTime(Phase phase, std::chrono::nanoseconds time) {
+    times[static_cast<std::size_t>(phase)].fetch_add(time.count(), std::memory_order_relaxed);
+}
+
+std::size_t ProcessingStats::getCount(Counter counter) const {
+    return counts[static_cast<std::size_t>(counter)].load(std::memory_order_relaxed);
+}
+
+std::chrono::nanoseconds ProcessingStats::getTime(Phase phase) const {
+    return std::chrono::nanoseconds(times[static_cast<std::size_t>(phase)].load(std::memory_order_relaxed));
+}
+
+std::chrono::nanoseconds ProcessingStats::getTotalTime() const {
+    std::chrono::nanoseconds total(0);
+    for (std::size_t i = 0; i < NUM_PHASES; i++)
+        total += getTime(static_cast<Phase>(i));
+    return total;
+}
+
+void ProcessingStats::clear() {
+    for (auto & time : times)
+        time = 0;
+    for (auto & count : counts)
+        count = 0;
+}
+
+std::string ProcessingStats::toString() const {
+    std::ostringstream out;
+    for (std::size_t i = 0; i < NUM_PHASES; i++) {
+        auto phase = static_cast<Phase>(i);
+        out << phaseName(phase) << ": " << static_cast<double>(getTime(phase).count()) / 1e6 << " ms\n";
+    }
+    for (std::size_t i = 0; i < NUM_COUNTERS; i++) {
+        auto counter = static_cast<Counter>(i);
+        out << counterName(counter) << ": " << getCount(counter) << '\n';
+    }
+    return out.str();
+}
+
+ProcessingStats::PhaseTimer::PhaseTimer(ProcessingStats * stats, Phase phase)
+        : stats(stats), phase(phase) {
+    if (stats == nullptr)
+        return;
+
+    start = Clock::now();
+    outer = currentTimer;
+    if (outer != nullptr)
+        outer->stats->addTime(outer->phase, start - outer->start);
+    currentTimer = this;
+}
+
+ProcessingStats::PhaseTimer::~PhaseTimer() {
+    if (stats == nullptr)
+        return;
+
+    Clock::time_point end = Clock::now();
+    stats->addTime(phase, end - start);
+    currentTimer = outer;
+    if (outer != nullptr)
+        outer->start = end;
+}
@@ -0,0 +1,124 @@
+#ifndef LIBJSONLD_CPP_PROCESSINGSTATS_H
+#define LIBJSONLD_CPP_PROCESSINGSTATS_H
+
+#include <array>
+#include <atomic>
+#include <chrono>
+#include <cstddef>
+#include <cstdint>
+#include <string>
+
+
+/**
+ * Collects the time spent in each phase of processing a document, and counts of the work
+ * done, so that the cost of a call such as JsonLdProcessor::toRDF() can be broken down
+ * without a profiler.
+ *
+ * Stats are set on JsonLdOptions and are shared, not copied, when the options are copied,
+ * so they accumulate over every call made with the options until clear() is called. They
+ * may be updated from several threads at once if the same options are used concurrently.
+ * If no stats are set, nothing is measured.
+ *
+ * Phase times are exclusive: while a phase runs inside another, for instance a remote
+ * context being loaded while a context is processed, its time is only counted in the
+ * inner phase. Times are only measured on the thread making the call. When rdfThreads is
+ * greater than one, triple generation is the elapsed time of the conversion on that
+ * thread, which includes waiting for the worker threads, and not the sum of the time the
+ * workers spent. Work outside of these phases, such as compaction, is not timed.
+ */
+class ProcessingStats {
+public:
+
+    enum class Phase {
+        // loading the input document and remote contexts with the DocumentLoader
+        DocumentLoading,
+        // the Context Processing algorithm, including term definitions
+        ContextProcessing,
+        // the Expansion algorithm
+        Expansion,
+        // the Node Map Generation algorithm
+        NodeMapGeneration,
+        // the Deserialize JSON-LD to RDF algorithm, including passing quads to a QuadSink
+        TripleGeneration,
+        // adding the generated triples to an RDFDataset
+        DatasetInsertion
+    };
+
+    static constexpr std::size_t NUM_PHASES = 6;
+
+    enum class Counter {
+        // remote contexts, including @import contexts, loaded with the DocumentLoader
+        RemoteContextLoads,
+        // results served from a ResultCache, and contexts for compaction served from the
+        // cache of processed contexts
+        CacheHits,
+        // term definitions created by the Create Term Definition algorithm
+        TermsDefined,
+        // node objects output by the Expansion algorithm
+        NodesExpanded,
+        // triples generated by the Deserialize JSON-LD to RDF algorithm
+        TriplesEmitted,
+        // generated triples not added to an RDFDataset because the graph already had them
+        DuplicateTriplesDropped
+    };
+
+    static constexpr std::size_t NUM_COUNTERS = 6;
+
+    // returns a short name for phase, such as "context processing"
+    static const char * phaseName(Phase phase);
+
+    // returns a short name for counter, such as "terms defined"
+    static const char * counterName(Counter counter);
+
+    ProcessingStats();
+    ProcessingStats(const ProcessingStats&) = delete;
+    ProcessingStats& operator=(const ProcessingStats&) = delete;
+
+    // adds n to counter
+    void add(Counter counter, std::size_t n = 1);
+
+    // adds time to the time spent in phase
+    void addTime(Phase phase, std::chrono::nanoseconds time);
+
+    // value of counter
+    std::size_t getCount(Counter counter) const;
+
+    // total time spent in phase
+    std::chrono::nanoseconds getTime(Phase phase) const;
+
+    // total time spent in all phases
+    std::chrono::nanoseconds getTotalTime() const;
+
+    // resets all times and counters to zero
+    void clear();
+
+    // returns the times in milliseconds, and the counters, one per line
+    std::string toString() const;
+
+    /**
+     * Adds the time from its construction to its destruction to a phase of stats. If
+     * stats is null, does nothing. While a PhaseTimer is alive, the PhaseTimer created
+     * before it on the same thread, if any, is paused.
+     */
+    class PhaseTimer {
+    public:
+        PhaseTimer(ProcessingStats * stats, Phase phase);
+        PhaseTimer(const PhaseTimer&) = delete;
+        PhaseTimer& operator=(const PhaseTimer&) = delete;
+        ~PhaseTimer();
+
+    private:
+        typedef std::chrono::steady_clock Clock;
+
+        ProcessingStats * stats;
+        Phase phase;
+        PhaseTimer * outer = nullptr;
+        Clock::time_point start;
+    };
+
+private:
+    std::array<std::atomic<std::int64_t>, NUM_PHASES> times;
+    std::array<std::atomic<std::size_t>, NUM_COUNTERS> counts;
+};
+
+#endif //LIBJSONLD_CPP_PROCESSINGSTATS_H
@@ -0,0 +1,83 @@
+#ifndef LIBJSONLD_CPP_QUADSINK_H
+#define LIBJSONLD_CPP_QUADSINK_H
+
+#include <string>
+
+namespace RDF {
+
+    /**
+     * A QuadTerm is a non-owning view of one term (subject, predicate, object or graph
+     * name) of a quad that is passed to a QuadSink. The referenced strings are only valid
+     * for the duration of the QuadSink::onQuad() call, so a sink that needs to keep a term
+     * must copy it.
+     *
+     * The datatype and language are only meaningful for literals. A literal always has a
+     * datatype; its language is empty unless the datatype is rdf:langString.
+     */
+    class QuadTerm {
+    public:
+        enum class Kind { IRI, BLANK_NODE, LITERAL };
+
+    private:
+        Kind kind;
+        const std::string * value;
+        const std::string * datatype;
+        const std::string * language;
+
+    public:
+        QuadTerm(Kind kind, const std::string & value, const std::string & datatype, const std::string & language)
+                : kind(kind), value(&value), datatype(&datatype), language(&language) {
+        }
+
+        Kind getKind() const {
+            return kind;
+        }
+
+        bool isIRI() const {
+            return kind == Kind::IRI;
+        }
+
+        bool isBlankNode() const {
+            return kind == Kind::BLANK_NODE;
+        }
+
+        bool isLiteral() const {
+            return kind == Kind::LITERAL;
+        }
+
+        const std::string & getValue() const {
+            return *value;
+        }
+
+        const std::string & getDatatype() const {
+            return *datatype;
+        }
+
+        const std::string & getLanguage() const {
+            return *language;
+        }
+    };
+
+    /**
+     * A QuadSink receives the quads generated by JsonLdProcessor::toRDF() one at a time,
+     * without an RDFDataset (or any RDFTriple or Node objects) being built. It can be used
+     * to stream results directly into a store, a serializer or a hash function.
+     *
+     * Quads are passed to the sink in the order they are generated. Unlike RDFGraph::add(),
+     * no duplicate detection is done, so a sink may receive the same quad more than once.
+     */
+    class QuadSink {
+    public:
+        virtual ~QuadSink() = default;
+
+        /**
+         * Called once for each generated quad. graph is nullptr for quads in the
+         * default graph.
+         */
+        virtual void onQuad(const QuadTerm & subject, const QuadTerm & predicate,
+                            const QuadTerm & object, const QuadTerm * graph) = 0;
+    };
+
+}
+
+#endif //LIBJSONLD_CPP_QUADSINK_H
@@ -0,0 +1,420 @@
+#include "jsonld-cpp/RDFBinarySerialization.h"
+
+#include <algorithm>
+#include <array>
+#include <cstring>
+#include <memory>
+#include <unordered_map>
+#include <utility>
+
+#include "jsonld-cpp/BlankNodeNames.h"
+#include "jsonld-cpp/JsonLdConsts.h"
+#include "jsonld-cpp/JsonLdError.h"
+#include "jsonld-cpp/JsonLdOptions.h"
+#include "jsonld-cpp/RDFDataset.h"
+
+namespace {
+
+    using namespace RDF;
+    using RDFBinarySerialization::DatasetView;
+
+    typedef DatasetView::TermId TermId;
+    typedef std::array<TermId, 3> Row;
+
+    const char MAGIC[] = "JLDRDFB1";
+    const std::size_t MAGIC_SIZE = sizeof(MAGIC) - 1;
+    const std::size_t HEADER_SIZE = MAGIC_SIZE + 3 * 4;
+
+    enum TermKind : std::uint8_t {
+        KIND_IRI = 0,
+        KIND_BLANK_NODE = 1,
+        KIND_LITERAL = 2
+    };
+
+    void writeU32(std::string & out, std::uint32_t value) {
+        for (int i = 0; i < 4; i++)
+            out += static_cast<char>((value >> (8 * i)) & 0xff);
+    }
+
+    void writeU64(std::string & out, std::uint64_t value) {
+        for (int i = 0; i < 8; i++)
+            out += static_cast<char>((value >> (8 * i)) & 0xff);
+    }
+
+    void writeVarint(std::string & out, std::uint32_t value) {
+        while (value >= 0x80) {
+            out += static_cast<char>((value & 0x7f) | 0x80);
+            value >>= 7;
+        }
+        out += static_cast<char>(value);
+    }
+
+    void writeString(std::string & out, const std::string & s) {
+        writeU32(out, static_cast<std::uint32_t>(s.size()));
+        out += s;
+    }
+
+    void truncated() {
+        throw JsonLdError(JsonLdError::SyntaxError, "binary RDF data is truncated or corrupt");
+    }
+
+    /**
+     * Reads little-endian integers and strings from a buffer, checking that they are in
+     * bounds.
+     */
+    class Reader {
+    private:
+        const char * data;
+        std::size_t size;
+        std::size_t pos;
+
+    public:
+        Reader(const char * data, std::size_t size, std::size_t pos)
+                : data(data), size(size), pos(pos) {
+        }
+
+        std::size_t position() const {
+            return pos;
+        }
+
+        void need(std::size_t n) const {
+            if (n > size - pos)
+                truncated();
+        }
+
+        void skip(std::size_t n) {
+            need(n);
+            pos += n;
+        }
+
+        std::uint8_t u8() {
+            need(1);
+            return static_cast<std::uint8_t>(data[pos++]);
+        }
+
+        std::uint32_t u32() {
+            need(4);
+            std::uint32_t value = 0;
+            for (int i = 0; i < 4; i++)
+                value |= static_cast<std::uint32_t>(static_cast<std::uint8_t>(data[pos++])) << (8 * i);
+            return value;
+        }
+
+        std::uint64_t u64() {
+            need(8);
+            std::uint64_t value = 0;
+            for (int i = 0; i < 8; i++)
+                value |= static_cast<std::uint64_t>(static_cast<std::uint8_t>(data[pos++])) << (8 * i);
+            return value;
+        }
+
+        std::uint32_t varint() {
+            std::uint32_t value = 0;
+            for (int shift = 0; shift < 35; shift += 7) {
+                std::uint8_t byte = u8();
+                value |= static_cast<std::uint32_t>(byte & 0x7f) << shift;
+                if (!(byte & 0x80))
+                    return value;
+            }
+            truncated();
+            return 0;
+        }
+
+        DatasetView::StringRef string() {
+            std::uint32_t length = u32();
+            need(length);
+            DatasetView::StringRef result{data + pos, length};
+            pos += length;
+            return result;
+        }
+    };
+
+    /**
+     * Assigns a number to each distinct term, in order of first use
+     */
+    class TermTable {
+    private:
+        std::unordered_map<std::string, TermId> ids;
+
+    public:
+        std::string records;
+        std::vector<std::uint64_t> offsets;
+
+        TermId add(const Node & node) {
+            std::string record;
+            if (node.isIRI()) {
+                record += static_cast<char>(KIND_IRI);
+                writeString(record, node.getValue());
+            }
+            else if (node.isBlankNode()) {
+                record += static_cast<char>(KIND_BLANK_NODE);
+                writeString(record, node.getValue());
+            }
+            else {
+                record += static_cast<char>(KIND_LITERAL);
+                writeString(record, node.getValue());
+                writeString(record, node.getDatatype());
+                writeString(record, node.getLanguage());
+            }
+
+            auto result = ids.emplace(record, static_cast<TermId>(offsets.size()));
+            if (result.second) {
+                offsets.push_back(records.size());
+                records += record;
+            }
+            return result.first->second;
+        }
+    };
+
+    std::shared_ptr<Node> toNode(const DatasetView::Term & term) {
+        switch (term.kind) {
+            case QuadTerm::Kind::IRI:
+                return std::make_shared<IRI>(term.value.str());
+            case QuadTerm::Kind::BLANK_NODE:
+                return std::make_shared<BlankNode>(term.value.str());
+            case QuadTerm::Kind::LITERAL:
+            default:
+                std::string datatype = term.datatype.str();
+                std::string language = term.language.str();
+                return std::make_shared<Literal>(term.value.str(), &datatype, &language);
+        }
+    }
+
+}
+
+const RDFBinarySerialization::DatasetView::TermId RDFBinarySerialization::DatasetView::DEFAULT_GRAPH;
+
+std::string RDFBinarySerialization::write(const RDF::RDFDataset & dataset, bool compress) {
+
+    TermTable terms;
+    std::string graphs;
+
+    for (const auto & entry : dataset) {
+        TermId name = DatasetView::DEFAULT_GRAPH;
+        if (entry.first != JsonLdConsts::DEFAULT) {
+            if (BlankNodeNames::hasFormOfBlankNodeName(entry.first))
+                name = terms.add(BlankNode(entry.first));
+            else
+                name = terms.add(IRI(entry.first));
+        }
+
+        std::vector<Row> rows;
+        rows.reserve(entry.second.size());
+        for (const auto & triple : entry.second)
+            rows.push_back({terms.add(*triple.getSubject()), terms.add(*triple.getPredicate()), terms.add(*triple.getObject())});
+
+        std::string triples;
+        if (compress) {
+            // each term number is written as the difference to the same term of the
+            // previous triple if the terms before it are the same, as those differences
+            // are then never negative and usually small
+            std::sort(rows.begin(), rows.end());
+            Row previous = {0, 0, 0};
+            for (const auto & row : rows) {
+                if (row[0] != previous[0]) {
+                    writeVarint(triples, row[0] - previous[0]);
+                    writeVarint(triples, row[1]);
+                    writeVarint(triples, row[2]);
+                }
+                else if (row[1] != previous[1]) {
+                    writeVarint(triples, 0);
+                    writeVarint(triples, row[1] - previous[1]);
+                    writeVarint(triples, row[2]);
+                }
+                else {
+                    writeVarint(triples, 0);
+                    writeVarint(triples, 0);
+                    writeVarint(triples, row[2] - previous[2]);
+                }
+                previous = row;
+            }
+        }
+        else {
+            triples.reserve(rows.size() * 12);
+            for (const auto & row : rows) {
+                writeU32(triples, row[0]);
+                writeU32(triples, row[1]);
+                writeU32(triples, row[2]);
+            }
+        }
+
+        writeU32(graphs, name);
+        writeU32(graphs, static_cast<std::uint32_t>(rows.size()));
+        writeU64(graphs, triples.size());
+        graphs += triples;
+    }
+
+    std::string out;
+    out.reserve(HEADER_SIZE + terms.offsets.size() * 8 + terms.records.size() + graphs.size());
+    out.append(MAGIC, MAGIC_SIZE);
+    writeU32(out, compress ? COMPRESSED : 0);
+    writeU32(out, static_cast<std::uint32_t>(terms.offsets.size()));
+    writeU32(out, static_cast<std::uint32_t>(dataset.numGraphs()));
+    for (auto offset : terms.offsets)
+        writeU64(out, offset);
+    out += terms.records;
+    out += graphs;
+    return out;
+}
+
+RDF::RDFDataset RDFBinarySerialization::read(const std::string & data) {
+    return DatasetView(data.data(), data.size()).toDataset(JsonLdOptions());
+}
+
+RDFBinarySerialization::DatasetView::DatasetView(const char * data, std::size_t size)
+        : data(data), size(size) {
+
+    if (size < HEADER_SIZE || std::memcmp(data, MAGIC, MAGIC_SIZE) != 0)
+        throw JsonLdError(JsonLdError::SyntaxError, "not binary RDF data");
+
+    Reader reader(data, size, MAGIC_SIZE);
+    flags = reader.u32();
+    termCount = reader.u32();
+    std::uint32_t graphCount = reader.u32();
+
+    offsetsAt = reader.position();
+    reader.skip(static_cast<std::size_t>(termCount) * 8);
+
+    // the terms end where the graphs start, which is found from the end of the last term
+    termsAt = reader.position();
+    if (termCount > 0) {
+        Reader offsets(data, size, offsetsAt + (termCount - 1) * static_cast<std::size_t>(8));
+        std::uint64_t lastOffset = offsets.u64();
+        if (lastOffset > size - termsAt)
+            truncated();
+        Reader last(data, size, termsAt + static_cast<std::size_t>(lastOffset));
+        std::uint8_t kind = last.u8();
+        last.string();
+        if (kind == KIND_LITERAL) {
+            last.string();
+            last.string();
+        }
+        reader = last;
+    }
+
+    for (std::uint32_t i = 0; i < graphCount; i++) {
+        Graph graph;
+        graph.name = reader.u32();
+        graph.numTriples = reader.u32();
+        std::uint64_t triplesSize = reader.u64();
+        if (triplesSize > size - reader.position())
+            truncated();
+        graph.triplesAt = reader.position();
+        graph.triplesSize = static_cast<std::size_t>(triplesSize);
+        reader.skip(graph.triplesSize);
+        if (graph.name != DEFAULT_GRAPH && graph.name >= termCount)
+            truncated();
+        graphs.push_back(graph);
+    }
+}
+
+std::size_t RDFBinarySerialization::DatasetView::numTerms() const {
+    return termCount;
+}
+
+RDFBinarySerialization::DatasetView::Term RDFBinarySerialization::DatasetView::getTerm(TermId id) const {
+    if (id >= termCount)
+        truncated();
+
+    Reader offsets(data, size, offsetsAt + static_cast<std::size_t>(id) * 8);
+    std::uint64_t offset = offsets.u64();
+    if (offset > size - termsAt)
+        truncated();
+
+    Reader reader(data, size, termsAt + static_cast<std::size_t>(offset));
+    Term term;
+    std::uint8_t kind = reader.u8();
+    term.value = reader.string();
+    term.datatype = {data, 0};
+    term.language = {data, 0};
+    switch (kind) {
+        case KIND_IRI:
+            term.kind = QuadTerm::Kind::IRI;
+            break;
+        case KIND_BLANK_NODE:
+            term.kind = QuadTerm::Kind::BLANK_NODE;
+            break;
+        case KIND_LITERAL:
+            term.kind = QuadTerm::Kind::LITERAL;
+            term.datatype = reader.string();
+            term.language = reader.string();
+            break;
+        default:
+            truncated();
+    }
+    return term;
+}
+
+std::size_t RDFBinarySerialization::DatasetView::numGraphs() const {
+    return graphs.size();
+}
+
+RDFBinarySerialization::DatasetView::TermId RDFBinarySerialization::DatasetView::getGraphName(std::size_t graph) const {
+    return graphs.at(graph).name;
+}
+
+std::size_t RDFBinarySerialization::DatasetView::numTriples(std::size_t graph) const {
+    return graphs.at(graph).numTriples;
+}
+
+void RDFBinarySerialization::DatasetView::forEachTriple(
+        std::size_t graph, const std::function<void(TermId, TermId, TermId)> & callback) const {
+
+    const Graph & g = graphs.at(graph);
+    Reader reader(data, g.triplesAt + g.triplesSize, g.triplesAt);
+    Row row = {0, 0, 0};
+
+    for (std::uint32_t i = 0; i < g.numTriples; i++) {
+        if (flags & COMPRESSED) {
+            std::uint32_t delta = reader.varint();
+            if (delta != 0) {
+                row[0] += delta;
+                row[1] = reader.varint();
+                row[2] = reader.varint();
+            }
+            else {
+                delta = reader.varint();
+                if (delta != 0) {
+                    row[1] += delta;
+                    row[2] = reader.varint();
+                }
+                else
+                    row[2] += reader.varint();
+            }
+        }
+        else {
+            row[0] = reader.u32();
+            row[1] = reader.u32();
+            row[2] = reader.u32();
+        }
+
+        if (row[0] >= termCount || row[1] >= termCount || row[2] >= termCount)
+            truncated();
+        callback(row[0], row[1], row[2]);
+    }
+}
+
+RDF::RDFDataset RDFBinarySerialization::DatasetView::toDataset(const JsonLdOptions & options) const {
+
+    // each term is turned into a Node once, and shared by all triples using it
+    std::vector<std::shared_ptr<Node>> nodes(termCount);
+    auto node = [&](TermId id) -> const std::shared_ptr<Node> & {
+        if (!nodes[id])
+            nodes[id] = toNode(getTerm(id));
+        return nodes[id];
+    };
+
+    RDF::RDFDataset dataset(options);
+    for (std::size_t i = 0; i < graphs.size(); i++) {
+        std::string graphName = graphs[i].name == DEFAULT_GRAPH ?
+                                JsonLdConsts::DEFAULT :
+                                getTerm(graphs[i].name).value.str();
+
+        RDFGraph & graph = dataset.getOrCreateGraph(graphName);
+        forEachTriple(i, [&](TermId s, TermId p, TermId o) {
+            // the triples of a stored graph are known to be distinct
+            graph.append(RDFTriple(node(s), node(p), node(o)));
+        });
+    }
+    return dataset;
+}
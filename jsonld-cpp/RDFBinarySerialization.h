@@ -0,0 +1,155 @@
+#ifndef LIBJSONLD_CPP_RDFBINARYSERIALIZATION_H
+#define LIBJSONLD_CPP_RDFBINARYSERIALIZATION_H
+
+#include <cstdint>
+#include <functional>
+#include <string>
+#include <vector>
+
+#include "jsonld-cpp/QuadSink.h"
+
+class JsonLdOptions;
+
+namespace RDF {
+    class RDFDataset;
+}
+
+/**
+ * Functions to store an RDFDataset in, and load it from, a compact binary format that is
+ * much faster to read than N-Quads.
+ *
+ * Every distinct term of the dataset is stored once, in a term table, and the triples of
+ * each graph are stored as tuples of term numbers. All integers are little-endian:
+ *
+ *     header   "JLDRDFB1", u32 flags, u32 number of terms, u32 number of graphs
+ *     offsets  u64 offset of each term, from the start of the terms
+ *     terms    u8 kind (0 IRI, 1 blank node, 2 literal), then u32 length and bytes of
+ *              the value and, for literals only, of the datatype and of the language
+ *     graphs   for each graph: u32 term number of its name (0xFFFFFFFF for the default
+ *              graph), u32 number of triples, u64 size in bytes of its triples, then its
+ *              triples
+ *
+ * Triples are three u32 term numbers each. If the COMPRESSED flag is set, the triples of
+ * each graph are instead sorted and written as varints, each term number as the
+ * difference to the previous triple's term at the same position where that is smaller.
+ *
+ * The term table can be read in place: DatasetView gives access to the terms and triples
+ * of a buffer, for example a memory-mapped file, without copying it.
+ */
+namespace RDFBinarySerialization {
+
+    /**
+     * Flag set in the header when the triples are delta and varint encoded
+     */
+    const std::uint32_t COMPRESSED = 1;
+
+    /**
+     * Converts an RDFDataset into the binary format. If compress is true, the triples are
+     * delta and varint encoded, and are stored sorted by term number instead of in the
+     * order they were added to their graph.
+     */
+    std::string write(const RDF::RDFDataset & dataset, bool compress = false);
+
+    /**
+     * Reads an RDFDataset from a string in the binary format.
+     *
+     * @throws JsonLdError
+     *             If data is not in the binary format or is truncated.
+     */
+    RDF::RDFDataset read(const std::string & data);
+
+    /**
+     * A read-only view of a dataset in the binary format. Terms are returned as pointers
+     * into the buffer, which must outlive the view and must not be modified.
+     */
+    class DatasetView {
+    public:
+        typedef std::uint32_t TermId;
+
+        /**
+         * The term number used as name of the default graph
+         */
+        static const TermId DEFAULT_GRAPH = 0xFFFFFFFF;
+
+        /**
+         * A string stored in the buffer. It is not null-terminated.
+         */
+        struct StringRef {
+            const char * data;
+            std::size_t size;
+
+            std::string str() const {
+                return {data, size};
+            }
+        };
+
+        struct Term {
+            RDF::QuadTerm::Kind kind;
+            StringRef value;
+            StringRef datatype;
+            StringRef language;
+        };
+
+    private:
+        struct Graph {
+            TermId name;
+            std::uint32_t numTriples;
+            std::size_t triplesAt;
+            std::size_t triplesSize;
+        };
+
+        const char * data;
+        std::size_t size;
+        std::uint32_t flags;
+        std::uint32_t termCount;
+        std::size_t offsetsAt;
+        std::size_t termsAt;
+        std::vector<Graph> graphs;
+
+    public:
+        /**
+         * Creates a view of the size bytes at data. Only the header and the position of
+         * each graph are read.
+         *
+         * @throws JsonLdError
+         *             If data is not in the binary format or is truncated.
+         */
+        DatasetView(const char * data, std::size_t size);
+
+        std::size_t numTerms() const;
+
+        /**
+         * @throws JsonLdError
+         *             If id is not a term number, or the term is truncated.
+         */
+        Term getTerm(TermId id) const;
+
+        std::size_t numGraphs() const;
+
+        /**
+         * Returns the term number of the name of the graph at index graph, or
+         * DEFAULT_GRAPH for the default graph.
+         */
+        TermId getGraphName(std::size_t graph) const;
+
+        std::size_t numTriples(std::size_t graph) const;
+
+        /**
+         * Calls callback with the subject, predicate and object term numbers of each
+         * triple of the graph at index graph.
+         *
+         * @throws JsonLdError
+         *             If the triples are truncated or refer to terms that don't exist.
+         */
+        void forEachTriple(std::size_t graph,
+                           const std::function<void(TermId, TermId, TermId)> & callback) const;
+
+        /**
+         * Builds an RDFDataset holding all graphs of the view.
+         */
+        RDF::RDFDataset toDataset(const JsonLdOptions & options) const;
+    };
+
+}
+
+#endif //LIBJSONLD_CPP_RDFBINARYSERIALIZATION_H
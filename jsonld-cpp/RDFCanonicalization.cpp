@@ -0,0 +1,701 @@
+#include "jsonld-cpp/RDFCanonicalization.h"
+
+#include <algorithm>
+#include <array>
+#include <map>
+#include <memory>
+#include <unordered_map>
+#include <utility>
+#include <vector>
+
+#include "jsonld-cpp/BlankNodeNames.h"
+#include "jsonld-cpp/JsonLdConsts.h"
+#include "jsonld-cpp/JsonLdError.h"
+#include "jsonld-cpp/JsonLdOptions.h"
+#include "jsonld-cpp/RDFDataset.h"
+#include "jsonld-cpp/RDFQuad.h"
+#include "jsonld-cpp/detail/Sha2.h"
+
+namespace {
+
+    using namespace RDF;
+
+    /**
+     * One term of a quad. Blank nodes are referenced by their index in the canonicalizer,
+     * all other terms are kept already serialized in canonical N-Quads form.
+     */
+    struct CanonicalTerm {
+        bool isBlankNode = false;
+        std::size_t blankNode = 0;
+        std::string text;
+    };
+
+    /**
+     * A quad. A graph that is not a blank node and has empty text is the default graph.
+     */
+    struct CanonicalQuad {
+        CanonicalTerm subject;
+        CanonicalTerm predicate;
+        CanonicalTerm object;
+        CanonicalTerm graph;
+    };
+
+    /**
+     * Escapes a literal value as required by canonical N-Quads: only the characters ",
+     * \, line feed and carriage return are escaped.
+     * See: https://www.w3.org/TR/rdf-canon/#canonical-quads
+     */
+    void appendEscapedLiteral(const std::string &value, std::string &out) {
+        for (char c : value) {
+            switch (c) {
+                case '"':
+                    out += "\\\"";
+                    break;
+                case '\\':
+                    out += "\\\\";
+                    break;
+                case '\n':
+                    out += "\\n";
+                    break;
+                case '\r':
+                    out += "\\r";
+                    break;
+                default:
+                    out += c;
+                    break;
+            }
+        }
+    }
+
+    std::string serializeNonBlankNode(const Node &node) {
+        std::string out;
+        if (node.isIRI()) {
+            out += '<';
+            out += node.getValue();
+            out += '>';
+        }
+        else {
+            out += '"';
+            appendEscapedLiteral(node.getValue(), out);
+            out += '"';
+            std::string datatype = node.getDatatype();
+            if (datatype == JsonLdConsts::RDF_LANGSTRING) {
+                out += '@';
+                out += node.getLanguage();
+            }
+            else if (datatype != JsonLdConsts::XSD_STRING) {
+                out += "^^<";
+                out += datatype;
+                out += '>';
+            }
+        }
+        return out;
+    }
+
+    /**
+     * Issues identifiers for blank nodes, keeping track of the order in which they were issued.
+     * See: https://www.w3.org/TR/rdf-canon/#issue-identifier
+     */
+    class IdentifierIssuer {
+    private:
+        std::string prefix;
+        std::size_t counter = 0;
+        std::unordered_map<std::size_t, std::string> issued;
+        std::vector<std::size_t> issuedOrder;
+
+    public:
+        explicit IdentifierIssuer(std::string prefix)
+                : prefix(std::move(prefix)) {
+        }
+
+        const std::string &issue(std::size_t blankNode) {
+            auto it = issued.find(blankNode);
+            if (it != issued.end())
+                return it->second;
+            issuedOrder.push_back(blankNode);
+            return issued.emplace(blankNode, prefix + std::to_string(counter++)).first->second;
+        }
+
+        const std::string *find(std::size_t blankNode) const {
+            auto it = issued.find(blankNode);
+            return it == issued.end() ? nullptr : &it->second;
+        }
+
+        const std::vector<std::size_t> &getIssuedOrder() const {
+            return issuedOrder;
+        }
+    };
+
+    struct HashNDegreeResult {
+        std::string hash;
+        IdentifierIssuer issuer;
+    };
+
+    class Canonicalizer {
+    private:
+        Sha2::Algorithm algorithm;
+        std::size_t workLimit;
+        std::size_t work = 0;
+
+        std::vector<CanonicalQuad> quads;
+        std::vector<std::string> blankNodeLabels;
+        std::unordered_map<std::string, std::size_t> blankNodeIndexes;
+
+        // canonicalization state, indexed by blank node
+        std::vector<std::vector<std::size_t>> blankNodeToQuads;
+        std::vector<std::string> firstDegreeHashes;
+        IdentifierIssuer canonicalIssuer{"_:c14n"};
+
+        CanonicalTerm makeTerm(const Node &node) {
+            CanonicalTerm term;
+            if (node.isBlankNode()) {
+                term.isBlankNode = true;
+                term.blankNode = blankNodeIndex(node.getValue());
+            }
+            else
+                term.text = serializeNonBlankNode(node);
+            return term;
+        }
+
+        std::size_t blankNodeIndex(const std::string &label) {
+            auto it = blankNodeIndexes.find(label);
+            if (it != blankNodeIndexes.end())
+                return it->second;
+            std::size_t index = blankNodeLabels.size();
+            blankNodeLabels.push_back(label);
+            blankNodeIndexes.emplace(label, index);
+            return index;
+        }
+
+        void countWork() {
+            if (workLimit != 0 && ++work > workLimit)
+                throw JsonLdError(JsonLdError::CanonicalizationWorkLimitExceeded,
+                                  "limit is " + std::to_string(workLimit));
+        }
+
+        template<typename Labeler>
+        static void appendTerm(const CanonicalTerm &term, std::string &out, Labeler label) {
+            if (term.isBlankNode)
+                out += label(term.blankNode);
+            else
+                out += term.text;
+        }
+
+        template<typename Labeler>
+        static void appendQuad(const CanonicalQuad &quad, std::string &out, Labeler label) {
+            appendTerm(quad.subject, out, label);
+            out += ' ';
+            out += quad.predicate.text;
+            out += ' ';
+            appendTerm(quad.object, out, label);
+            if (quad.graph.isBlankNode || !quad.graph.text.empty()) {
+                out += ' ';
+                appendTerm(quad.graph, out, label);
+            }
+            out += " .\n";
+        }
+
+        std::string hashFirstDegreeQuads(std::size_t referenceBlankNode) const {
+
+            // Comments in this function are labeled with numbers that correspond to sections
+            // from the description of the Hash First Degree Quads algorithm.
+            // See: https://www.w3.org/TR/rdf-canon/#hash-1d-quads
+
+            // 1)
+            // Initialize nquads to an empty list. It will be used to store quads in canonical
+            // n-quads form.
+            std::vector<std::string> nquads;
+
+            // 2)
+            // Get the list of quads quads from the map entry for reference blank node
+            // identifier in the blank node to quads map.
+            // 3)
+            // For each quad in quads: serialize quad in canonical n-quads form with the
+            // reference blank node identifier replaced by _:a and any other blank node
+            // identifier replaced by _:z.
+            static const std::string a = "_:a";
+            static const std::string z = "_:z";
+            for (std::size_t q : blankNodeToQuads[referenceBlankNode]) {
+                std::string nquad;
+                appendQuad(quads[q], nquad, [&](std::size_t blankNode) -> const std::string & {
+                    return blankNode == referenceBlankNode ? a : z;
+                });
+                nquads.push_back(std::move(nquad));
+            }
+
+            // 4)
+            // Sort nquads in Unicode code point order.
+            std::sort(nquads.begin(), nquads.end());
+
+            // 5)
+            // Return the hash that results from passing the sorted and concatenated nquads
+            // through the hash algorithm.
+            Sha2 sha(algorithm);
+            for (const auto &nquad : nquads)
+                sha.update(nquad);
+            return sha.hexDigest();
+        }
+
+        std::string hashRelatedBlankNode(std::size_t related, const CanonicalQuad &quad,
+                                         const IdentifierIssuer &issuer, char position) const {
+
+            // Comments in this function are labeled with numbers that correspond to sections
+            // from the description of the Hash Related Blank Node algorithm.
+            // See: https://www.w3.org/TR/rdf-canon/#hash-related-blank-node
+
+            // 1)
+            // Initialize a string input to the value of position.
+            std::string input(1, position);
+
+            // 2)
+            // If position is not g, append <, the value of the predicate in quad, and > to input.
+            if (position != 'g')
+                input += quad.predicate.text;
+
+            // 3)
+            // Append the canonical identifier for related, if issued, otherwise the identifier
+            // issued by issuer, if issued, otherwise the first degree hash of related.
+            if (const std::string *id = canonicalIssuer.find(related))
+                input += *id;
+            else if (const std::string *tempId = issuer.find(related))
+                input += *tempId;
+            else
+                input += firstDegreeHashes[related];
+
+            // 4)
+            // Return the hash that results from passing input through the hash algorithm.
+            return Sha2::hexDigest(algorithm, input);
+        }
+
+        HashNDegreeResult hashNDegreeQuads(std::size_t identifier, IdentifierIssuer issuer) {
+
+            // Comments in this function are labeled with numbers that correspond to sections
+            // from the description of the Hash N-Degree Quads algorithm.
+            // See: https://www.w3.org/TR/rdf-canon/#hash-nd-quads
+
+            countWork();
+
+            // 1)
+            // Create a new map Hn for relating hashes to related blank nodes.
+            std::map<std::string, std::vector<std::size_t>> relatedHashes;
+
+            // 2)
+            // Get a reference, quads, to the list of quads from the map entry for identifier
+            // in the blank node to quads map.
+            // 3)
+            // For each quad in quads, for each component in quad, where component is the
+            // subject, object, or graph name, and it is a blank node that is not identified
+            // by identifier: set hash to the result of the Hash Related Blank Node algorithm
+            // and add a mapping of hash to the blank node identifier for component to Hn.
+            for (std::size_t q : blankNodeToQuads[identifier]) {
+                const CanonicalQuad &quad = quads[q];
+                if (quad.subject.isBlankNode && quad.subject.blankNode != identifier)
+                    relatedHashes[hashRelatedBlankNode(quad.subject.blankNode, quad, issuer, 's')]
+                            .push_back(quad.subject.blankNode);
+                if (quad.object.isBlankNode && quad.object.blankNode != identifier)
+                    relatedHashes[hashRelatedBlankNode(quad.object.blankNode, quad, issuer, 'o')]
+                            .push_back(quad.object.blankNode);
+                if (quad.graph.isBlankNode && quad.graph.blankNode != identifier)
+                    relatedHashes[hashRelatedBlankNode(quad.graph.blankNode, quad, issuer, 'g')]
+                            .push_back(quad.graph.blankNode);
+            }
+
+            // 4)
+            // Create an empty string, data to hash.
+            // Note: the data is passed to the hash function as it is generated.
+            Sha2 dataToHash(algorithm);
+
+            // 5)
+            // For each related hash to blank node list mapping in Hn, code point ordered by
+            // related hash:
+            for (auto &entry : relatedHashes) {
+
+                // 5.1)
+                // Append the related hash to the data to hash.
+                dataToHash.update(entry.first);
+
+                // 5.2)
+                // Create a string chosen path.
+                std::string chosenPath;
+
+                // 5.3)
+                // Create an unset chosen issuer variable.
+                std::unique_ptr<IdentifierIssuer> chosenIssuer;
+
+                // 5.4)
+                // For each permutation p of blank node list:
+                std::vector<std::size_t> &permutation = entry.second;
+                std::sort(permutation.begin(), permutation.end());
+                do {
+                    countWork();
+
+                    // 5.4.1)
+                    // Create a copy of issuer, issuer copy.
+                    IdentifierIssuer issuerCopy = issuer;
+
+                    // 5.4.2)
+                    // Create a string path.
+                    std::string path;
+
+                    // 5.4.3)
+                    // Create a recursion list, to store blank node identifiers that must be
+                    // recursively processed by this algorithm.
+                    std::vector<std::size_t> recursionList;
+
+                    // 5.4.4)
+                    // For each related in p:
+                    bool skip = false;
+                    for (std::size_t related : permutation) {
+                        // 5.4.4.1)
+                        // If a canonical identifier has been issued for related by canonical
+                        // issuer, append the string _:, followed by the canonical identifier
+                        // for related, to path.
+                        if (const std::string *id = canonicalIssuer.find(related))
+                            path += *id;
+                        // 5.4.4.2)
+                        // Otherwise, if issuer copy has not issued an identifier for related,
+                        // append related to recursion list. Use the Issue Identifier algorithm,
+                        // passing issuer copy and related, and append the string _:, followed by
+                        // the result, to path.
+                        else {
+                            if (issuerCopy.find(related) == nullptr)
+                                recursionList.push_back(related);
+                            path += issuerCopy.issue(related);
+                        }
+
+                        // 5.4.4.3)
+                        // If chosen path is not empty and the length of path is greater than or
+                        // equal to the length of chosen path and path is greater than chosen path
+                        // when considering code point order, then skip to the next permutation p.
+                        if (!chosenPath.empty() && path.size() >= chosenPath.size() && path > chosenPath) {
+                            skip = true;
+                            break;
+                        }
+                    }
+                    if (skip)
+                        continue;
+
+                    // 5.4.5)
+                    // For each related in recursion list:
+                    for (std::size_t related : recursionList) {
+                        // 5.4.5.1)
+                        // Set result to the result of recursively executing the Hash N-Degree
+                        // Quads algorithm, passing related for identifier and issuer copy for
+                        // path identifier issuer.
+                        HashNDegreeResult result = hashNDegreeQuads(related, issuerCopy);
+
+                        // 5.4.5.2)
+                        // Use the Issue Identifier algorithm, passing issuer copy and related;
+                        // append the string _:, followed by the result, to path.
+                        path += issuerCopy.issue(related);
+
+                        // 5.4.5.3)
+                        // Append <, the hash in result, and > to path.
+                        path += '<';
+                        path += result.hash;
+                        path += '>';
+
+                        // 5.4.5.4)
+                        // Set issuer copy to the identifier issuer in result.
+                        issuerCopy = std::move(result.issuer);
+
+                        // 5.4.5.5)
+                        // If chosen path is not empty and the length of path is greater than or
+                        // equal to the length of chosen path and path is greater than chosen path
+                        // when considering code point order, then skip to the next p.
+                        if (!chosenPath.empty() && path.size() >= chosenPath.size() && path > chosenPath) {
+                            skip = true;
+                            break;
+                        }
+                    }
+                    if (skip)
+                        continue;
+
+                    // 5.4.6)
+                    // If chosen path is empty or path is less than chosen path when considering
+                    // code point order, set chosen path to path and chosen issuer to issuer copy.
+                    if (chosenPath.empty() || path < chosenPath) {
+                        chosenPath = std::move(path);
+                        chosenIssuer.reset(new IdentifierIssuer(std::move(issuerCopy)));
+                    }
+                } while (std::next_permutation(permutation.begin(), permutation.end()));
+
+                // 5.5)
+                // Append chosen path to data to hash.
+                dataToHash.update(chosenPath);
+
+                // 5.6)
+                // Replace issuer, by reference, with chosen issuer.
+                issuer = std::move(*chosenIssuer);
+            }
+
+            // 6)
+            // Return issuer and the hash that results from passing data to hash through the
+            // hash algorithm.
+            return {dataToHash.hexDigest(), std::move(issuer)};
+        }
+
+    public:
+        Canonicalizer(const RDFDataset &dataset, const JsonLdOptions &options)
+                : algorithm(Sha2::algorithmFromName(options.getHashAlgorithm())),
+                  workLimit(options.getCanonicalizationWorkLimit()) {
+            for (const auto &entry : dataset) {
+                // the graph name term is the same for all quads of a graph
+                CanonicalTerm graph;
+                if (entry.first != JsonLdConsts::DEFAULT) {
+                    if (BlankNodeNames::hasFormOfBlankNodeName(entry.first))
+                        graph = makeTerm(BlankNode(entry.first));
+                    else
+                        graph = makeTerm(IRI(entry.first));
+                }
+
+                for (const auto &triple : entry.second) {
+                    CanonicalQuad q;
+                    q.subject = makeTerm(*triple.getSubject());
+                    // Note: a predicate can only be a blank node in generalized RDF; such blank
+                    // nodes are kept as they are, and not relabeled.
+                    if (triple.getPredicate()->isBlankNode())
+                        q.predicate.text = triple.getPredicate()->getValue();
+                    else
+                        q.predicate.text = serializeNonBlankNode(*triple.getPredicate());
+                    q.object = makeTerm(*triple.getObject());
+                    q.graph = graph;
+                    quads.push_back(std::move(q));
+                }
+            }
+        }
+
+        void canonicalize() {
+
+            // Comments in this function are labeled with numbers that correspond to sections
+            // from the description of the Canonicalization algorithm.
+            // See: https://www.w3.org/TR/rdf-canon/#canon-algorithm
+
+            // 1)
+            // Create the canonicalization state.
+            // 2)
+            // For every quad Q in input dataset, for each blank node that occurs in the
+            // subject, object, or graph name position in Q, add a reference to Q from the map
+            // entry for the blank node identifier in the blank node to quads map.
+            blankNodeToQuads.assign(blankNodeLabels.size(), {});
+            for (std::size_t q = 0; q < quads.size(); q++) {
+                const CanonicalQuad &quad = quads[q];
+                for (const CanonicalTerm *term : {&quad.subject, &quad.object, &quad.graph}) {
+                    if (term->isBlankNode) {
+                        auto &list = blankNodeToQuads[term->blankNode];
+                        if (list.empty() || list.back() != q)
+                            list.push_back(q);
+                    }
+                }
+            }
+
+            // 3)
+            // For each key n in the blank node to quads map: create a hash, hf(n), for n
+            // using the Hash First Degree Quads algorithm and add n to the hash to blank nodes
+            // map entry for hf(n).
+            // Note: the first degree hashes are kept, since they are needed again by the
+            // Hash Related Blank Node algorithm.
+            std::map<std::string, std::vector<std::size_t>> hashToBlankNodes;
+            firstDegreeHashes.resize(blankNodeLabels.size());
+            for (std::size_t n = 0; n < blankNodeLabels.size(); n++) {
+                firstDegreeHashes[n] = hashFirstDegreeQuads(n);
+                hashToBlankNodes[firstDegreeHashes[n]].push_back(n);
+            }
+
+            // 4)
+            // For each hash to identifier list map entry in hash to blank nodes map, code
+            // point ordered by hash: if identifier list has more than one entry, continue to
+            // the next mapping. Otherwise, use the Issue Identifier algorithm, passing
+            // canonical issuer and the single blank node identifier in identifier list, and
+            // remove the map entry for hash from the hash to blank nodes map.
+            for (auto it = hashToBlankNodes.begin(); it != hashToBlankNodes.end();) {
+                if (it->second.size() > 1) {
+                    ++it;
+                    continue;
+                }
+                canonicalIssuer.issue(it->second.front());
+                it = hashToBlankNodes.erase(it);
+            }
+
+            // 5)
+            // For each hash to identifier list map entry in hash to blank nodes map, code
+            // point ordered by hash:
+            for (const auto &entry : hashToBlankNodes) {
+
+                // 5.1)
+                // Create hash path list where each item will be a result of running the
+                // Hash N-Degree Quads algorithm.
+                std::vector<HashNDegreeResult> hashPathList;
+
+                // 5.2)
+                // For each blank node identifier n in identifier list:
+                for (std::size_t n : entry.second) {
+                    // 5.2.1)
+                    // If a canonical identifier has already been issued for n, continue to
+                    // the next blank node identifier.
+                    if (canonicalIssuer.find(n) != nullptr)
+                        continue;
+
+                    // 5.2.2)
+                    // Otherwise, create temporary issuer, an identifier issuer initialized
+                    // with the prefix b.
+                    IdentifierIssuer temporaryIssuer("_:b");
+
+                    // 5.2.3)
+                    // Use the Issue Identifier algorithm, passing temporary issuer and n, to
+                    // issue a new temporary blank node identifier bn to n.
+                    temporaryIssuer.issue(n);
+
+                    // 5.2.4)
+                    // Run the Hash N-Degree Quads algorithm, passing the canonicalization
+                    // state, n for identifier, and temporary issuer, appending the result to
+                    // the hash path list.
+                    hashPathList.push_back(hashNDegreeQuads(n, std::move(temporaryIssuer)));
+                }
+
+                // 5.3)
+                // For each result in the hash path list, code point ordered by the hash in
+                // result: for each blank node identifier, existing identifier, that was issued
+                // a temporary identifier by identifier issuer in result, issue a canonical
+                // identifier, in the same order, using the Issue Identifier algorithm.
+                std::stable_sort(hashPathList.begin(), hashPathList.end(),
+                                 [](const HashNDegreeResult &lhs, const HashNDegreeResult &rhs) {
+                                     return lhs.hash < rhs.hash;
+                                 });
+                for (const auto &result : hashPathList) {
+                    for (std::size_t existing : result.issuer.getIssuedOrder())
+                        canonicalIssuer.issue(existing);
+                }
+            }
+        }
+
+        std::map<std::string, std::string> getCanonicalIdentifiers() const {
+            std::map<std::string, std::string> result;
+            for (std::size_t n = 0; n < blankNodeLabels.size(); n++)
+                result[blankNodeLabels[n]] = *canonicalIssuer.find(n);
+            return result;
+        }
+
+        /**
+         * Calls write with each quad of the normalized dataset, serialized in canonical
+         * n-quads form, in code point order. Quads are sorted by their terms, and only
+         * serialized one at a time as they are written.
+         */
+        template<typename Writer>
+        void writeCanonicalNQuads(Writer write) const {
+
+            // 6)
+            // For each quad, q, in input dataset: create a copy, quad copy, of q and replace
+            // any existing blank node identifier n in quad copy with the canonical identifier
+            // issued for n. Add quad copy to the normalized dataset.
+            // Note: the normalized dataset is only produced as canonical N-Quads. Comparing
+            // the serialized terms one after another gives the code point order of the
+            // serialized quads: no term is a prefix of a different term of the same position
+            // followed by a character lower than the space that separates terms, and a quad
+            // in the default graph, whose graph term is empty, sorts first.
+            static const std::string noGraph;
+            typedef std::array<const std::string *, 4> QuadTerms;
+            auto text = [&](const CanonicalTerm &term) -> const std::string * {
+                return term.isBlankNode ? canonicalIssuer.find(term.blankNode) : &term.text;
+            };
+            std::vector<QuadTerms> sorted;
+            sorted.reserve(quads.size());
+            for (const auto &quad : quads) {
+                bool hasGraph = quad.graph.isBlankNode || !quad.graph.text.empty();
+                sorted.push_back({text(quad.subject), &quad.predicate.text, text(quad.object),
+                                  hasGraph ? text(quad.graph) : &noGraph});
+            }
+            std::sort(sorted.begin(), sorted.end(), [](const QuadTerms &lhs, const QuadTerms &rhs) {
+                for (std::size_t i = 0; i < 4; i++) {
+                    int c = lhs[i]->compare(*rhs[i]);
+                    if (c != 0)
+                        return c < 0;
+                }
+                return false;
+            });
+
+            std::string nquad;
+            for (const auto &terms : sorted) {
+                nquad.clear();
+                nquad += *terms[0];
+                nquad += ' ';
+                nquad += *terms[1];
+                nquad += ' ';
+                nquad += *terms[2];
+                if (!terms[3]->empty()) {
+                    nquad += ' ';
+                    nquad += *terms[3];
+                }
+                nquad += " .\n";
+                write(nquad);
+            }
+        }
+
+        std::string toCanonicalNQuads() const {
+            std::string result;
+            writeCanonicalNQuads([&](const std::string &nquad) {
+                result += nquad;
+            });
+            return result;
+        }
+
+        std::string hash() const {
+            Sha2 sha(algorithm);
+            writeCanonicalNQuads([&](const std::string &nquad) {
+                sha.update(nquad);
+            });
+            return sha.hexDigest();
+        }
+    };
+
+    std::string relabel(const std::string &label, const std::map<std::string, std::string> &identifiers) {
+        auto it = identifiers.find(label);
+        return it == identifiers.end() ? label : it->second;
+    }
+
+    std::shared_ptr<Node> relabel(const std::shared_ptr<Node> &node, const std::map<std::string, std::string> &identifiers) {
+        if (node->isBlankNode())
+            return std::make_shared<BlankNode>(relabel(node->getValue(), identifiers));
+        return node;
+    }
+
+}
+
+std::map<std::string, std::string> RDFCanonicalization::issueCanonicalIdentifiers(const RDF::RDFDataset &dataset, const JsonLdOptions &options) {
+    Canonicalizer canonicalizer(dataset, options);
+    canonicalizer.canonicalize();
+    return canonicalizer.getCanonicalIdentifiers();
+}
+
+RDF::RDFDataset RDFCanonicalization::canonicalize(const RDF::RDFDataset &dataset, const JsonLdOptions &options) {
+    std::map<std::string, std::string> identifiers = issueCanonicalIdentifiers(dataset, options);
+
+    RDF::RDFDataset result(options);
+    for (const auto &entry : dataset) {
+        if (entry.second.empty())
+            continue;
+
+        std::string graphName = BlankNodeNames::hasFormOfBlankNodeName(entry.first) ?
+                                relabel(entry.first, identifiers) :
+                                entry.first;
+        RDFGraph &graph = result.getOrCreateGraph(graphName);
+        for (const auto &triple : entry.second) {
+            graph.add(RDFTriple(relabel(triple.getSubject(), identifiers),
+                                triple.getPredicate(),
+                                relabel(triple.getObject(), identifiers)));
+        }
+    }
+    return result;
+}
+
+std::string RDFCanonicalization::toCanonicalNQuads(const RDF::RDFDataset &dataset, const JsonLdOptions &options) {
+    Canonicalizer canonicalizer(dataset, options);
+    canonicalizer.canonicalize();
+    return canonicalizer.toCanonicalNQuads();
+}
+
+std::string RDFCanonicalization::hash(const RDF::RDFDataset &dataset, const JsonLdOptions &options) {
+    Canonicalizer canonicalizer(dataset, options);
+    canonicalizer.canonicalize();
+    return canonicalizer.hash();
+}
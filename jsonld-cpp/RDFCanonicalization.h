@@ -0,0 +1,59 @@
+#ifndef LIBJSONLD_CPP_RDFCANONICALIZATION_H
+#define LIBJSONLD_CPP_RDFCANONICALIZATION_H
+
+#include <map>
+#include <string>
+
+class JsonLdOptions;
+
+namespace RDF {
+    class RDFDataset;
+}
+
+/**
+ * Functions to canonicalize an RDFDataset using the RDF Dataset Canonicalization
+ * algorithm (RDFC-1.0, formerly known as URDNA2015).
+ *
+ * Canonicalization assigns deterministic labels (_:c14n0, _:c14n1, ...) to the blank
+ * nodes of a dataset, so that isomorphic datasets produce identical canonical N-Quads.
+ *
+ * The hash algorithm is taken from the hashAlgorithm option ("SHA256", the default, or
+ * "SHA384"). Some datasets ("poison graphs") require an exponential amount of work to
+ * canonicalize, so the amount of work done by the Hash N-Degree Quads algorithm is
+ * limited by the canonicalizationWorkLimit option; if the limit is exceeded, a JsonLdError
+ * is thrown.
+ *
+ * See: https://www.w3.org/TR/rdf-canon/
+ */
+namespace RDFCanonicalization {
+
+    /**
+     * Returns a map from each blank node identifier in dataset to its canonical
+     * blank node identifier.
+     */
+    std::map<std::string, std::string> issueCanonicalIdentifiers(const RDF::RDFDataset &dataset, const JsonLdOptions &options);
+
+    /**
+     * Returns a copy of dataset with every blank node relabeled with its canonical
+     * blank node identifier.
+     */
+    RDF::RDFDataset canonicalize(const RDF::RDFDataset &dataset, const JsonLdOptions &options);
+
+    /**
+     * Returns the canonical N-Quads serialization of the canonicalized dataset. This is
+     * the form that is hashed or signed, for example when securing verifiable credentials.
+     */
+    std::string toCanonicalNQuads(const RDF::RDFDataset &dataset, const JsonLdOptions &options);
+
+    /**
+     * Returns the hash of the canonical N-Quads serialization of dataset, as a lowercase
+     * hexadecimal string, using the hash algorithm from the hashAlgorithm option. The
+     * result is the same as hashing the string returned by toCanonicalNQuads(), but the
+     * quads are sorted by reference to their terms and serialized into the hash function
+     * one at a time, so neither that string nor the serialized quads are ever kept.
+     */
+    std::string hash(const RDF::RDFDataset &dataset, const JsonLdOptions &options);
+
+}
+
+#endif //LIBJSONLD_CPP_RDFCANONICALIZATION_H
@@ -1,5 +1,7 @@
 #include "jsonld-cpp/RDFDataset.h"
 
+#include <utility>
+
 #include "jsonld-cpp/RDFTriple.h"
 #include "jsonld-cpp/RDFQuad.h"
 #include "jsonld-cpp/detail/DoubleFormatter.h"
@@ -13,17 +15,42 @@ namespace RDF {
             : options(options) {
     }
 
+    RDFDataset::const_iterator RDFDataset::begin() const noexcept {
+        return storedGraphs.begin();
+    }
+
+    RDFDataset::const_iterator RDFDataset::end() const noexcept {
+        return storedGraphs.end();
+    }
+
     RDFGraph RDFDataset::getGraph(const std::string & graphName) const {
-        if(storedGraphs.count(graphName))
-            return storedGraphs.at(graphName);
+        const RDFGraph * graph = findGraph(graphName);
+        if(graph != nullptr)
+            return *graph;
         else
             return {};
     }
 
+    const RDFGraph * RDFDataset::findGraph(const std::string & graphName) const {
+        auto it = storedGraphs.find(graphName);
+        if(it != storedGraphs.end())
+            return &it->second;
+        else
+            return nullptr;
+    }
+
+    RDFGraph & RDFDataset::getOrCreateGraph(const std::string & graphName) {
+        return storedGraphs[graphName];
+    }
+
     void RDFDataset::setGraph(const RDFGraph & graph, const std::string & graphName) {
         storedGraphs[graphName] = graph;
     }
 
+    void RDFDataset::setGraph(RDFGraph && graph, const std::string & graphName) {
+        storedGraphs[graphName] = std::move(graph);
+    }
+
     void RDFDataset::addTripleToGraph(const std::string & graphName, const RDFTriple& triple) {
             storedGraphs[graphName].add(triple);
     }
@@ -38,6 +65,56 @@ namespace RDF {
         return quads;
     }
 
+    QuadRange RDFDataset::quads() const {
+        return {QuadIterator(storedGraphs.begin(), storedGraphs.end()),
+                QuadIterator(storedGraphs.end(), storedGraphs.end())};
+    }
+
+    RDFQuad QuadRef::toQuad() const {
+        std::string graph = *graphName;
+        return {triple->getSubject(), triple->getPredicate(), triple->getObject(), &graph};
+    }
+
+    QuadIterator::QuadIterator(GraphIterator graph, GraphIterator graphsEnd)
+            : graph(graph), graphsEnd(graphsEnd) {
+        skipEmptyGraphs();
+    }
+
+    void QuadIterator::skipEmptyGraphs() {
+        while(graph != graphsEnd && graph->second.empty())
+            ++graph;
+        if(graph != graphsEnd)
+            triple = graph->second.begin();
+    }
+
+    QuadRef QuadIterator::operator*() const {
+        return {graph->first, *triple};
+    }
+
+    QuadIterator & QuadIterator::operator++() {
+        if(++triple == graph->second.end()) {
+            ++graph;
+            skipEmptyGraphs();
+        }
+        return *this;
+    }
+
+    QuadIterator QuadIterator::operator++(int) {
+        QuadIterator result = *this;
+        ++*this;
+        return result;
+    }
+
+    bool QuadIterator::operator==(const QuadIterator & rhs) const {
+        if(graph != rhs.graph)
+            return false;
+        return graph == graphsEnd || triple == rhs.triple;
+    }
+
+    bool QuadIterator::operator!=(const QuadIterator & rhs) const {
+        return !(*this == rhs);
+    }
+
     std::size_t RDFDataset::numGraphs() const {
         return storedGraphs.size();
     }
@@ -61,10 +138,15 @@ namespace RDF {
         return triples.size();
     }
 
-    void RDFGraph::add(const RDFTriple& triple) {
-        if(std::find(triples.begin(), triples.end(), triple) == triples.end()) {
-            triples.push_back(triple);
-        }
+    bool RDFGraph::add(RDFTriple triple) {
+        if(std::find(triples.begin(), triples.end(), triple) != triples.end())
+            return false;
+        triples.push_back(std::move(triple));
+        return true;
+    }
+
+    void RDFGraph::append(RDFTriple triple) {
+        triples.push_back(std::move(triple));
     }
 
     RDFGraph::iterator RDFGraph::begin() noexcept {
@@ -1,6 +1,8 @@
 #ifndef LIBJSONLD_CPP_RDFDATASET_H
 #define LIBJSONLD_CPP_RDFDATASET_H
 
+#include <cstddef>
+#include <iterator>
 #include <vector>
 #include <map>
 #include <string>
@@ -14,6 +16,7 @@ class JsonLdOptions;
 namespace RDF {
 
     class RDFQuad;
+    class RDFDataset;
 
     class RDFGraph {
     private:
@@ -24,7 +27,17 @@ namespace RDF {
         typedef std::vector<RDFTriple>::const_iterator const_iterator;
         typedef std::vector<RDFTriple>::reference reference;
 
-        void add(const RDFTriple& triple);
+        /**
+         * Add RDFTriple triple, unless the graph already contains it. Returns true if
+         * triple was added.
+         */
+        bool add(RDFTriple triple);
+
+        /**
+         * Add RDFTriple triple without checking if it already exists. Only use this when
+         * the triples added are known to be distinct, for example when loading a stored graph.
+         */
+        void append(RDFTriple triple);
 
         std::string toString() const;
 
@@ -38,6 +51,91 @@ namespace RDF {
         size_type size() const noexcept;
     };
 
+    /**
+     * A quad of an RDFDataset, as visited by RDFDataset::quads(): references to a stored
+     * RDFTriple and to the name of the graph it is stored in. Nothing is copied, so a
+     * QuadRef is only valid as long as the dataset is not modified.
+     */
+    class QuadRef {
+    private:
+        const std::string * graphName;
+        const RDFTriple * triple;
+
+    public:
+        QuadRef(const std::string & graphName, const RDFTriple & triple)
+                : graphName(&graphName), triple(&triple) {
+        }
+
+        /**
+         * Returns the graph name, JsonLdConsts::DEFAULT for the default graph
+         */
+        const std::string & getGraphName() const {
+            return *graphName;
+        }
+
+        const RDFTriple & getTriple() const {
+            return *triple;
+        }
+
+        /**
+         * Returns a new RDFQuad holding the same nodes
+         */
+        RDFQuad toQuad() const;
+    };
+
+    /**
+     * Forward iterator over the quads of an RDFDataset, in order of graph name and then in
+     * the order the triples of each graph were added.
+     */
+    class QuadIterator {
+    private:
+        typedef std::map<std::string, RDFGraph>::const_iterator GraphIterator;
+        GraphIterator graph;
+        GraphIterator graphsEnd;
+        RDFGraph::const_iterator triple;
+
+        void skipEmptyGraphs();
+
+    public:
+        typedef std::forward_iterator_tag iterator_category;
+        typedef QuadRef value_type;
+        typedef std::ptrdiff_t difference_type;
+        typedef const QuadRef * pointer;
+        typedef QuadRef reference;
+
+        QuadIterator(GraphIterator graph, GraphIterator graphsEnd);
+
+        QuadRef operator*() const;
+        QuadIterator & operator++();
+        QuadIterator operator++(int);
+
+        bool operator==(const QuadIterator & rhs) const;
+        bool operator!=(const QuadIterator & rhs) const;
+    };
+
+    /**
+     * The quads of an RDFDataset, as returned by RDFDataset::quads(), for use in a
+     * range-based for loop.
+     */
+    class QuadRange {
+    private:
+        QuadIterator first;
+        QuadIterator last;
+
+    public:
+        QuadRange(QuadIterator first, QuadIterator last)
+                : first(first), last(last) {
+        }
+
+        QuadIterator begin() const {
+            return first;
+        }
+
+        QuadIterator end() const {
+            return last;
+        }
+    };
+
     /**
      * An RDFDataset is a collection of RDFGraphs, and comprises:
      *
@@ -53,19 +151,45 @@ namespace RDF {
         GraphNameToGraph storedGraphs;
 
     public:
+        typedef GraphNameToGraph::const_iterator const_iterator;
+
         explicit RDFDataset(const JsonLdOptions & options);
 
+        /**
+         * Iterate over the stored RDFGraphs, as pairs of graph name and RDFGraph, in order
+         * of graph name. Unlike getGraph(), the graphs are not copied.
+         */
+        const_iterator begin() const noexcept;
+        const_iterator end() const noexcept;
+
         /**
          * Returns a copy of the stored RDFGraph at graphName. If it doesn't exist, an empty
-         * RDFGraph is returned.
+         * RDFGraph is returned. Use findGraph() to access the graph without copying it.
          */
         RDFGraph getGraph(const std::string & graphName) const;
 
+        /**
+         * Returns the stored RDFGraph at graphName, or nullptr if it doesn't exist.
+         */
+        const RDFGraph * findGraph(const std::string & graphName) const;
+
+        /**
+         * Returns the stored RDFGraph at graphName, which is first added as an empty
+         * RDFGraph if it doesn't exist. Triples added to the returned graph are stored
+         * directly in the dataset.
+         */
+        RDFGraph & getOrCreateGraph(const std::string & graphName);
+
         /**
          * Save RDFGraph graph at graphName
          */
         void setGraph(const RDFGraph & graph, const std::string & graphName);
 
+        /**
+         * Save RDFGraph graph at graphName, moving its triples instead of copying them
+         */
+        void setGraph(RDFGraph && graph, const std::string & graphName);
+
         /**
          * Add RDFTriple triple to RDFGraph at graphName if RDFTriple does not already exist
          */
@@ -73,9 +197,18 @@ namespace RDF {
 
         /**
          * Return collection of all stored RDFTriples in the RDFGraphs converted to RDFQuads
+         *
+         * Note: this builds a new RDFQuad, and graph name node, for every stored triple.
+         * Use quads() to visit the quads without building them.
          */
         std::vector<RDFQuad> getAllGraphsAsQuads() const;
 
+        /**
+         * Return the stored RDFTriples of all RDFGraphs as a range of QuadRefs, in order of
+         * graph name. The quads are visited lazily and nothing is copied.
+         */
+        QuadRange quads() const;
+
         /**
          * Return the number of stored RDFGraphs
          */
@@ -0,0 +1,614 @@
+#include "jsonld-cpp/RDFDatasetComparison.h"
+
+#include <algorithm>
+#include <array>
+#include <cstdint>
+#include <functional>
+#include <memory>
+#include <string>
+#include <unordered_map>
+#include <utility>
+#include <vector>
+
+#include "jsonld-cpp/BlankNodeNames.h"
+#include "jsonld-cpp/JsonLdConsts.h"
+
+namespace {
+
+    using namespace RDF;
+
+    const std::size_t NOT_A_BLANK_NODE = static_cast<std::size_t>(-1);
+
+    // Used in place of a blank node's color for its own occurrences in a quad
+    const std::uint64_t SELF = 0x5e1f5e1f5e1f5e1fULL;
+
+    std::uint64_t mix(std::uint64_t x) {
+        // finalizer from splitmix64
+        x ^= x >> 30;
+        x *= 0xbf58476d1ce4e5b9ULL;
+        x ^= x >> 27;
+        x *= 0x94d049bb133111ebULL;
+        x ^= x >> 31;
+        return x;
+    }
+
+    std::uint64_t combine(std::uint64_t seed, std::uint64_t value) {
+        return mix(seed * 0x100000001b3ULL ^ value);
+    }
+
+    void appendLengthPrefixed(std::string & out, const std::string & s) {
+        out += std::to_string(s.size());
+        out += ':';
+        out += s;
+    }
+
+    /**
+     * Returns an unambiguous encoding of a node that is not a blank node. A null node
+     * stands for the default graph.
+     */
+    std::string encodeTerm(const Node * node) {
+        std::string out;
+        if (node == nullptr)
+            out += 'D';
+        else if (node->isIRI()) {
+            out += 'I';
+            appendLengthPrefixed(out, node->getValue());
+        }
+        else {
+            out += 'L';
+            appendLengthPrefixed(out, node->getValue());
+            appendLengthPrefixed(out, node->getDatatype());
+            appendLengthPrefixed(out, node->getLanguage());
+        }
+        return out;
+    }
+
+    struct Term {
+        std::size_t blankNode = NOT_A_BLANK_NODE;
+        std::string text;
+        std::uint64_t hash = 0;
+    };
+
+    typedef std::array<Term, 4> Quad;
+
+    /**
+     * The quads with blank nodes of both datasets. The blank nodes of the first dataset
+     * are numbered from zero and those of the second dataset follow them, so that the
+     * blank nodes of both datasets are refined together and share one set of colors.
+     */
+    struct BlankNodeQuads {
+        std::vector<Quad> quads;
+        std::vector<std::vector<std::size_t>> quadsOfBlankNode;
+        std::size_t quadCount1 = 0;
+        std::size_t blankNodeCount1 = 0;
+
+        /**
+         * Adds the quads of dataset and returns its quads without blank nodes, encoded
+         * and sorted.
+         */
+        std::vector<std::string> add(const RDFDataset & dataset) {
+            std::vector<std::string> groundQuads;
+            std::unordered_map<std::string, std::size_t> blankNodes;
+            std::hash<std::string> hasher;
+
+            for (const auto & entry : dataset) {
+                // the graph name node is built once per graph, and is null for the default graph
+                std::unique_ptr<Node> graphNode;
+                if (entry.first != JsonLdConsts::DEFAULT) {
+                    if (BlankNodeNames::hasFormOfBlankNodeName(entry.first))
+                        graphNode.reset(new BlankNode(entry.first));
+                    else
+                        graphNode.reset(new IRI(entry.first));
+                }
+
+                for (const auto & triple : entry.second) {
+                    const Node * nodes[4] = {triple.getSubject().get(), triple.getPredicate().get(),
+                                             triple.getObject().get(), graphNode.get()};
+                    Quad quad;
+                    bool hasBlankNode = false;
+                    for (std::size_t i = 0; i < 4; i++) {
+                        if (nodes[i] != nullptr && nodes[i]->isBlankNode()) {
+                            auto it = blankNodes.find(nodes[i]->getValue());
+                            if (it == blankNodes.end()) {
+                                it = blankNodes.emplace(nodes[i]->getValue(), quadsOfBlankNode.size()).first;
+                                quadsOfBlankNode.emplace_back();
+                            }
+                            quad[i].blankNode = it->second;
+                            hasBlankNode = true;
+                        }
+                        else {
+                            quad[i].text = encodeTerm(nodes[i]);
+                            quad[i].hash = hasher(quad[i].text);
+                        }
+                    }
+
+                    if (!hasBlankNode) {
+                        groundQuads.push_back(encode(quad, nullptr));
+                        continue;
+                    }
+                    for (const auto & term : quad) {
+                        if (term.blankNode != NOT_A_BLANK_NODE) {
+                            auto & list = quadsOfBlankNode[term.blankNode];
+                            if (list.empty() || list.back() != quads.size())
+                                list.push_back(quads.size());
+                        }
+                    }
+                    quads.push_back(std::move(quad));
+                }
+            }
+
+            std::sort(groundQuads.begin(), groundQuads.end());
+            return groundQuads;
+        }
+
+        std::size_t blankNodeCount() const {
+            return quadsOfBlankNode.size();
+        }
+
+        /**
+         * Returns an unambiguous encoding of quad, with each blank node replaced by its
+         * number, or, if mapping is not null, by the number it maps to.
+         */
+        static std::string encode(const Quad & quad, const std::vector<std::size_t> * mapping) {
+            std::string out;
+            for (const auto & term : quad) {
+                if (term.blankNode == NOT_A_BLANK_NODE)
+                    out += term.text;
+                else {
+                    out += 'B';
+                    out += std::to_string(mapping != nullptr ? (*mapping)[term.blankNode] : term.blankNode);
+                    out += ';';
+                }
+            }
+            return out;
+        }
+    };
+
+    /**
+     * A partition of the blank nodes into color classes. All blank nodes in a class have
+     * the same signature, which summarizes the colors of their neighbours.
+     */
+    struct Coloring {
+        std::vector<std::size_t> colorOf;
+        // position of each blank node in the list of blank nodes of its color
+        std::vector<std::size_t> positionOf;
+        std::vector<std::uint64_t> signature;
+        std::vector<std::uint64_t> colorSignature;
+        // blank nodes of each color in the first and in the second dataset
+        std::vector<std::vector<std::size_t>> members1;
+        std::vector<std::vector<std::size_t>> members2;
+        // number of colors not used by as many blank nodes in both datasets
+        std::size_t unbalancedColors = 0;
+    };
+
+    /**
+     * A change to the coloring, recorded so that it can be undone when the search backtracks
+     */
+    struct Change {
+        enum Kind { NewColor, SetColor, Signature, ColorSignature };
+
+        Kind kind;
+        // the blank node or color that changed
+        std::size_t index;
+        std::size_t oldColor;
+        std::size_t oldPosition;
+        std::uint64_t oldValue;
+    };
+
+    /**
+     * A blank node of the first dataset given a new color, and the candidates of the second
+     * dataset being tried as its image
+     */
+    struct ChoicePoint {
+        std::size_t color;
+        std::size_t blankNode1;
+        std::size_t nextCandidate;
+        std::size_t candidateCount;
+        std::size_t trailSize;
+    };
+
+    class IsomorphismSearch {
+    private:
+        const BlankNodeQuads & bnq;
+        Coloring coloring;
+        std::vector<Change> trail;
+
+        // true for blank nodes that do not appear in a quad with another blank node
+        std::vector<char> isolated;
+
+        // scratch space of refine(), kept between calls. isDirty is all zeros between calls.
+        std::vector<std::size_t> dirty;
+        std::vector<char> isDirty;
+        std::vector<std::size_t> changed;
+        std::vector<std::uint64_t> quadSignatures;
+
+        std::uint64_t computeSignature(std::size_t blankNode) {
+            quadSignatures.clear();
+            for (std::size_t q : bnq.quadsOfBlankNode[blankNode]) {
+                std::uint64_t h = 0;
+                for (const auto & term : bnq.quads[q]) {
+                    std::uint64_t value;
+                    if (term.blankNode == NOT_A_BLANK_NODE)
+                        value = term.hash;
+                    else if (term.blankNode == blankNode)
+                        value = SELF;
+                    else
+                        value = mix(coloring.colorOf[term.blankNode] + 1);
+                    h = combine(h, value);
+                }
+                quadSignatures.push_back(h);
+            }
+            std::sort(quadSignatures.begin(), quadSignatures.end());
+            std::uint64_t signature = quadSignatures.size();
+            for (auto h : quadSignatures)
+                signature = combine(signature, h);
+            return signature;
+        }
+
+        bool isInFirstDataset(std::size_t blankNode) const {
+            return blankNode < bnq.blankNodeCount1;
+        }
+
+        std::vector<std::size_t> & membersOf(std::size_t color, std::size_t blankNode) {
+            return isInFirstDataset(blankNode) ? coloring.members1[color] : coloring.members2[color];
+        }
+
+        bool isBalanced(std::size_t color) const {
+            return coloring.members1[color].size() == coloring.members2[color].size();
+        }
+
+        void updateBalance(std::size_t color, bool wasBalanced) {
+            bool balanced = isBalanced(color);
+            if (wasBalanced && !balanced)
+                coloring.unbalancedColors++;
+            else if (!wasBalanced && balanced)
+                coloring.unbalancedColors--;
+        }
+
+        std::size_t newColor(std::uint64_t signature) {
+            coloring.colorSignature.push_back(signature);
+            coloring.members1.emplace_back();
+            coloring.members2.emplace_back();
+            trail.push_back({Change::NewColor, 0, 0, 0, 0});
+            return coloring.colorSignature.size() - 1;
+        }
+
+        void setSignature(std::size_t blankNode, std::uint64_t signature) {
+            trail.push_back({Change::Signature, blankNode, 0, 0, coloring.signature[blankNode]});
+            coloring.signature[blankNode] = signature;
+        }
+
+        void setColorSignature(std::size_t color, std::uint64_t signature) {
+            trail.push_back({Change::ColorSignature, color, 0, 0, coloring.colorSignature[color]});
+            coloring.colorSignature[color] = signature;
+        }
+
+        // moves blankNode to the end of the members of color. Its place in the members of
+        // its old color is taken by their last blank node.
+        void setColor(std::size_t blankNode, std::size_t color) {
+            std::size_t oldColor = coloring.colorOf[blankNode];
+            std::size_t oldPosition = coloring.positionOf[blankNode];
+            bool oldWasBalanced = isBalanced(oldColor);
+            bool newWasBalanced = isBalanced(color);
+
+            auto & from = membersOf(oldColor, blankNode);
+            std::size_t last = from.back();
+            from[oldPosition] = last;
+            coloring.positionOf[last] = oldPosition;
+            from.pop_back();
+
+            auto & to = membersOf(color, blankNode);
+            coloring.positionOf[blankNode] = to.size();
+            to.push_back(blankNode);
+            coloring.colorOf[blankNode] = color;
+
+            updateBalance(oldColor, oldWasBalanced);
+            updateBalance(color, newWasBalanced);
+            trail.push_back({Change::SetColor, blankNode, oldColor, oldPosition, 0});
+        }
+
+        // the exact reverse of setColor(), so the members of both colors are restored in
+        // their previous order
+        void undoSetColor(std::size_t blankNode, std::size_t oldColor, std::size_t oldPosition) {
+            std::size_t color = coloring.colorOf[blankNode];
+            bool oldWasBalanced = isBalanced(oldColor);
+            bool newWasBalanced = isBalanced(color);
+
+            membersOf(color, blankNode).pop_back();
+
+            auto & from = membersOf(oldColor, blankNode);
+            if (oldPosition == from.size())
+                from.push_back(blankNode);
+            else {
+                std::size_t moved = from[oldPosition];
+                coloring.positionOf[moved] = from.size();
+                from.push_back(moved);
+                from[oldPosition] = blankNode;
+            }
+            coloring.positionOf[blankNode] = oldPosition;
+            coloring.colorOf[blankNode] = oldColor;
+
+            updateBalance(oldColor, oldWasBalanced);
+            updateBalance(color, newWasBalanced);
+        }
+
+        void undo(std::size_t trailSize) {
+            while (trail.size() > trailSize) {
+                const Change & change = trail.back();
+                switch (change.kind) {
+                    case Change::NewColor:
+                        coloring.colorSignature.pop_back();
+                        coloring.members1.pop_back();
+                        coloring.members2.pop_back();
+                        break;
+                    case Change::SetColor:
+                        undoSetColor(change.index, change.oldColor, change.oldPosition);
+                        break;
+                    case Change::Signature:
+                        coloring.signature[change.index] = change.oldValue;
+                        break;
+                    case Change::ColorSignature:
+                        coloring.colorSignature[change.index] = change.oldValue;
+                        break;
+                }
+                trail.pop_back();
+            }
+        }
+
+        void addNeighbours(std::size_t blankNode) {
+            for (std::size_t q : bnq.quadsOfBlankNode[blankNode]) {
+                for (const auto & term : bnq.quads[q]) {
+                    if (term.blankNode != NOT_A_BLANK_NODE && term.blankNode != blankNode && !isDirty[term.blankNode]) {
+                        isDirty[term.blankNode] = 1;
+                        dirty.push_back(term.blankNode);
+                    }
+                }
+            }
+        }
+
+        /**
+         * Refines the coloring until it is stable, starting with the blank nodes in dirty.
+         * Returns false if some color is not used by as many blank nodes in the first dataset
+         * as in the second, in which case the datasets can not be mapped under this coloring.
+         */
+        bool refine() {
+            while (!dirty.empty()) {
+                // recompute the signatures of the blank nodes next to a blank node that
+                // changed color
+                changed.clear();
+                for (std::size_t n : dirty) {
+                    isDirty[n] = 0;
+                    std::uint64_t signature = computeSignature(n);
+                    if (signature != coloring.signature[n]) {
+                        setSignature(n, signature);
+                        changed.push_back(n);
+                    }
+                }
+                dirty.clear();
+
+                // split each color class by the new signatures. Blank nodes whose signature
+                // did not change keep the color. The split only depends on colors and
+                // signatures, so both datasets are split the same way.
+                std::sort(changed.begin(), changed.end(), [&](std::size_t lhs, std::size_t rhs) {
+                    if (coloring.colorOf[lhs] != coloring.colorOf[rhs])
+                        return coloring.colorOf[lhs] < coloring.colorOf[rhs];
+                    return coloring.signature[lhs] < coloring.signature[rhs];
+                });
+                for (std::size_t i = 0; i < changed.size();) {
+                    std::size_t color = coloring.colorOf[changed[i]];
+                    std::size_t end = i;
+                    while (end < changed.size() && coloring.colorOf[changed[end]] == color)
+                        end++;
+                    bool keepColor = coloring.members1[color].size() + coloring.members2[color].size() == end - i;
+
+                    while (i < end) {
+                        std::uint64_t signature = coloring.signature[changed[i]];
+                        std::size_t groupEnd = i;
+                        while (groupEnd < end && coloring.signature[changed[groupEnd]] == signature)
+                            groupEnd++;
+
+                        if (keepColor) {
+                            setColorSignature(color, signature);
+                            keepColor = false;
+                        }
+                        else {
+                            std::size_t group = newColor(signature);
+                            for (std::size_t k = i; k < groupEnd; k++) {
+                                setColor(changed[k], group);
+                                addNeighbours(changed[k]);
+                            }
+                        }
+                        i = groupEnd;
+                    }
+                }
+            }
+
+            return coloring.unbalancedColors == 0;
+        }
+
+        /**
+         * Gives blankNode1 and blankNode2 a color of their own, and refines the coloring
+         */
+        bool individualize(std::size_t blankNode1, std::size_t blankNode2) {
+            std::size_t color = newColor(coloring.colorSignature[coloring.colorOf[blankNode1]]);
+            setColor(blankNode1, color);
+            setColor(blankNode2, color);
+            addNeighbours(blankNode1);
+            addNeighbours(blankNode2);
+            return refine();
+        }
+
+        /**
+         * Returns the first color, starting at from, with more than one blank node of the
+         * first dataset, except for classes of isolated blank nodes, or NOT_A_BLANK_NODE if
+         * there is none. Classes only split as the search goes deeper, so colors before
+         * the one returned never need to be looked at again on the same path.
+         */
+        std::size_t nextColorToIndividualize(std::size_t from) const {
+            for (std::size_t color = from; color < coloring.members1.size(); color++) {
+                const auto & members = coloring.members1[color];
+                if (members.size() > 1 && !isolated[members.front()])
+                    return color;
+            }
+            return NOT_A_BLANK_NODE;
+        }
+
+        /**
+         * Returns true if mapping the i-th blank node of each color of the first dataset to
+         * the i-th blank node of the same color of the second dataset maps the quads of the
+         * first dataset to those of the second. Only classes of isolated blank nodes can
+         * have more than one blank node here. Their blank nodes all have the same quads, up
+         * to the blank node itself, so they can be mapped in any order.
+         */
+        bool isMapping() const {
+            std::vector<std::size_t> mapping(bnq.blankNodeCount1);
+            for (std::size_t color = 0; color < coloring.members1.size(); color++) {
+                const auto & members1 = coloring.members1[color];
+                const auto & members2 = coloring.members2[color];
+                for (std::size_t i = 0; i < members1.size(); i++)
+                    mapping[members1[i]] = members2[i];
+            }
+
+            std::vector<std::string> quads1;
+            std::vector<std::string> quads2;
+            for (std::size_t q = 0; q < bnq.quads.size(); q++) {
+                if (q < bnq.quadCount1)
+                    quads1.push_back(BlankNodeQuads::encode(bnq.quads[q], &mapping));
+                else
+                    quads2.push_back(BlankNodeQuads::encode(bnq.quads[q], nullptr));
+            }
+            std::sort(quads1.begin(), quads1.end());
+            std::sort(quads2.begin(), quads2.end());
+            return quads1 == quads2;
+        }
+
+    public:
+        explicit IsomorphismSearch(const BlankNodeQuads & bnq)
+                : bnq(bnq),
+                  isolated(bnq.blankNodeCount(), 1),
+                  isDirty(bnq.blankNodeCount(), 0) {
+            for (const auto & quad : bnq.quads) {
+                std::size_t blankNodes = 0;
+                for (const auto & term : quad)
+                    blankNodes += term.blankNode != NOT_A_BLANK_NODE;
+                if (blankNodes < 2)
+                    continue;
+                for (const auto & term : quad) {
+                    if (term.blankNode != NOT_A_BLANK_NODE) {
+                        for (const auto & other : quad) {
+                            if (other.blankNode != NOT_A_BLANK_NODE && other.blankNode != term.blankNode)
+                                isolated[term.blankNode] = 0;
+                        }
+                    }
+                }
+            }
+
+            // all blank nodes start with the same color
+            std::size_t count = bnq.blankNodeCount();
+            coloring.colorOf.assign(count, 0);
+            coloring.positionOf.resize(count);
+            coloring.signature.assign(count, 0);
+            coloring.colorSignature.push_back(0);
+            coloring.members1.emplace_back();
+            coloring.members2.emplace_back();
+            for (std::size_t n = 0; n < count; n++) {
+                auto & members = membersOf(0, n);
+                coloring.positionOf[n] = members.size();
+                members.push_back(n);
+            }
+            coloring.unbalancedColors = isBalanced(0) ? 0 : 1;
+        }
+
+        bool refineAll() {
+            for (std::size_t n = 0; n < bnq.blankNodeCount(); n++) {
+                isDirty[n] = 1;
+                dirty.push_back(n);
+            }
+            bool result = refine();
+            // this coloring is never undone
+            trail.clear();
+            return result;
+        }
+
+        /**
+         * Returns true if there is a mapping between the datasets that respects the stable
+         * coloring. While a color class has more than one blank node, a blank node of the
+         * first dataset in that class is given a new color together with each candidate
+         * blank node of the second dataset in turn. The search is depth-first, with an
+         * explicit stack of choice points, and backtracks by undoing the changes recorded
+         * since the choice point instead of copying the coloring at each level. As refining
+         * cannot tell symmetric blank nodes apart, the first candidate is usually right,
+         * and a dataset with n symmetric blank nodes is matched in O(n) steps.
+         */
+        bool search() {
+            std::vector<ChoicePoint> stack;
+            std::size_t from = 0;
+
+            while (true) {
+                std::size_t color = nextColorToIndividualize(from);
+                if (color == NOT_A_BLANK_NODE) {
+                    if (isMapping())
+                        return true;
+                }
+                else {
+                    stack.push_back({color, coloring.members1[color].back(), 0,
+                                     coloring.members2[color].size(), trail.size()});
+                }
+
+                // try the next candidate of the innermost choice point that has one left
+                while (true) {
+                    if (stack.empty())
+                        return false;
+                    ChoicePoint & point = stack.back();
+                    undo(point.trailSize);
+                    if (point.nextCandidate == point.candidateCount) {
+                        stack.pop_back();
+                        continue;
+                    }
+                    std::size_t blankNode2 = coloring.members2[point.color][point.nextCandidate++];
+                    from = point.color;
+                    if (individualize(point.blankNode1, blankNode2))
+                        break;
+                }
+            }
+        }
+    };
+
+}
+
+namespace RDF {
+
+    bool areIsomorphic(const RDFDataset & dataset1, const RDFDataset & dataset2) {
+
+        // compare total number of n-quads
+        if (dataset1.numTriples() != dataset2.numTriples()) {
+            return false;
+        }
+
+        // quads without blank nodes must be equal
+        BlankNodeQuads bnq;
+        std::vector<std::string> groundQuads1 = bnq.add(dataset1);
+        bnq.quadCount1 = bnq.quads.size();
+        bnq.blankNodeCount1 = bnq.blankNodeCount();
+        std::vector<std::string> groundQuads2 = bnq.add(dataset2);
+        if (groundQuads1 != groundQuads2) {
+            return false;
+        }
+
+        // compare number of blank nodes and of quads with blank nodes
+        if (bnq.blankNodeCount() != 2 * bnq.blankNodeCount1 ||
+            bnq.quads.size() != 2 * bnq.quadCount1) {
+            return false;
+        }
+        if (bnq.quads.empty()) {
+            return true;
+        }
+
+        IsomorphismSearch search(bnq);
+        if (!search.refineAll()) {
+            return false;
+        }
+        return search.search();
+    }
+
+}
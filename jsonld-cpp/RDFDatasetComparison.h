@@ -0,0 +1,28 @@
+#ifndef LIBJSONLD_CPP_RDFDATASETCOMPARISON_H
+#define LIBJSONLD_CPP_RDFDATASETCOMPARISON_H
+
+#include "jsonld-cpp/RDFDataset.h"
+
+namespace RDF {
+
+    /**
+     * Returns true if dataset1 and dataset2 are isomorphic, that is, if they are equal
+     * after relabeling their blank nodes with a one-to-one mapping.
+     *
+     * Blank nodes are partitioned by iterated color refinement: each blank node's color is
+     * refined by the colors of the quads it appears in, until no color class splits any
+     * further. Only nodes next to a node that changed color are revisited, so datasets with
+     * long chains of blank nodes (such as RDF lists) are refined in near-linear time. When
+     * refinement leaves classes with more than one blank node, a blank node of each class
+     * is matched with a candidate in the other dataset and refinement resumes. The search
+     * backtracks by undoing the recorded changes, and blank nodes that share no quad with
+     * another blank node are matched by count, so datasets with many symmetric blank nodes
+     * are compared in near-linear time.
+     *
+     * See: https://www.w3.org/TR/rdf11-concepts/#dfn-dataset-isomorphism
+     */
+    bool areIsomorphic(const RDFDataset & dataset1, const RDFDataset & dataset2);
+
+}
+
+#endif //LIBJSONLD_CPP_RDFDATASETCOMPARISON_H
@@ -0,0 +1,213 @@
+#include "jsonld-cpp/RDFDatasetIndex.h"
+
+#include <algorithm>
+#include <array>
+#include <utility>
+
+namespace {
+
+    using namespace RDF;
+
+    typedef RDFDatasetIndex::TermId TermId;
+    typedef std::array<TermId, 3> Row;
+
+    void appendLengthPrefixed(std::string & out, const std::string & s) {
+        out += std::to_string(s.size());
+        out += ':';
+        out += s;
+    }
+
+    /**
+     * Returns an unambiguous encoding of a node, used as its key in the dictionary.
+     */
+    std::string encodeTerm(const Node & node) {
+        std::string out;
+        if (node.isIRI()) {
+            out += 'I';
+            appendLengthPrefixed(out, node.getValue());
+        }
+        else if (node.isBlankNode()) {
+            out += 'B';
+            appendLengthPrefixed(out, node.getValue());
+        }
+        else {
+            out += 'L';
+            appendLengthPrefixed(out, node.getValue());
+            appendLengthPrefixed(out, node.getDatatype());
+            appendLengthPrefixed(out, node.getLanguage());
+        }
+        return out;
+    }
+
+    /**
+     * Narrows [lo, hi) of a sorted column to the rows equal to key
+     */
+    void narrow(const std::vector<TermId> & column, std::size_t & lo, std::size_t & hi, TermId key) {
+        auto range = std::equal_range(column.begin() + lo, column.begin() + hi, key);
+        lo = static_cast<std::size_t>(range.first - column.begin());
+        hi = static_cast<std::size_t>(range.second - column.begin());
+    }
+
+}
+
+namespace RDF {
+
+    RDFDatasetIndex::RDFDatasetIndex(const RDFDataset & dataset) {
+        for (const auto & entry : dataset) {
+            std::vector<Row> rows;
+            rows.reserve(entry.second.size());
+            for (const auto & triple : entry.second)
+                rows.push_back({addTerm(triple.getSubject()), addTerm(triple.getPredicate()), addTerm(triple.getObject())});
+
+            // builds a permutation whose rows are the triples with their terms taken in the
+            // order of positions a, b and c, sorted, and without duplicates
+            auto build = [&rows](std::size_t a, std::size_t b, std::size_t c) {
+                std::vector<Row> permuted;
+                permuted.reserve(rows.size());
+                for (const auto & row : rows)
+                    permuted.push_back({row[a], row[b], row[c]});
+                std::sort(permuted.begin(), permuted.end());
+                permuted.erase(std::unique(permuted.begin(), permuted.end()), permuted.end());
+
+                Permutation permutation;
+                permutation.first.reserve(permuted.size());
+                permutation.second.reserve(permuted.size());
+                permutation.third.reserve(permuted.size());
+                for (const auto & row : permuted) {
+                    permutation.first.push_back(row[0]);
+                    permutation.second.push_back(row[1]);
+                    permutation.third.push_back(row[2]);
+                }
+                return permutation;
+            };
+
+            GraphIndex & graph = graphs[entry.first];
+            graph.spo = build(0, 1, 2);
+            graph.pos = build(1, 2, 0);
+            graph.osp = build(2, 0, 1);
+        }
+    }
+
+    RDFDatasetIndex::TermId RDFDatasetIndex::addTerm(const std::shared_ptr<Node> & node) {
+        auto result = termIds.emplace(encodeTerm(*node), static_cast<TermId>(terms.size()));
+        if (result.second)
+            terms.push_back(node);
+        return result.first->second;
+    }
+
+    bool RDFDatasetIndex::findTerm(const Node * node, TermId & id) const {
+        auto it = termIds.find(encodeTerm(*node));
+        if (it == termIds.end())
+            return false;
+        id = it->second;
+        return true;
+    }
+
+    template<typename Visitor>
+    void RDFDatasetIndex::visit(const Node * subject, const Node * predicate, const Node * object,
+                                const std::string * graphName, Visitor visitor) const {
+
+        // a bound term that is not in the dictionary cannot match anything
+        TermId s = 0, p = 0, o = 0;
+        if ((subject && !findTerm(subject, s)) ||
+            (predicate && !findTerm(predicate, p)) ||
+            (object && !findTerm(object, o)))
+            return;
+
+        auto visitGraph = [&](const std::string & name, const GraphIndex & graph) {
+
+            // pick the permutation that starts with the bound terms, and the positions of
+            // subject, predicate and object in its rows
+            const Permutation * permutation;
+            std::size_t subjectAt, predicateAt, objectAt;
+            std::vector<TermId> keys;
+            if (subject && !predicate && object) {
+                permutation = &graph.osp;
+                objectAt = 0; subjectAt = 1; predicateAt = 2;
+                keys = {o, s};
+            }
+            else if (subject) {
+                permutation = &graph.spo;
+                subjectAt = 0; predicateAt = 1; objectAt = 2;
+                keys = {s};
+                if (predicate) {
+                    keys.push_back(p);
+                    if (object)
+                        keys.push_back(o);
+                }
+            }
+            else if (predicate) {
+                permutation = &graph.pos;
+                predicateAt = 0; objectAt = 1; subjectAt = 2;
+                keys = {p};
+                if (object)
+                    keys.push_back(o);
+            }
+            else if (object) {
+                permutation = &graph.osp;
+                objectAt = 0; subjectAt = 1; predicateAt = 2;
+                keys = {o};
+            }
+            else {
+                permutation = &graph.spo;
+                subjectAt = 0; predicateAt = 1; objectAt = 2;
+            }
+
+            const std::vector<TermId> * columns[3] = {&permutation->first, &permutation->second, &permutation->third};
+            std::size_t lo = 0;
+            std::size_t hi = permutation->first.size();
+            for (std::size_t i = 0; i < keys.size() && lo < hi; i++)
+                narrow(*columns[i], lo, hi, keys[i]);
+
+            if (lo < hi)
+                visitor(name, *columns[subjectAt], *columns[predicateAt], *columns[objectAt], lo, hi);
+        };
+
+        if (graphName) {
+            auto it = graphs.find(*graphName);
+            if (it != graphs.end())
+                visitGraph(it->first, it->second);
+        }
+        else {
+            for (const auto & entry : graphs)
+                visitGraph(entry.first, entry.second);
+        }
+    }
+
+    std::vector<RDFQuad> RDFDatasetIndex::match(const Node * subject, const Node * predicate, const Node * object,
+                                                const std::string * graphName) const {
+        std::vector<RDFQuad> quads;
+        visit(subject, predicate, object, graphName,
+              [this, &quads](const std::string & name, const std::vector<TermId> & subjects,
+                             const std::vector<TermId> & predicates, const std::vector<TermId> & objects,
+                             std::size_t lo, std::size_t hi) {
+                  std::string graph = name;
+                  for (std::size_t row = lo; row < hi; row++)
+                      quads.emplace_back(terms[subjects[row]], terms[predicates[row]], terms[objects[row]], &graph);
+              });
+        return quads;
+    }
+
+    std::size_t RDFDatasetIndex::count(const Node * subject, const Node * predicate, const Node * object,
+                                       const std::string * graphName) const {
+        std::size_t result = 0;
+        visit(subject, predicate, object, graphName,
+              [&result](const std::string &, const std::vector<TermId> &, const std::vector<TermId> &,
+                        const std::vector<TermId> &, std::size_t lo, std::size_t hi) {
+                  result += hi - lo;
+              });
+        return result;
+    }
+
+    std::size_t RDFDatasetIndex::numTerms() const {
+        return terms.size();
+    }
+
+    std::size_t RDFDatasetIndex::numTriples() const {
+        std::size_t result = 0;
+        for (const auto & entry : graphs)
+            result += entry.second.spo.first.size();
+        return result;
+    }
+
+}
@@ -0,0 +1,104 @@
+#ifndef LIBJSONLD_CPP_RDFDATASETINDEX_H
+#define LIBJSONLD_CPP_RDFDATASETINDEX_H
+
+#include <cstdint>
+#include <map>
+#include <memory>
+#include <string>
+#include <unordered_map>
+#include <vector>
+
+#include "jsonld-cpp/RDFDataset.h"
+#include "jsonld-cpp/RDFQuad.h"
+
+namespace RDF {
+
+    /**
+     * An RDFDatasetIndex is a read-only copy of an RDFDataset that can answer triple
+     * pattern queries without scanning every triple.
+     *
+     * All terms of the dataset are stored once, in a dictionary, and triples are stored
+     * as term numbers. Each graph keeps its triples three times, sorted in subject,
+     * predicate, object (SPO), predicate, object, subject (POS) and object, subject,
+     * predicate (OSP) order, with each position of a permutation stored in its own
+     * column. A pattern is answered by binary searches on the permutation that starts
+     * with the bound terms of the pattern.
+     *
+     * The index is built in bulk, for example from the dataset returned by
+     * JsonLdProcessor::toRDF(), and is not updated if the dataset changes afterwards.
+     */
+    class RDFDatasetIndex {
+    public:
+        typedef std::uint32_t TermId;
+
+    private:
+        /**
+         * The triples of a graph sorted in one order. Row i of the permutation is the
+         * triple (first[i], second[i], third[i]).
+         */
+        struct Permutation {
+            std::vector<TermId> first;
+            std::vector<TermId> second;
+            std::vector<TermId> third;
+        };
+
+        struct GraphIndex {
+            Permutation spo;
+            Permutation pos;
+            Permutation osp;
+        };
+
+        std::vector<std::shared_ptr<Node>> terms;
+        std::unordered_map<std::string, TermId> termIds;
+        std::map<std::string, GraphIndex> graphs;
+
+        TermId addTerm(const std::shared_ptr<Node> & node);
+        bool findTerm(const Node * node, TermId & id) const;
+
+        /**
+         * Calls visitor with the subject, predicate and object columns of the permutation
+         * used to answer a pattern, and the range of its rows that match, for each graph
+         * with matches.
+         */
+        template<typename Visitor>
+        void visit(const Node * subject, const Node * predicate, const Node * object,
+                   const std::string * graphName, Visitor visitor) const;
+
+    public:
+        /**
+         * Builds the index of all graphs of dataset.
+         */
+        explicit RDFDatasetIndex(const RDFDataset & dataset);
+
+        /**
+         * Returns the quads that match a pattern. A null subject, predicate or object is a
+         * wildcard that matches any term. If graphName is null, all graphs are searched,
+         * otherwise only the graph with that name, "@default" being the default graph.
+         *
+         * Quads are returned by graph name, then in the order of the permutation used to
+         * answer the pattern.
+         */
+        std::vector<RDFQuad> match(const Node * subject, const Node * predicate, const Node * object,
+                                   const std::string * graphName = nullptr) const;
+
+        /**
+         * Returns the number of quads that match a pattern, without building them. See
+         * match() for the meaning of the arguments.
+         */
+        std::size_t count(const Node * subject, const Node * predicate, const Node * object,
+                          const std::string * graphName = nullptr) const;
+
+        /**
+         * Returns the number of distinct terms in the dictionary.
+         */
+        std::size_t numTerms() const;
+
+        /**
+         * Returns the number of indexed triples in all graphs.
+         */
+        std::size_t numTriples() const;
+    };
+
+}
+
+#endif //LIBJSONLD_CPP_RDFDATASETINDEX_H
@@ -1,6 +1,5 @@
 #include "jsonld-cpp/RDFDocument.h"
 
-#include <iterator>
 #include <sstream>
 #include <utility>
 
@@ -42,13 +41,10 @@ RDFDocument RDFDocument::of(const MediaType& contentType, std::istream &in) {
                           "Failed to create RDFDocument.");
 
     // read data from incoming stream to a tmp string
-    std::vector<std::string> lines;
-    std::string line;
-    while (std::getline(in, line, '\n'))
-        lines.push_back(line);
-    std::sort(lines.begin(), lines.end());
+    // Note: lines are kept in document order. Quads are only ordered when a dataset is
+    // serialized, see QuadOrdering.
     std::stringstream result;
-    std::copy(lines.begin(), lines.end(), std::ostream_iterator<std::string>(result, "\n"));
+    result << in.rdbuf();
     // parse tmp string into an RDFDataset
     RDF::RDFDataset dataset = NQuadsSerialization::parse(result.str());
     return {contentType, dataset};
@@ -0,0 +1,188 @@
+#include "jsonld-cpp/ResultCache.h"
+
+#include <iterator>
+#include <utility>
+
+#include "jsonld-cpp/RDFDataset.h"
+
+using json = nlohmann::ordered_json;
+
+constexpr std::size_t ResultCache::DEFAULT_MAX_BYTES;
+
+namespace {
+
+    // rough per-value overhead of a json value and of an allocated container node
+    const std::size_t NODE_OVERHEAD = 32;
+
+    std::size_t estimateBytes(const json & value) {
+        std::size_t result = sizeof(json);
+        if (value.is_string())
+            result += value.get_ref<const std::string &>().capacity() + NODE_OVERHEAD;
+        else if (value.is_object()) {
+            result += NODE_OVERHEAD;
+            for (const auto & el : value.items())
+                result += el.key().size() + NODE_OVERHEAD + estimateBytes(el.value());
+        }
+        else if (value.is_array()) {
+            result += NODE_OVERHEAD;
+            for (const auto & el : value)
+                result += estimateBytes(el);
+        }
+        return result;
+    }
+
+    std::size_t estimateBytes(const RDF::Node & node) {
+        // a node is a map of its type, value, datatype and language
+        return sizeof(RDF::Node) + 4 * NODE_OVERHEAD + node.getValue().size() +
+               node.getDatatype().size() + node.getLanguage().size();
+    }
+
+    std::size_t estimateBytes(const RDF::RDFDataset & dataset) {
+        std::size_t result = sizeof(RDF::RDFDataset);
+        for (const auto & entry : dataset) {
+            result += entry.first.size() + NODE_OVERHEAD;
+            for (const auto & triple : entry.second)
+                result += sizeof(RDF::RDFTriple) + estimateBytes(*triple.getSubject()) +
+                          estimateBytes(*triple.getPredicate()) + estimateBytes(*triple.getObject());
+        }
+        return result;
+    }
+
+    std::size_t estimateBytes(const std::string & key, const std::vector<std::string> & contextUrls) {
+        std::size_t result = key.size() + 2 * NODE_OVERHEAD;
+        for (const auto & url : contextUrls)
+            result += url.size() + sizeof(std::string);
+        return result;
+    }
+
+}
+
+ResultCache::ResultCache(std::size_t maxBytes)
+        : maxBytes(maxBytes), bytes(0), hits(0), misses(0) {
+}
+
+std::shared_ptr<const json> ResultCache::findExpanded(const std::string &key, std::vector<std::string> * contextUrls) {
+    std::lock_guard<std::mutex> lock(mutex);
+    const Entry * entry = find(key);
+    if (entry == nullptr)
+        return nullptr;
+    if (contextUrls != nullptr)
+        *contextUrls = entry->contextUrls;
+    return entry->expanded;
+}
+
+std::shared_ptr<const RDF::RDFDataset> ResultCache::findDataset(const std::string &key) {
+    std::lock_guard<std::mutex> lock(mutex);
+    const Entry * entry = find(key);
+    return entry == nullptr ? nullptr : entry->dataset;
+}
+
+void ResultCache::addExpanded(const std::string &key, json expanded, std::vector<std::string> contextUrls) {
+    Entry entry;
+    entry.bytes = estimateBytes(expanded) + estimateBytes(key, contextUrls);
+    if (entry.bytes > maxBytes)
+        return;
+    entry.key = key;
+    entry.expanded = std::make_shared<const json>(std::move(expanded));
+    entry.contextUrls = std::move(contextUrls);
+
+    std::lock_guard<std::mutex> lock(mutex);
+    add(std::move(entry));
+}
+
+void ResultCache::addDataset(const std::string &key, const RDF::RDFDataset &dataset,
+                             std::vector<std::string> contextUrls) {
+    Entry entry;
+    entry.bytes = estimateBytes(dataset) + estimateBytes(key, contextUrls);
+    if (entry.bytes > maxBytes)
+        return;
+    entry.key = key;
+
+    // the dataset is stored without its options, which may hold this cache
+    auto stored = std::make_shared<RDF::RDFDataset>(JsonLdOptions());
+    for (const auto & graph : dataset)
+        stored->setGraph(graph.second, graph.first);
+    entry.dataset = std::move(stored);
+    entry.contextUrls = std::move(contextUrls);
+
+    std::lock_guard<std::mutex> lock(mutex);
+    add(std::move(entry));
+}
+
+void ResultCache::invalidate(const std::string &url) {
+    std::lock_guard<std::mutex> lock(mutex);
+    for (auto it = entries.begin(); it != entries.end();) {
+        auto next = std::next(it);
+        for (const auto & contextUrl : it->contextUrls) {
+            if (contextUrl == url) {
+                erase(it);
+                break;
+            }
+        }
+        it = next;
+    }
+}
+
+void ResultCache::clear() {
+    std::lock_guard<std::mutex> lock(mutex);
+    entries.clear();
+    index.clear();
+    bytes = 0;
+    hits = 0;
+    misses = 0;
+}
+
+std::size_t ResultCache::getMaxBytes() const {
+    return maxBytes;
+}
+
+std::size_t ResultCache::getBytes() const {
+    std::lock_guard<std::mutex> lock(mutex);
+    return bytes;
+}
+
+std::size_t ResultCache::size() const {
+    std::lock_guard<std::mutex> lock(mutex);
+    return entries.size();
+}
+
+std::size_t ResultCache::getHits() const {
+    std::lock_guard<std::mutex> lock(mutex);
+    return hits;
+}
+
+std::size_t ResultCache::getMisses() const {
+    std::lock_guard<std::mutex> lock(mutex);
+    return misses;
+}
+
+const ResultCache::Entry * ResultCache::find(const std::string &key) {
+    auto it = index.find(key);
+    if (it == index.end()) {
+        misses++;
+        return nullptr;
+    }
+    hits++;
+    entries.splice(entries.begin(), entries, it->second);
+    return &entries.front();
+}
+
+void ResultCache::add(Entry entry) {
+    // another thread may have added the same result meanwhile
+    auto it = index.find(entry.key);
+    if (it != index.end())
+        erase(it->second);
+
+    while (!entries.empty() && bytes + entry.bytes > maxBytes)
+        erase(std::prev(entries.end()));
+
+    bytes += entry.bytes;
+    entries.push_front(std::move(entry));
+    index.emplace(entries.front().key, entries.begin());
+}
+
+void ResultCache::erase(EntryList::iterator it) {
+    bytes -= it->bytes;
+    index.erase(it->key);
+    entries.erase(it);
+}
@@ -0,0 +1,107 @@
+#ifndef LIBJSONLD_CPP_RESULTCACHE_H
+#define LIBJSONLD_CPP_RESULTCACHE_H
+
+#include <cstddef>
+#include <list>
+#include <memory>
+#include <mutex>
+#include <string>
+#include <unordered_map>
+#include <vector>
+
+#include "jsonld-cpp/jsoninc.h"
+
+namespace RDF {
+    class RDFDataset;
+}
+
+/**
+ * Caches the results of JsonLdProcessor::expand() and JsonLdProcessor::toRDF(), so that
+ * processing a document that is byte-for-byte the same as one processed before returns
+ * a copy of the earlier result instead of expanding the document again.
+ *
+ * A cache is set on JsonLdOptions and is shared, not copied, when the options are copied.
+ * Results are keyed by a SHA-256 hash of the loaded document and of the options that
+ * affect the result. Remote contexts are identified by their URL: the URLs of the
+ * documents loaded while computing a result are kept with it, and if a context changes,
+ * invalidate() drops every result that used it.
+ *
+ * The cache holds at most maxBytes bytes of results, as estimated from their content,
+ * and discards the least recently used results to make room for new ones. A result
+ * larger than maxBytes is not cached. Warnings are only sent to the DiagnosticsSink when
+ * a result is computed, not when it is returned from the cache.
+ *
+ * A cache may be used from several threads at once.
+ */
+class ResultCache {
+public:
+
+    static constexpr std::size_t DEFAULT_MAX_BYTES = 64 * 1024 * 1024;
+
+    explicit ResultCache(std::size_t maxBytes = DEFAULT_MAX_BYTES);
+    ResultCache(const ResultCache&) = delete;
+    ResultCache& operator=(const ResultCache&) = delete;
+
+    // returns the expanded document cached at key, or nullptr. If contextUrls is not
+    // null, it is set to the URLs of the remote documents loaded to expand it.
+    std::shared_ptr<const nlohmann::ordered_json> findExpanded(
+            const std::string &key, std::vector<std::string> * contextUrls = nullptr);
+
+    // returns the dataset cached at key, or nullptr. The dataset has default options.
+    std::shared_ptr<const RDF::RDFDataset> findDataset(const std::string &key);
+
+    // caches expanded at key, which was computed by loading the documents at contextUrls
+    void addExpanded(const std::string &key, nlohmann::ordered_json expanded,
+                     std::vector<std::string> contextUrls);
+
+    // caches dataset at key, which was computed by loading the documents at contextUrls
+    void addDataset(const std::string &key, const RDF::RDFDataset &dataset,
+                    std::vector<std::string> contextUrls);
+
+    // discards the results computed using the remote document at url
+    void invalidate(const std::string &url);
+
+    // discards all results and resets the hit and miss counts
+    void clear();
+
+    std::size_t getMaxBytes() const;
+
+    // estimated number of bytes used by the cached results
+    std::size_t getBytes() const;
+
+    // number of cached results
+    std::size_t size() const;
+
+    // number of find calls that returned a result, and that did not
+    std::size_t getHits() const;
+    std::size_t getMisses() const;
+
+private:
+
+    struct Entry {
+        std::string key;
+        std::shared_ptr<const nlohmann::ordered_json> expanded;
+        std::shared_ptr<const RDF::RDFDataset> dataset;
+        std::vector<std::string> contextUrls;
+        std::size_t bytes;
+    };
+
+    // entries, most recently used first
+    typedef std::list<Entry> EntryList;
+
+    std::size_t maxBytes;
+    std::size_t bytes;
+    std::size_t hits;
+    std::size_t misses;
+    EntryList entries;
+    std::unordered_map<std::string, EntryList::iterator> index;
+    mutable std::mutex mutex;
+
+    // returns the entry at key, moved to the front, or nullptr, and counts a hit or a
+    // miss. Must be called with mutex held, as must add() and erase().
+    const Entry * find(const std::string &key);
+    void add(Entry entry);
+    void erase(EntryList::iterator it);
+};
+
+#endif //LIBJSONLD_CPP_RESULTCACHE_H
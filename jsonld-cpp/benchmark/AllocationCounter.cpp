@@ -0,0 +1,87 @@
+#include "AllocationCounter.h"
+
+#include <atomic>
+#include <cstdlib>
+#include <new>
+
+namespace {
+
+    std::atomic<std::size_t> allocations(0);
+    std::atomic<std::size_t> allocatedBytes(0);
+
+    void * allocate(std::size_t size) {
+        allocations.fetch_add(1, std::memory_order_relaxed);
+        allocatedBytes.fetch_add(size, std::memory_order_relaxed);
+
+        // operator new must return a unique pointer even for a size of 0, and call the
+        // new handler until memory is available or there is no handler
+        if (size == 0)
+            size = 1;
+        for (;;) {
+            void * p = std::malloc(size);
+            if (p != nullptr)
+                return p;
+            std::new_handler handler = std::get_new_handler();
+            if (handler == nullptr)
+                throw std::bad_alloc();
+            handler();
+        }
+    }
+
+    void * allocate(std::size_t size, const std::nothrow_t &) noexcept {
+        try {
+            return allocate(size);
+        }
+        catch (...) {
+            return nullptr;
+        }
+    }
+
+}
+
+AllocationCounter::Counts AllocationCounter::current() {
+    Counts counts;
+    counts.allocations = allocations.load(std::memory_order_relaxed);
+    counts.bytes = allocatedBytes.load(std::memory_order_relaxed);
+    return counts;
+}
+
+void * operator new(std::size_t size) {
+    return allocate(size);
+}
+
+void * operator new[](std::size_t size) {
+    return allocate(size);
+}
+
+void * operator new(std::size_t size, const std::nothrow_t & tag) noexcept {
+    return allocate(size, tag);
+}
+
+void * operator new[](std::size_t size, const std::nothrow_t & tag) noexcept {
+    return allocate(size, tag);
+}
+
+void operator delete(void * p) noexcept {
+    std::free(p);
+}
+
+void operator delete[](void * p) noexcept {
+    std::free(p);
+}
+
+void operator delete(void * p, const std::nothrow_t &) noexcept {
+    std::free(p);
+}
+
+void operator delete[](void * p, const std::nothrow_t &) noexcept {
+    std::free(p);
+}
+
+void operator delete(void * p, std::size_t) noexcept {
+    std::free(p);
+}
+
+void operator delete[](void * p, std::size_t) noexcept {
+    std::free(p);
+}
@@ -0,0 +1,29 @@
+#ifndef LIBJSONLD_CPP_ALLOCATIONCOUNTER_H
+#define LIBJSONLD_CPP_ALLOCATIONCOUNTER_H
+
+#include <cstddef>
+
+/**
+ * Counts the heap allocations made through operator new. Linking AllocationCounter.cpp
+ * replaces the global allocation functions of the program, so the counts include
+ * allocations made by the library and by the standard library containers it uses.
+ */
+namespace AllocationCounter {
+
+    struct Counts {
+        // number of calls of operator new and operator new[]
+        std::size_t allocations;
+
+        // total number of bytes requested by those calls
+        std::size_t bytes;
+    };
+
+    /**
+     * Returns the counts since the program started. The difference of two calls gives
+     * the allocations made in between, by all threads.
+     */
+    Counts current();
+
+}
+
+#endif //LIBJSONLD_CPP_ALLOCATIONCOUNTER_H
@@ -0,0 +1,166 @@
+#include "Benchmark.h"
+
+#include <algorithm>
+#include <chrono>
+#include <cmath>
+#include <ctime>
+#include <iomanip>
+#include <ostream>
+
+using json = nlohmann::ordered_json;
+
+#ifndef JSONLDCPP_VERSION
+#define JSONLDCPP_VERSION "unknown"
+#endif
+
+#ifndef JSONLDCPP_BUILD_TYPE
+#define JSONLDCPP_BUILD_TYPE ""
+#endif
+
+namespace {
+
+    // written by each benchmark iteration so that the work cannot be optimized away
+    volatile std::size_t sink;
+
+    std::string fullName(const std::string & name, std::size_t size) {
+        return name + "/" + std::to_string(size);
+    }
+
+    std::string compilerName() {
+#if defined(__clang__)
+        return "clang " __clang_version__;
+#elif defined(__GNUC__)
+        return "gcc " __VERSION__;
+#elif defined(_MSC_VER)
+        return "msvc " + std::to_string(_MSC_VER);
+#else
+        return "unknown";
+#endif
+    }
+
+    std::string timestamp() {
+        std::time_t now = std::time(nullptr);
+        char buffer[32];
+        std::strftime(buffer, sizeof(buffer), "%Y-%m-%dT%H:%M:%SZ", std::gmtime(&now));
+        return buffer;
+    }
+
+}
+
+double Benchmark::Result::itemsPerSecond() const {
+    return meanNs > 0 ? static_cast<double>(items) * 1e9 / meanNs : 0;
+}
+
+bool Benchmark::matches(const Case & benchmark, const Settings & settings) {
+    return fullName(benchmark.name, benchmark.size).find(settings.filter) != std::string::npos;
+}
+
+Benchmark::Result Benchmark::run(const Case & benchmark, const Settings & settings) {
+    typedef std::chrono::steady_clock Clock;
+
+    if (benchmark.init)
+        benchmark.init();
+
+    // warm up
+    if (benchmark.setup)
+        benchmark.setup();
+    sink = benchmark.run();
+
+    std::vector<double> times;
+    double total = 0;
+    while (times.size() < settings.minIterations || total < settings.minTime * 1e9) {
+        if (benchmark.setup)
+            benchmark.setup();
+        Clock::time_point start = Clock::now();
+        sink = benchmark.run();
+        double ns = static_cast<double>(std::chrono::duration_cast<std::chrono::nanoseconds>(Clock::now() - start).count());
+        times.push_back(ns);
+        total += ns;
+    }
+
+    Result result;
+    result.name = benchmark.name;
+    result.size = benchmark.size;
+    result.items = benchmark.items;
+    result.iterations = times.size();
+    result.meanNs = total / static_cast<double>(times.size());
+
+    double variance = 0;
+    for (double ns : times)
+        variance += (ns - result.meanNs) * (ns - result.meanNs);
+    result.stddevNs = std::sqrt(variance / static_cast<double>(times.size()));
+
+    std::sort(times.begin(), times.end());
+    std::size_t middle = times.size() / 2;
+    result.medianNs = times.size() % 2 ? times[middle] : (times[middle - 1] + times[middle]) / 2;
+    result.minNs = times.front();
+    result.maxNs = times.back();
+    return result;
+}
+
+json Benchmark::buildInfo() {
+    json document;
+    document["library"] = "jsonld-cpp";
+    document["version"] = JSONLDCPP_VERSION;
+    document["build_type"] = JSONLDCPP_BUILD_TYPE;
+    document["compiler"] = compilerName();
+    document["timestamp"] = timestamp();
+    return document;
+}
+
+void Benchmark::writeTable(std::ostream & out, const std::vector<Result> & results) {
+    std::size_t width = 9;
+    for (const auto & result : results)
+        width = std::max(width, fullName(result.name, result.size).size());
+
+    out << std::left << std::setw(static_cast<int>(width)) << "benchmark" << std::right
+        << std::setw(12) << "iterations" << std::setw(14) << "mean (us)" << std::setw(14) << "median (us)"
+        << std::setw(14) << "stddev (us)" << std::setw(16) << "items/s" << '\n';
+
+    out << std::fixed;
+    for (const auto & result : results) {
+        out << std::left << std::setw(static_cast<int>(width)) << fullName(result.name, result.size) << std::right
+            << std::setw(12) << result.iterations
+            << std::setprecision(1)
+            << std::setw(14) << result.meanNs / 1000
+            << std::setw(14) << result.medianNs / 1000
+            << std::setw(14) << result.stddevNs / 1000
+            << std::setprecision(0)
+            << std::setw(16) << result.itemsPerSecond() << '\n';
+    }
+    out << std::defaultfloat;
+}
+
+void Benchmark::writeCsv(std::ostream & out, const std::vector<Result> & results) {
+    out << "name,size,items,iterations,mean_ns,median_ns,min_ns,max_ns,stddev_ns,items_per_second\n";
+    out << std::fixed << std::setprecision(0);
+    for (const auto & result : results) {
+        out << result.name << ',' << result.size << ',' << result.items << ',' << result.iterations << ','
+            << result.meanNs << ',' << result.medianNs << ',' << result.minNs << ',' << result.maxNs << ','
+            << result.stddevNs << ',' << result.itemsPerSecond() << '\n';
+    }
+    out << std::defaultfloat;
+}
+
+void Benchmark::writeJson(std::ostream & out, const std::vector<Result> & results) {
+    json document = buildInfo();
+
+    json benchmarks = json::array();
+    for (const auto & result : results) {
+        json entry;
+        entry["name"] = result.name;
+        entry["size"] = result.size;
+        entry["items"] = result.items;
+        entry["iterations"] = result.iterations;
+        entry["mean_ns"] = result.meanNs;
+        entry["median_ns"] = result.medianNs;
+        entry["min_ns"] = result.minNs;
+        entry["max_ns"] = result.maxNs;
+        entry["stddev_ns"] = result.stddevNs;
+        entry["items_per_second"] = result.itemsPerSecond();
+        benchmarks.push_back(entry);
+    }
+    document["benchmarks"] = benchmarks;
+
+    out << document.dump(2) << '\n';
+}
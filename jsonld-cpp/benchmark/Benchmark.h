@@ -0,0 +1,111 @@
+#ifndef LIBJSONLD_CPP_BENCHMARK_H
+#define LIBJSONLD_CPP_BENCHMARK_H
+
+#include <cstddef>
+#include <functional>
+#include <iosfwd>
+#include <string>
+#include <vector>
+
+#include <jsonld-cpp/jsoninc.h>
+
+/**
+ * A small benchmark harness, so that benchmarks can be built without another dependency.
+ *
+ * A benchmark Case times repeated calls of its run function on an input of a given size. Each
+ * benchmark is first run once to warm up, then repeatedly until both a minimum number of
+ * iterations and a minimum total time are reached. Results are reported as statistics of
+ * the time per iteration, and as the number of items (nodes, quads, terms...) processed
+ * per second.
+ */
+namespace Benchmark {
+
+    /**
+     * A benchmark, which times run() on one input
+     */
+    struct Case {
+        // name of the benchmark, for instance "expand/wide"
+        std::string name;
+
+        // size of the input, as passed to the generator of the input
+        std::size_t size;
+
+        // number of items processed by each call of run
+        std::size_t items;
+
+        // called once before the benchmark is run, to generate its input, but not timed.
+        // May be empty.
+        std::function<void()> init;
+
+        // called before each call of run, but not timed. May be empty.
+        std::function<void()> setup;
+
+        // the code being timed. Should return a value depending on the work done, so
+        // that the compiler cannot optimize the work away.
+        std::function<std::size_t()> run;
+    };
+
+    struct Result {
+        std::string name;
+        std::size_t size;
+        std::size_t items;
+        std::size_t iterations;
+        double meanNs;
+        double medianNs;
+        double minNs;
+        double maxNs;
+        double stddevNs;
+
+        double itemsPerSecond() const;
+    };
+
+    struct Settings {
+        // only benchmarks whose "name/size" contains filter are run
+        std::string filter;
+
+        // run each benchmark for at least this many seconds, and iterations
+        double minTime = 0.5;
+        std::size_t minIterations = 5;
+    };
+
+    /**
+     * Returns the benchmarks of the library, with the sizes of their inputs multiplied by
+     * scale.
+     */
+    std::vector<Case> allBenchmarks(double scale);
+
+    /**
+     * Returns true if benchmark is selected by settings
+     */
+    bool matches(const Case & benchmark, const Settings & settings);
+
+    /**
+     * Times benchmark according to settings
+     */
+    Result run(const Case & benchmark, const Settings & settings);
+
+    /**
+     * Returns a JSON object describing the build being measured: the library version,
+     * build type and compiler, and when the results were taken.
+     */
+    nlohmann::ordered_json buildInfo();
+
+    /**
+     * Writes results as an aligned table, one result per line
+     */
+    void writeTable(std::ostream & out, const std::vector<Result> & results);
+
+    /**
+     * Writes results as comma-separated values, with a header line
+     */
+    void writeCsv(std::ostream & out, const std::vector<Result> & results);
+
+    /**
+     * Writes results as a JSON object that also describes the build that was measured,
+     * so results of different releases can be compared.
+     */
+    void writeJson(std::ostream & out, const std::vector<Result> & results);
+
+}
+
+#endif //LIBJSONLD_CPP_BENCHMARK_H
@@ -0,0 +1,351 @@
+#include "Benchmark.h"
+#include "DocumentGenerators.h"
+
+#include <algorithm>
+#include <initializer_list>
+#include <memory>
+#include <vector>
+
+#include <jsonld-cpp/BlankNodeNames.h>
+#include <jsonld-cpp/FileLoader.h>
+#include <jsonld-cpp/JsonLdError.h>
+#include <jsonld-cpp/JsonLdOptions.h>
+#include <jsonld-cpp/JsonLdUrl.h>
+#include <jsonld-cpp/NQuadsSerialization.h>
+#include <jsonld-cpp/RDFCanonicalization.h>
+#include <jsonld-cpp/RDFDataset.h>
+#include <jsonld-cpp/RDFQuad.h>
+#include <jsonld-cpp/detail/Context.h>
+#include <jsonld-cpp/detail/ContextProcessor.h>
+#include <jsonld-cpp/detail/DoubleFormatter.h>
+#include <jsonld-cpp/detail/ExpansionProcessor.h>
+#include <jsonld-cpp/detail/RDFDeserializationProcessor.h>
+#include <jsonld-cpp/detail/RDFSerializationProcessor.h>
+#include <jsonld-cpp/detail/Sha2.h>
+
+using json = nlohmann::ordered_json;
+
+namespace {
+
+    using Benchmark::Case;
+
+    const std::string BASE = "http://example.com/base/doc.jsonld";
+
+    // the sizes multiplied by scale, without the duplicates that small scales can give
+    std::vector<std::size_t> scaled(std::initializer_list<std::size_t> sizes, double scale) {
+        std::vector<std::size_t> result;
+        for (std::size_t size : sizes) {
+            std::size_t s = std::max<std::size_t>(1, static_cast<std::size_t>(static_cast<double>(size) * scale));
+            if (std::find(result.begin(), result.end(), s) == result.end())
+                result.push_back(s);
+        }
+        return result;
+    }
+
+    // options as JsonLdProcessor would use them. The generated documents have no remote
+    // contexts, so nothing is loaded.
+    JsonLdOptions makeOptions() {
+        JsonLdOptions options(std::unique_ptr<DocumentLoader>(new FileLoader()));
+        options.setBase(BASE);
+        return options;
+    }
+
+    json expand(const json & document) {
+        Context activeContext(makeOptions());
+        activeContext.setBaseIri(BASE);
+        activeContext.setOriginalBaseUrl(BASE);
+        return ExpansionProcessor::expand(activeContext, nullptr, document, BASE);
+    }
+
+    typedef json (*Generator)(std::size_t);
+
+    Case expandBenchmark(const std::string & name, Generator generator, std::size_t size) {
+        auto document = std::make_shared<json>();
+        Case benchmark;
+        benchmark.name = "expand/" + name;
+        benchmark.size = size;
+        benchmark.items = size;
+        benchmark.init = [=]() { *document = generator(size); };
+        benchmark.run = [=]() { return expand(*document).size(); };
+        return benchmark;
+    }
+
+    Case toRdfBenchmark(const std::string & name, Generator generator, std::size_t size, std::size_t threads) {
+        auto expanded = std::make_shared<json>();
+        auto input = std::make_shared<json>();
+        auto options = std::make_shared<JsonLdOptions>(makeOptions());
+        options->setRdfThreads(threads);
+
+        Case benchmark;
+        benchmark.name = "toRDF/" + name + (threads > 1 ? "/threads" + std::to_string(threads) : "");
+        benchmark.size = size;
+        benchmark.items = size;
+        benchmark.init = [=]() { *expanded = expand(generator(size)); };
+        // toRDF() consumes its input, so a copy is made before each run
+        benchmark.setup = [=]() { *input = *expanded; };
+        benchmark.run = [=]() { return RDFSerializationProcessor::toRDF(std::move(*input), *options).numTriples(); };
+        return benchmark;
+    }
+
+    Case fromRdfBenchmark(const std::string & name, Generator generator, std::size_t size) {
+        auto dataset = std::make_shared<RDF::RDFDataset>(makeOptions());
+        auto options = std::make_shared<JsonLdOptions>(makeOptions());
+
+        Case benchmark;
+        benchmark.name = "fromRDF/" + name;
+        benchmark.size = size;
+        benchmark.items = size;
+        // the generated quads are appended, as RDFGraph::add() looks for a duplicate of each
+        benchmark.init = [=]() {
+            RDFSerializationProcessor::toRDF(expand(generator(size)), *options, [=](const RDF::RDFQuad & quad) {
+                std::string graphName = quad.getGraph() ? quad.getGraph()->getValue() : JsonLdConsts::DEFAULT;
+                dataset->getOrCreateGraph(graphName).append(
+                        RDF::RDFTriple(quad.getSubject(), quad.getPredicate(), quad.getObject()));
+            });
+        };
+        benchmark.run = [=]() { return RDFDeserializationProcessor::fromRDF(*dataset, *options).size(); };
+        return benchmark;
+    }
+
+    Case contextBenchmark(std::size_t size) {
+        auto localContext = std::make_shared<json>();
+        auto activeContext = std::make_shared<Context>(makeOptions());
+
+        Case benchmark;
+        benchmark.name = "context/process";
+        benchmark.size = size;
+        benchmark.items = size;
+        benchmark.init = [=]() { *localContext = DocumentGenerators::contextHeavy(size)["@context"]; };
+        benchmark.run = [=]() {
+            Context result = ContextProcessor::process(*activeContext, *localContext, BASE);
+            return result.lookupTermDefinition("term0").size();
+        };
+        return benchmark;
+    }
+
+    Case parseNQuadsBenchmark(std::size_t size) {
+        auto input = std::make_shared<std::string>();
+
+        Case benchmark;
+        benchmark.name = "nquads/parse";
+        benchmark.size = size;
+        benchmark.items = size;
+        benchmark.init = [=]() { *input = DocumentGenerators::nquads(size); };
+        benchmark.run = [=]() { return NQuadsSerialization::parse(*input).numTriples(); };
+        return benchmark;
+    }
+
+    Case toNQuadsBenchmark(std::size_t size, QuadOrdering ordering) {
+        auto dataset = std::make_shared<RDF::RDFDataset>(makeOptions());
+        auto options = std::make_shared<JsonLdOptions>(makeOptions());
+        options->setQuadOrdering(ordering);
+
+        Case benchmark;
+        benchmark.name = std::string("nquads/toNQuads/") + (ordering == QuadOrdering::Sorted ? "sorted" : "insertion");
+        benchmark.size = size;
+        benchmark.items = size;
+        benchmark.init = [=]() {
+            RDF::RDFDataset parsed = NQuadsSerialization::parse(DocumentGenerators::nquads(size));
+            for (const auto & graph : parsed)
+                dataset->setGraph(graph.second, graph.first);
+        };
+        benchmark.run = [=]() { return NQuadsSerialization::toNQuads(*dataset, *options).size(); };
+        return benchmark;
+    }
+
+    typedef std::string (*NQuadsGenerator)(std::size_t);
+
+    Case canonicalizeBenchmark(const std::string & name, NQuadsGenerator generator, std::size_t size, bool hash) {
+        auto dataset = std::make_shared<RDF::RDFDataset>(makeOptions());
+        auto options = std::make_shared<JsonLdOptions>(makeOptions());
+
+        Case benchmark;
+        benchmark.name = std::string(hash ? "canonicalize/hash/" : "canonicalize/nquads/") + name;
+        benchmark.size = size;
+        benchmark.items = size;
+        benchmark.init = [=]() {
+            RDF::RDFDataset parsed = NQuadsSerialization::parse(generator(size));
+            for (const auto & graph : parsed)
+                dataset->setGraph(graph.second, graph.first);
+        };
+        benchmark.run = [=]() {
+            if (hash)
+                return RDFCanonicalization::hash(*dataset, *options).size();
+            return RDFCanonicalization::toCanonicalNQuads(*dataset, *options).size();
+        };
+        return benchmark;
+    }
+
+    // Canonicalizes a clique of blank nodes until the work limit of size is exceeded, to
+    // measure how quickly a poison graph is rejected
+    Case canonicalizePoisonBenchmark(std::size_t size) {
+        auto dataset = std::make_shared<RDF::RDFDataset>(makeOptions());
+        auto options = std::make_shared<JsonLdOptions>(makeOptions());
+        options->setCanonicalizationWorkLimit(size);
+
+        Case benchmark;
+        benchmark.name = "canonicalize/poison";
+        benchmark.size = size;
+        benchmark.items = size;
+        benchmark.init = [=]() {
+            RDF::RDFDataset parsed = NQuadsSerialization::parse(DocumentGenerators::blankNodeClique(10));
+            for (const auto & graph : parsed)
+                dataset->setGraph(graph.second, graph.first);
+        };
+        benchmark.run = [=]() {
+            try {
+                return RDFCanonicalization::toCanonicalNQuads(*dataset, *options).size();
+            }
+            catch (JsonLdError &) {
+                return size;
+            }
+        };
+        return benchmark;
+    }
+
+    // hashes size kilobytes
+    Case sha2Benchmark(std::size_t size, Sha2::Algorithm algorithm, Sha2::Implementation implementation) {
+        auto data = std::make_shared<std::string>();
+
+        Case benchmark;
+        benchmark.name = std::string("sha2/") + (algorithm == Sha2::Algorithm::SHA256 ? "sha256" : "sha384") +
+                         (implementation == Sha2::Implementation::ShaExtensions ? "/shaExtensions" : "/portable");
+        benchmark.size = size;
+        benchmark.items = size * 1024;
+        benchmark.init = [=]() {
+            for (std::size_t i = 0; i < size * 1024; i++)
+                data->push_back(static_cast<char>(i * 31 + 7));
+        };
+        benchmark.run = [=]() {
+            Sha2 sha(algorithm, implementation);
+            sha.update(*data);
+            return sha.hexDigest().size();
+        };
+        return benchmark;
+    }
+
+    Case doubleFormatterBenchmark(std::size_t size) {
+        auto values = std::make_shared<std::vector<double>>();
+
+        Case benchmark;
+        benchmark.name = "doubleFormatter/format";
+        benchmark.size = size;
+        benchmark.items = size;
+        benchmark.init = [=]() {
+            for (std::size_t i = 0; i < size; i++)
+                values->push_back(static_cast<double>(i) * 1234.5678 / 7.0 - 1000.0);
+        };
+        benchmark.run = [=]() {
+            std::size_t result = 0;
+            for (double value : *values)
+                result += DoubleFormatter::format(value).size();
+            return result;
+        };
+        return benchmark;
+    }
+
+    Case blankNodeNamesBenchmark(std::size_t size) {
+        auto identifiers = std::make_shared<std::vector<std::string>>();
+
+        Case benchmark;
+        benchmark.name = "blankNodeNames/get";
+        benchmark.size = size;
+        benchmark.items = size;
+        benchmark.init = [=]() {
+            for (std::size_t i = 0; i < size; i++)
+                identifiers->push_back("_:node" + std::to_string(i));
+        };
+        // each identifier is relabeled, then looked up again, and as many new names are made
+        benchmark.run = [=]() {
+            BlankNodeNames names;
+            std::size_t result = 0;
+            for (const auto & identifier : *identifiers)
+                result += names.get(identifier).size();
+            for (const auto & identifier : *identifiers)
+                result += names.get(identifier).size();
+            for (std::size_t i = 0; i < size; i++)
+                result += names.get().size();
+            return result;
+        };
+        return benchmark;
+    }
+
+    Case uriResolveBenchmark(std::size_t size) {
+        auto references = std::make_shared<std::vector<std::string>>();
+
+        Case benchmark;
+        benchmark.name = "uri/resolve";
+        benchmark.size = size;
+        benchmark.items = size;
+        benchmark.init = [=]() {
+            const char * patterns[] = {"item", "../up/item", "./same/item?x=", "#fragment", "/absolute/item",
+                                       "//other.example.com/item", "http://example.org/item"};
+            for (std::size_t i = 0; i < size; i++)
+                references->push_back(patterns[i % 7] + std::to_string(i));
+        };
+        benchmark.run = [=]() {
+            std::size_t result = 0;
+            for (const auto & reference : *references)
+                result += JsonLdUrl::resolve(&BASE, &reference).size();
+            return result;
+        };
+        return benchmark;
+    }
+
+}
+
+std::vector<Benchmark::Case> Benchmark::allBenchmarks(double scale) {
+    std::vector<Case> benchmarks;
+
+    for (std::size_t size : scaled({1000, 10000, 100000}, scale)) {
+        benchmarks.push_back(parseNQuadsBenchmark(size));
+        benchmarks.push_back(toNQuadsBenchmark(size, QuadOrdering::Insertion));
+        benchmarks.push_back(toNQuadsBenchmark(size, QuadOrdering::Sorted));
+    }
+
+    for (std::size_t size : scaled({100, 1000, 10000}, scale)) {
+        benchmarks.push_back(expandBenchmark("wide", DocumentGenerators::wide, size));
+        benchmarks.push_back(expandBenchmark("lists", DocumentGenerators::listHeavy, size));
+    }
+    for (std::size_t size : scaled({10, 100, 500}, scale))
+        benchmarks.push_back(expandBenchmark("deep", DocumentGenerators::deep, size));
+    for (std::size_t size : scaled({10, 100, 1000}, scale)) {
+        benchmarks.push_back(expandBenchmark("contexts", DocumentGenerators::contextHeavy, size));
+        benchmarks.push_back(contextBenchmark(size));
+    }
+
+    for (std::size_t size : scaled({100, 1000, 10000}, scale)) {
+        benchmarks.push_back(toRdfBenchmark("wide", DocumentGenerators::wide, size, 1));
+        benchmarks.push_back(toRdfBenchmark("lists", DocumentGenerators::listHeavy, size, 1));
+    }
+    benchmarks.push_back(toRdfBenchmark("wide", DocumentGenerators::wide, scaled({10000}, scale).front(), 4));
+
+    for (std::size_t size : scaled({100, 1000, 10000}, scale)) {
+        benchmarks.push_back(fromRdfBenchmark("wide", DocumentGenerators::wide, size));
+        benchmarks.push_back(fromRdfBenchmark("lists", DocumentGenerators::listHeavy, size));
+    }
+
+    for (std::size_t size : scaled({1000, 10000, 100000}, scale)) {
+        benchmarks.push_back(canonicalizeBenchmark("mixed", DocumentGenerators::nquads, size, false));
+        benchmarks.push_back(canonicalizeBenchmark("mixed", DocumentGenerators::nquads, size, true));
+    }
+    for (std::size_t size : scaled({100, 1000, 10000}, scale))
+        benchmarks.push_back(canonicalizeBenchmark("cycles", DocumentGenerators::blankNodeCycles, size, false));
+    for (std::size_t size : scaled({1000, 10000, 100000}, scale))
+        benchmarks.push_back(canonicalizePoisonBenchmark(size));
+
+    for (std::size_t size : scaled({1, 1000}, scale)) {
+        benchmarks.push_back(sha2Benchmark(size, Sha2::Algorithm::SHA256, Sha2::Implementation::Portable));
+        if (Sha2::isSupported(Sha2::Algorithm::SHA256, Sha2::Implementation::ShaExtensions))
+            benchmarks.push_back(sha2Benchmark(size, Sha2::Algorithm::SHA256, Sha2::Implementation::ShaExtensions));
+        benchmarks.push_back(sha2Benchmark(size, Sha2::Algorithm::SHA384, Sha2::Implementation::Portable));
+    }
+
+    for (std::size_t size : scaled({1000, 100000}, scale)) {
+        benchmarks.push_back(doubleFormatterBenchmark(size));
+        benchmarks.push_back(blankNodeNamesBenchmark(size));
+        benchmarks.push_back(uriResolveBenchmark(size));
+    }
+
+    return benchmarks;
+}
@@ -0,0 +1,164 @@
+#include "DocumentGenerators.h"
+
+using json = nlohmann::ordered_json;
+
+namespace {
+
+    const char EX[] = "http://example.com/";
+
+    std::string nodeId(std::size_t i) {
+        return std::string(EX) + "node/" + std::to_string(i);
+    }
+
+    json personContext() {
+        return json::parse(R"({
+            "@vocab": "http://schema.org/",
+            "ex": "http://example.com/vocab#",
+            "xsd": "http://www.w3.org/2001/XMLSchema#",
+            "knows": {"@id": "http://schema.org/knows", "@type": "@id"},
+            "homepage": {"@id": "http://schema.org/url", "@type": "@id"},
+            "age": {"@id": "http://schema.org/age", "@type": "xsd:integer"},
+            "tags": {"@id": "ex:tag", "@container": "@set"},
+            "list": {"@id": "ex:list", "@container": "@list"},
+            "refs": {"@id": "ex:refs", "@container": "@list", "@type": "@id"},
+            "child": {"@id": "ex:child"}
+        })");
+    }
+
+}
+
+json DocumentGenerators::wide(std::size_t size) {
+    json graph = json::array();
+    for (std::size_t i = 0; i < size; i++) {
+        json node;
+        node["@id"] = nodeId(i);
+        node["@type"] = "Person";
+        node["name"] = "Person " + std::to_string(i);
+        node["description"] = {{"@value", "Description of person " + std::to_string(i)}, {"@language", "en"}};
+        node["age"] = std::to_string(20 + i % 60);
+        node["score"] = static_cast<double>(i) / 7.0;
+        node["homepage"] = std::string(EX) + "people/" + std::to_string(i);
+        node["knows"] = json::array({nodeId((i + 1) % size), nodeId((i * 7 + 3) % size)});
+        node["tags"] = json::array({"tag" + std::to_string(i % 10), "tag" + std::to_string(i % 3)});
+        graph.push_back(node);
+    }
+    return {{"@context", personContext()}, {"@graph", graph}};
+}
+
+json DocumentGenerators::deep(std::size_t size) {
+    json inner = {{"@id", nodeId(size)}, {"name", "Leaf"}};
+    for (std::size_t i = size; i > 0; i--) {
+        json node;
+        node["@id"] = nodeId(i - 1);
+        node["name"] = "Level " + std::to_string(i - 1);
+        node["child"] = std::move(inner);
+        inner = std::move(node);
+    }
+    inner["@context"] = personContext();
+    return inner;
+}
+
+json DocumentGenerators::listHeavy(std::size_t size) {
+    json graph = json::array();
+    for (std::size_t i = 0; i < size; i++) {
+        json values = json::array();
+        for (std::size_t j = 0; j < 8; j++)
+            values.push_back(j % 2 ? json(static_cast<int>(i + j)) : json("item " + std::to_string(j)));
+        json node;
+        node["@id"] = nodeId(i);
+        node["list"] = values;
+        node["refs"] = json::array({nodeId((i + 1) % size), nodeId((i + 2) % size)});
+        graph.push_back(node);
+    }
+    return {{"@context", personContext()}, {"@graph", graph}};
+}
+
+json DocumentGenerators::contextHeavy(std::size_t size) {
+    json context = json::object();
+    context["@version"] = 1.1;
+    context["ex"] = std::string(EX) + "vocab#";
+    context["xsd"] = "http://www.w3.org/2001/XMLSchema#";
+
+    json node;
+    node["@id"] = nodeId(0);
+    for (std::size_t i = 0; i < size; i++) {
+        std::string term = "term" + std::to_string(i);
+        switch (i % 5) {
+            case 0:
+                // a simple term
+                context[term] = "ex:" + term;
+                node[term] = "value " + std::to_string(i);
+                break;
+            case 1:
+                // an IRI-valued term
+                context[term] = {{"@id", "ex:" + term}, {"@type", "@id"}};
+                node[term] = nodeId(i);
+                break;
+            case 2:
+                // a typed term
+                context[term] = {{"@id", "ex:" + term}, {"@type", "xsd:integer"}};
+                node[term] = std::to_string(i);
+                break;
+            case 3:
+                // a language map
+                context[term] = {{"@id", "ex:" + term}, {"@container", "@language"}};
+                node[term] = {{"en", "value " + std::to_string(i)}, {"fr", "valeur " + std::to_string(i)}};
+                break;
+            default:
+                // a term with a scoped context
+                context[term] = {{"@id", "ex:" + term},
+                                 {"@context", {{"inner", "ex:inner" + std::to_string(i)}}}};
+                node[term] = {{"inner", "value " + std::to_string(i)}};
+                break;
+        }
+    }
+    node["@context"] = context;
+    return node;
+}
+
+std::string DocumentGenerators::nquads(std::size_t size) {
+    std::string result;
+    for (std::size_t i = 0; i < size; i++) {
+        std::string subject = i % 10 == 9 ? "_:b" + std::to_string(i / 10) : "<" + nodeId(i / 4) + ">";
+        std::string graph = i % 3 == 0 ? "" : " <" + std::string(EX) + "graph/" + std::to_string(i % 3) + ">";
+        std::string object;
+        switch (i % 4) {
+            case 0:
+                object = "<" + nodeId(i + 1) + ">";
+                break;
+            case 1:
+                object = "\"value " + std::to_string(i) + "\"";
+                break;
+            case 2:
+                object = "\"" + std::to_string(i) + "\"^^<http://www.w3.org/2001/XMLSchema#integer>";
+                break;
+            default:
+                object = "\"valeur " + std::to_string(i) + "\"@fr";
+                break;
+        }
+        result += subject + " <" + EX + "vocab#p" + std::to_string(i % 16) + "> " + object + graph + " .\n";
+    }
+    return result;
+}
+
+std::string DocumentGenerators::blankNodeCycles(std::size_t size) {
+    std::string result;
+    for (std::size_t i = 0; i < size; i++) {
+        std::size_t next = i - i % 3 + (i + 1) % 3;
+        if (next >= size)
+            next = i - i % 3;
+        result += "_:b" + std::to_string(i) + " <" + EX + "vocab#next> _:b" + std::to_string(next) + " .\n";
+    }
+    return result;
+}
+
+std::string DocumentGenerators::blankNodeClique(std::size_t size) {
+    std::string result;
+    for (std::size_t i = 0; i < size; i++) {
+        for (std::size_t j = 0; j < size; j++) {
+            if (i != j)
+                result += "_:n" + std::to_string(i) + " <" + EX + "vocab#p> _:n" + std::to_string(j) + " .\n";
+        }
+    }
+    return result;
+}
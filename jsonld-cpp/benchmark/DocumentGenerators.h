@@ -0,0 +1,62 @@
+#ifndef LIBJSONLD_CPP_DOCUMENTGENERATORS_H
+#define LIBJSONLD_CPP_DOCUMENTGENERATORS_H
+
+#include <cstddef>
+#include <string>
+
+#include <jsonld-cpp/jsoninc.h>
+
+/**
+ * Functions generating synthetic inputs for the benchmarks. Each input grows linearly
+ * with size, and the same size always gives the same input, so results can be compared
+ * across runs and releases.
+ */
+namespace DocumentGenerators {
+
+    /**
+     * A document with a small context and a top-level @graph of size nodes, each having a
+     * few properties of different kinds: IRIs, strings, language-tagged strings, numbers
+     * and references to other nodes.
+     */
+    nlohmann::ordered_json wide(std::size_t size);
+
+    /**
+     * A document with size nested node objects, each being the value of a property of
+     * the one before.
+     */
+    nlohmann::ordered_json deep(std::size_t size);
+
+    /**
+     * A document with size nodes each having a list of values and a list of references,
+     * so that converting it to RDF generates many rdf:first/rdf:rest blank nodes.
+     */
+    nlohmann::ordered_json listHeavy(std::size_t size);
+
+    /**
+     * A document whose context defines size terms, with type coercions, containers,
+     * prefixes and scoped contexts, and a node using each of the terms.
+     */
+    nlohmann::ordered_json contextHeavy(std::size_t size);
+
+    /**
+     * An N-Quads document of size quads, in a few named graphs, with IRIs, blank nodes,
+     * plain, typed and language-tagged literals.
+     */
+    std::string nquads(std::size_t size);
+
+    /**
+     * An N-Quads document of size blank nodes linked in cycles of three. All the blank
+     * nodes have the same first degree hash, so canonicalizing it runs the Hash N-Degree
+     * Quads algorithm for each of them.
+     */
+    std::string blankNodeCycles(std::size_t size);
+
+    /**
+     * An N-Quads document of size blank nodes each linked to all the others: a "poison
+     * graph" whose canonicalization takes time factorial in size.
+     */
+    std::string blankNodeClique(std::size_t size);
+
+}
+
+#endif //LIBJSONLD_CPP_DOCUMENTGENERATORS_H
@@ -0,0 +1,351 @@
+#include "ManifestBenchmark.h"
+#include "AllocationCounter.h"
+#include "Benchmark.h"
+
+#include <algorithm>
+#include <chrono>
+#include <cmath>
+#include <iomanip>
+#include <map>
+#include <memory>
+#include <ostream>
+#include <utility>
+
+#include <jsonld-cpp/DocumentLoader.h>
+#include <jsonld-cpp/JSONDocument.h>
+#include <jsonld-cpp/JsonLdError.h>
+#include <jsonld-cpp/JsonLdProcessor.h>
+#include <jsonld-cpp/RDFCanonicalization.h>
+#include <jsonld-cpp/RDFDataset.h>
+#include <jsonld-cpp/RDFDocument.h>
+
+#include "ManifestLoader.h"
+#include "TestCase.h"
+#include "UrdnaManifestLoader.h"
+
+using json = nlohmann::ordered_json;
+
+namespace {
+
+    using ManifestBenchmark::Result;
+
+    // written by each run so that the work cannot be optimized away
+    volatile std::size_t sink;
+
+    /**
+     * Loads each document once with another loader, then returns copies of it from
+     * memory. Copies of the loader share the documents.
+     */
+    class MemoryCachingLoader : public DocumentLoader {
+    public:
+        explicit MemoryCachingLoader(std::unique_ptr<DocumentLoader> loader)
+                : loader(std::move(loader)),
+                  documents(std::make_shared<std::map<std::string, JSONDocument>>()),
+                  datasets(std::make_shared<std::map<std::string, RDFDocument>>()) {
+        }
+
+        MemoryCachingLoader(const MemoryCachingLoader & other)
+                : DocumentLoader(other),
+                  loader(other.loader->clone()),
+                  documents(other.documents),
+                  datasets(other.datasets) {
+        }
+
+        MemoryCachingLoader & operator=(const MemoryCachingLoader & other) = delete;
+
+        MemoryCachingLoader * clone() const override {
+            return new MemoryCachingLoader(*this);
+        }
+
+        std::unique_ptr<RemoteDocument> loadDocument(const std::string & url) override {
+            auto it = documents->find(url);
+            if (it != documents->end())
+                return std::unique_ptr<RemoteDocument>(new JSONDocument(it->second));
+            auto datasetIt = datasets->find(url);
+            if (datasetIt != datasets->end())
+                return std::unique_ptr<RemoteDocument>(new RDFDocument(datasetIt->second));
+
+            std::unique_ptr<RemoteDocument> document = loader->loadDocument(url);
+            if (auto * jsonDocument = dynamic_cast<JSONDocument *>(document.get()))
+                documents->insert({url, *jsonDocument});
+            else if (auto * rdfDocument = dynamic_cast<RDFDocument *>(document.get()))
+                datasets->insert({url, *rdfDocument});
+            return document;
+        }
+
+    private:
+        std::unique_ptr<DocumentLoader> loader;
+        std::shared_ptr<std::map<std::string, JSONDocument>> documents;
+        std::shared_ptr<std::map<std::string, RDFDocument>> datasets;
+    };
+
+    std::size_t perform(const std::string & algorithm, const std::string & input, JsonLdOptions & options) {
+        if (algorithm == "rdfc10") {
+            std::unique_ptr<RemoteDocument> document = options.getDocumentLoader()->loadDocument(input);
+            return RDFCanonicalization::toCanonicalNQuads(document->getRDFContent(), options).size();
+        }
+        if (algorithm == "toRdf")
+            return JsonLdProcessor::toRDF(input, options).numTriples();
+        if (algorithm == "fromRdf")
+            return JsonLdProcessor::fromRDF(input, options).size();
+        return JsonLdProcessor::expand(input, options).size();
+    }
+
+    bool isNegative(const TestCase & testCase) {
+        return testCase.type.count("jld:NegativeEvaluationTest") > 0 ||
+               testCase.type.count("rdfc:RDFC10NegativeEvalTest") > 0;
+    }
+
+    // the rdf-canon manifests have no error codes: their negative tests are poison graphs
+    std::string expectedError(const TestCase & testCase) {
+        if (testCase.type.count("rdfc:RDFC10NegativeEvalTest") > 0)
+            return JsonLdError::CanonicalizationWorkLimitExceeded;
+        return testCase.expectErrorCode;
+    }
+
+    std::map<std::string, TestCase> loadManifest(const std::string & testDataDir, const std::string & algorithm) {
+        std::string manifest = ManifestBenchmark::manifestName(algorithm);
+        if (algorithm == "rdfc10")
+            return UrdnaManifestLoader(testDataDir, manifest).load();
+        return ManifestLoader(testDataDir, manifest).load();
+    }
+
+    // runs testCase once, untimed, to load its documents and to find its status
+    void check(const std::string & algorithm, const TestCase & testCase, JsonLdOptions options, Result & result) {
+        bool negative = isNegative(testCase);
+        try {
+            sink = perform(algorithm, testCase.input, options);
+            if (negative) {
+                result.status = "failed";
+                result.error = "should have failed with " + expectedError(testCase);
+            }
+            else
+                result.status = "ok";
+        }
+        catch (JsonLdError & e) {
+            std::string error = e.what();
+            if (negative && error.find(expectedError(testCase)) != std::string::npos)
+                result.status = "expected error";
+            else {
+                result.status = "failed";
+                result.error = error;
+            }
+        }
+        catch (std::exception & e) {
+            result.status = "failed";
+            result.error = e.what();
+        }
+    }
+
+    // nearest-rank percentile of sorted values
+    double percentile(const std::vector<double> & sorted, double p) {
+        auto rank = static_cast<std::size_t>(std::ceil(p / 100 * static_cast<double>(sorted.size())));
+        return sorted[rank == 0 ? 0 : rank - 1];
+    }
+
+    bool isTimed(const Result & result) {
+        return result.iterations > 0;
+    }
+
+    // Flags the tests whose median time is above the upper outer fence (Q3 + 3 * IQR) of
+    // the median times of their manifest.
+    void flagOutliers(std::vector<Result> & results) {
+        std::vector<double> medians;
+        for (const auto & result : results)
+            if (isTimed(result))
+                medians.push_back(result.p50Ns);
+        if (medians.size() < 4)
+            return;
+
+        std::sort(medians.begin(), medians.end());
+        double q1 = percentile(medians, 25);
+        double q3 = percentile(medians, 75);
+        double fence = q3 + 3 * (q3 - q1);
+        for (auto & result : results)
+            result.outlier = isTimed(result) && result.p50Ns > fence;
+    }
+
+    std::string fullName(const Result & result) {
+        return result.manifest + result.id;
+    }
+
+}
+
+std::string ManifestBenchmark::manifestName(const std::string & algorithm) {
+    if (algorithm == "expand")
+        return "expand-manifest.jsonld";
+    if (algorithm == "toRdf")
+        return "toRdf-manifest.jsonld";
+    if (algorithm == "fromRdf")
+        return "fromRdf-manifest.jsonld";
+    if (algorithm == "rdfc10")
+        return "rdfc10-manifest.jsonld";
+    return "";
+}
+
+std::vector<Result> ManifestBenchmark::run(const std::string & testDataDir, const std::string & algorithm,
+                                           const Settings & settings) {
+    typedef std::chrono::steady_clock Clock;
+
+    std::string manifest = manifestName(algorithm);
+    std::map<std::string, TestCase> testCases = loadManifest(testDataDir, algorithm);
+
+    std::vector<Result> results;
+    for (auto & entry : testCases) {
+        TestCase & testCase = entry.second;
+        if (testCase.id.find(settings.filter) == std::string::npos &&
+            testCase.name.find(settings.filter) == std::string::npos)
+            continue;
+
+        Result result;
+        result.manifest = manifest;
+        result.id = testCase.id;
+        result.name = testCase.name;
+
+        // as in the unit tests, json-ld-1.0 only tests are not supported
+        if (testCase.options.specVersion == "json-ld-1.0") {
+            result.status = "skipped";
+            results.push_back(result);
+            continue;
+        }
+
+        JsonLdOptions options = testCase.getOptions();
+        options.setDocumentLoader(std::unique_ptr<DocumentLoader>(
+                new MemoryCachingLoader(std::unique_ptr<DocumentLoader>(options.getDocumentLoader()->clone()))));
+
+        check(algorithm, testCase, options, result);
+        if (result.status == "failed") {
+            results.push_back(result);
+            continue;
+        }
+
+        std::vector<double> times;
+        std::size_t allocations = 0;
+        std::size_t allocatedBytes = 0;
+        for (std::size_t i = 0; i < settings.repetitions; i++) {
+            JsonLdOptions runOptions = options;
+
+            AllocationCounter::Counts before = AllocationCounter::current();
+            Clock::time_point start = Clock::now();
+            try {
+                sink = perform(algorithm, testCase.input, runOptions);
+            }
+            catch (JsonLdError &) {
+                // the expected error of a negative test
+            }
+            Clock::time_point end = Clock::now();
+            AllocationCounter::Counts after = AllocationCounter::current();
+
+            times.push_back(static_cast<double>(std::chrono::duration_cast<std::chrono::nanoseconds>(end - start).count()));
+            allocations += after.allocations - before.allocations;
+            allocatedBytes += after.bytes - before.bytes;
+        }
+
+        if (!times.empty()) {
+            std::sort(times.begin(), times.end());
+            result.iterations = times.size();
+            result.p50Ns = percentile(times, 50);
+            result.p90Ns = percentile(times, 90);
+            result.p99Ns = percentile(times, 99);
+            result.maxNs = times.back();
+            result.allocations = allocations / times.size();
+            result.allocatedBytes = allocatedBytes / times.size();
+        }
+        results.push_back(result);
+    }
+
+    flagOutliers(results);
+    return results;
+}
+
+void ManifestBenchmark::writeTable(std::ostream & out, const std::vector<Result> & results) {
+    std::size_t width = 4;
+    for (const auto & result : results)
+        width = std::max(width, fullName(result).size());
+
+    out << std::left << std::setw(static_cast<int>(width)) << "test" << std::right
+        << std::setw(16) << "status" << std::setw(12) << "iterations"
+        << std::setw(12) << "p50 (us)" << std::setw(12) << "p90 (us)" << std::setw(12) << "p99 (us)"
+        << std::setw(12) << "max (us)" << std::setw(14) << "allocations" << std::setw(14) << "bytes"
+        << '\n';
+
+    out << std::fixed << std::setprecision(1);
+    for (const auto & result : results) {
+        out << std::left << std::setw(static_cast<int>(width)) << fullName(result) << std::right
+            << std::setw(16) << result.status;
+        if (isTimed(result)) {
+            out << std::setw(12) << result.iterations
+                << std::setw(12) << result.p50Ns / 1000
+                << std::setw(12) << result.p90Ns / 1000
+                << std::setw(12) << result.p99Ns / 1000
+                << std::setw(12) << result.maxNs / 1000
+                << std::setw(14) << result.allocations
+                << std::setw(14) << result.allocatedBytes;
+            if (result.outlier)
+                out << "  outlier";
+        }
+        out << '\n';
+    }
+    out << std::defaultfloat;
+
+    bool first = true;
+    for (const auto & result : results) {
+        if (!result.outlier)
+            continue;
+        if (first)
+            out << "\nOutliers:\n";
+        first = false;
+        out << "  " << fullName(result) << ": " << result.name << '\n';
+    }
+
+    first = true;
+    for (const auto & result : results) {
+        if (result.status != "failed")
+            continue;
+        if (first)
+            out << "\nFailed:\n";
+        first = false;
+        out << "  " << fullName(result) << ": " << result.error << '\n';
+    }
+}
+
+void ManifestBenchmark::writeCsv(std::ostream & out, const std::vector<Result> & results) {
+    out << "manifest,id,status,iterations,p50_ns,p90_ns,p99_ns,max_ns,allocations,allocated_bytes,outlier\n";
+    out << std::fixed << std::setprecision(0);
+    for (const auto & result : results) {
+        out << result.manifest << ',' << result.id << ',' << result.status << ',' << result.iterations << ','
+            << result.p50Ns << ',' << result.p90Ns << ',' << result.p99Ns << ',' << result.maxNs << ','
+            << result.allocations << ',' << result.allocatedBytes << ',' << (result.outlier ? "true" : "false")
+            << '\n';
+    }
+    out << std::defaultfloat;
+}
+
+void ManifestBenchmark::writeJson(std::ostream & out, const std::vector<Result> & results) {
+    json document = Benchmark::buildInfo();
+
+    json tests = json::array();
+    for (const auto & result : results) {
+        json entry;
+        entry["manifest"] = result.manifest;
+        entry["id"] = result.id;
+        entry["name"] = result.name;
+        entry["status"] = result.status;
+        if (!result.error.empty())
+            entry["error"] = result.error;
+        if (isTimed(result)) {
+            entry["iterations"] = result.iterations;
+            entry["p50_ns"] = result.p50Ns;
+            entry["p90_ns"] = result.p90Ns;
+            entry["p99_ns"] = result.p99Ns;
+            entry["max_ns"] = result.maxNs;
+            entry["allocations"] = result.allocations;
+            entry["allocated_bytes"] = result.allocatedBytes;
+            entry["outlier"] = result.outlier;
+        }
+        tests.push_back(entry);
+    }
+    document["tests"] = tests;
+
+    out << document.dump(2) << '\n';
+}
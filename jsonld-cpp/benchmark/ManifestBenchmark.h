@@ -0,0 +1,88 @@
+#ifndef LIBJSONLD_CPP_MANIFESTBENCHMARK_H
+#define LIBJSONLD_CPP_MANIFESTBENCHMARK_H
+
+#include <cstddef>
+#include <iosfwd>
+#include <string>
+#include <vector>
+
+/**
+ * Replays the tests of a W3C test suite manifest (expand-manifest.jsonld,
+ * toRdf-manifest.jsonld or fromRdf-manifest.jsonld) through JsonLdProcessor, or of the
+ * rdf-canon manifest (rdfc10-manifest.jsonld) through RDFCanonicalization, timing each
+ * test and counting its allocations.
+ *
+ * The suites exercise the less common parts of the algorithms (scoped contexts, @nest,
+ * lists...), so a test much slower than the rest of its suite points at an algorithmic
+ * hot spot. Such tests are flagged as outliers.
+ *
+ * Documents are read from disk once, when a test is first run, and are served from memory
+ * afterwards, so the times are those of the algorithms, not of reading and parsing files. Results are not compared to the expected outputs; the unit tests do that.
+ */
+namespace ManifestBenchmark {
+
+    struct Settings {
+        // only tests whose id or name contains filter are run
+        std::string filter;
+
+        // number of timed runs of each test
+        std::size_t repetitions = 20;
+    };
+
+    struct Result {
+        std::string manifest;
+        std::string id;
+        std::string name;
+
+        // "ok", "expected error" (a negative test failing as it should), "failed" or
+        // "skipped". Only tests with the first two statuses are timed.
+        std::string status;
+
+        // the error of a failed test
+        std::string error;
+
+        std::size_t iterations = 0;
+        double p50Ns = 0;
+        double p90Ns = 0;
+        double p99Ns = 0;
+        double maxNs = 0;
+
+        // allocations and allocated bytes of one run of the test
+        std::size_t allocations = 0;
+        std::size_t allocatedBytes = 0;
+
+        // true if the test is much slower than the others of its manifest
+        bool outlier = false;
+    };
+
+    /**
+     * Returns the file name of the manifest of an algorithm ("expand", "toRdf", "fromRdf"
+     * or "rdfc10"), or an empty string for other algorithms.
+     */
+    std::string manifestName(const std::string & algorithm);
+
+    /**
+     * Runs the tests of the manifest of algorithm, found in the testDataDir directory,
+     * according to settings. Outliers are flagged in the results.
+     */
+    std::vector<Result> run(const std::string & testDataDir, const std::string & algorithm,
+                            const Settings & settings);
+
+    /**
+     * Writes results as an aligned table, one test per line, followed by the outliers
+     */
+    void writeTable(std::ostream & out, const std::vector<Result> & results);
+
+    /**
+     * Writes results as comma-separated values, with a header line
+     */
+    void writeCsv(std::ostream & out, const std::vector<Result> & results);
+
+    /**
+     * Writes results as a JSON object that also describes the build that was measured
+     */
+    void writeJson(std::ostream & out, const std::vector<Result> & results);
+
+}
+
+#endif //LIBJSONLD_CPP_MANIFESTBENCHMARK_H
@@ -0,0 +1,169 @@
+#include "Benchmark.h"
+#include "ManifestBenchmark.h"
+
+#include <cstdlib>
+#include <fstream>
+#include <iostream>
+#include <vector>
+
+#ifndef JSONLDCPP_TEST_DATA_DIR
+#define JSONLDCPP_TEST_DATA_DIR ""
+#endif
+
+namespace {
+
+    void usage(const char * program) {
+        std::cerr << "Usage: " << program << " [options]\n"
+                  << "\n"
+                  << "Options:\n"
+                  << "  --filter=TEXT      only run benchmarks whose name/size contains TEXT\n"
+                  << "  --scale=FACTOR     multiply the sizes of all inputs by FACTOR (default 1)\n"
+                  << "  --min-time=SECONDS run each benchmark for at least SECONDS (default 0.5)\n"
+                  << "  --min-iterations=N run each benchmark at least N times (default 5)\n"
+                  << "  --format=FORMAT    output format: table, csv or json (default table)\n"
+                  << "  --output=FILE      write results to FILE instead of standard output\n"
+                  << "  --list             list the benchmarks without running them\n"
+                  << "\n"
+                  << "  --manifest=NAME    instead, replay the tests of a W3C manifest: expand, toRdf, fromRdf, rdfc10 or all.\n"
+                  << "                     --filter then selects tests by id or name.\n"
+                  << "  --repetitions=N    run each test of the manifest N times (default 20)\n"
+                  << "  --test-data=DIR    directory of the manifests (default " JSONLDCPP_TEST_DATA_DIR ")\n";
+    }
+
+    bool option(const std::string & arg, const std::string & name, std::string & value) {
+        std::string prefix = "--" + name + "=";
+        if (arg.compare(0, prefix.size(), prefix) != 0)
+            return false;
+        value = arg.substr(prefix.size());
+        return true;
+    }
+
+    bool openOutput(const std::string & output, std::ofstream & file) {
+        if (output.empty())
+            return true;
+        file.open(output);
+        if (!file)
+            std::cerr << "Could not open " << output << '\n';
+        return static_cast<bool>(file);
+    }
+
+    int runBenchmarks(double scale, const Benchmark::Settings & settings, bool list,
+                      const std::string & format, const std::string & output) {
+        std::vector<Benchmark::Result> results;
+        for (const auto & benchmark : Benchmark::allBenchmarks(scale)) {
+            if (!Benchmark::matches(benchmark, settings))
+                continue;
+            if (list) {
+                std::cout << benchmark.name << '/' << benchmark.size << '\n';
+                continue;
+            }
+            // progress goes to stderr, so that stdout only has the results
+            std::cerr << "running " << benchmark.name << '/' << benchmark.size << "..." << std::endl;
+            results.push_back(Benchmark::run(benchmark, settings));
+        }
+        if (list)
+            return EXIT_SUCCESS;
+
+        std::ofstream file;
+        if (!openOutput(output, file))
+            return EXIT_FAILURE;
+        std::ostream & out = output.empty() ? std::cout : file;
+
+        if (format == "json")
+            Benchmark::writeJson(out, results);
+        else if (format == "csv")
+            Benchmark::writeCsv(out, results);
+        else
+            Benchmark::writeTable(out, results);
+
+        return EXIT_SUCCESS;
+    }
+
+    int runManifests(const std::vector<std::string> & algorithms, const std::string & testDataDir,
+                     const ManifestBenchmark::Settings & settings, const std::string & format,
+                     const std::string & output) {
+        std::vector<ManifestBenchmark::Result> results;
+        for (const auto & algorithm : algorithms) {
+            std::cerr << "running " << ManifestBenchmark::manifestName(algorithm) << "..." << std::endl;
+            auto manifestResults = ManifestBenchmark::run(testDataDir, algorithm, settings);
+            results.insert(results.end(), manifestResults.begin(), manifestResults.end());
+        }
+
+        std::ofstream file;
+        if (!openOutput(output, file))
+            return EXIT_FAILURE;
+        std::ostream & out = output.empty() ? std::cout : file;
+
+        if (format == "json")
+            ManifestBenchmark::writeJson(out, results);
+        else if (format == "csv")
+            ManifestBenchmark::writeCsv(out, results);
+        else
+            ManifestBenchmark::writeTable(out, results);
+
+        return EXIT_SUCCESS;
+    }
+
+}
+
+int main(int argc, char * argv[]) {
+    Benchmark::Settings settings;
+    ManifestBenchmark::Settings manifestSettings;
+    double scale = 1;
+    std::string format = "table";
+    std::string output;
+    std::string manifest;
+    std::string testDataDir = JSONLDCPP_TEST_DATA_DIR;
+    bool list = false;
+
+    for (int i = 1; i < argc; i++) {
+        std::string arg = argv[i];
+        std::string value;
+        if (option(arg, "filter", value))
+            settings.filter = manifestSettings.filter = value;
+        else if (option(arg, "scale", value))
+            scale = std::atof(value.c_str());
+        else if (option(arg, "min-time", value))
+            settings.minTime = std::atof(value.c_str());
+        else if (option(arg, "min-iterations", value))
+            settings.minIterations = static_cast<std::size_t>(std::atol(value.c_str()));
+        else if (option(arg, "format", value))
+            format = value;
+        else if (option(arg, "output", value))
+            output = value;
+        else if (option(arg, "manifest", value))
+            manifest = value;
+        else if (option(arg, "repetitions", value))
+            manifestSettings.repetitions = static_cast<std::size_t>(std::atol(value.c_str()));
+        else if (option(arg, "test-data", value))
+            testDataDir = value;
+        else if (arg == "--list")
+            list = true;
+        else {
+            usage(argv[0]);
+            return arg == "--help" ? EXIT_SUCCESS : EXIT_FAILURE;
+        }
+    }
+
+    if ((format != "table" && format != "csv" && format != "json") || scale <= 0) {
+        usage(argv[0]);
+        return EXIT_FAILURE;
+    }
+
+    if (manifest.empty())
+        return runBenchmarks(scale, settings, list, format, output);
+
+    std::vector<std::string> algorithms;
+    if (manifest == "all")
+        algorithms = {"expand", "toRdf", "fromRdf", "rdfc10"};
+    else if (!ManifestBenchmark::manifestName(manifest).empty())
+        algorithms = {manifest};
+    else {
+        usage(argv[0]);
+        return EXIT_FAILURE;
+    }
+    if (!testDataDir.empty() && testDataDir.back() != '/')
+        testDataDir += '/';
+
+    return runManifests(algorithms, testDataDir, manifestSettings, format, output);
+}
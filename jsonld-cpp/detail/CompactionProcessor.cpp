@@ -0,0 +1,1278 @@
+#include "jsonld-cpp/detail/CompactionProcessor.h"
+
+#include <algorithm>
+#include <memory>
+#include <string>
+#include <vector>
+
+#include "jsonld-cpp/detail/Context.h"
+#include "jsonld-cpp/detail/ContextProcessor.h"
+#include "jsonld-cpp/detail/InverseContext.h"
+#include "jsonld-cpp/detail/JsonLdUtils.h"
+#include "jsonld-cpp/detail/Keyword.h"
+#include "jsonld-cpp/JsonLdError.h"
+#include "jsonld-cpp/JsonLdUrl.h"
+
+using json = nlohmann::ordered_json;
+
+namespace {
+
+    std::string toLower(std::string str) {
+        std::transform(str.begin(), str.end(), str.begin(), ::tolower);
+        return str;
+    }
+
+    const json & termDefinitionOf(const Context & activeContext, const std::string * activeProperty) {
+        static const json noTermDefinition;
+        if (activeProperty == nullptr)
+            return noTermDefinition;
+        return activeContext.lookupTermDefinition(*activeProperty);
+    }
+
+    const json & containerMappingOf(const Context & activeContext, const std::string * activeProperty) {
+        static const json noContainerMapping = json::array();
+        const json & termDefinition = termDefinitionOf(activeContext, activeProperty);
+        if (termDefinition.contains(JsonLdConsts::CONTAINER))
+            return termDefinition.at(JsonLdConsts::CONTAINER);
+        return noContainerMapping;
+    }
+
+    bool includes(const json & container, const std::string & value) {
+        return std::find(container.cbegin(), container.cend(), value) != container.cend();
+    }
+
+    bool isJsonLiteral(const Context & activeContext, const std::string & property) {
+        const json & termDefinition = activeContext.lookupTermDefinition(property);
+        return termDefinition.contains(JsonLdConsts::TYPE) && termDefinition.at(JsonLdConsts::TYPE) == JsonLdConsts::JSON;
+    }
+
+    std::string termsBaseUrl(const json & termDefinition) {
+        if (termDefinition.contains(JsonLdConsts::BASEURL) && termDefinition.at(JsonLdConsts::BASEURL).is_string())
+            return termDefinition.at(JsonLdConsts::BASEURL).get<std::string>();
+        return "";
+    }
+
+    // the language, or language and direction, of a value object, normalized to lower case
+    std::string languageOf(const json & value) {
+        std::string language;
+        if (value.contains(JsonLdConsts::LANGUAGE) && value.at(JsonLdConsts::LANGUAGE).is_string())
+            language = value.at(JsonLdConsts::LANGUAGE).get<std::string>();
+        if (value.contains(JsonLdConsts::DIRECTION))
+            language += "_" + value.at(JsonLdConsts::DIRECTION).get<std::string>();
+        return toLower(language);
+    }
+
+    /**
+     * Value Compaction Algorithm
+     *
+     * https://www.w3.org/TR/json-ld11-api/#value-compaction
+     */
+    json compactValue(const Context & activeContext, const std::string * activeProperty, const json & value) {
+
+        // Comments in this function are labeled with numbers that correspond to sections
+        // from the description of the Value Compaction algorithm.
+        // See: https://www.w3.org/TR/json-ld11-api/#value-compaction
+
+        // 1)
+        // Initialize result to a copy of value.
+        json result = value;
+
+        const json & termDefinition = termDefinitionOf(activeContext, activeProperty);
+        const json & containerMapping = containerMappingOf(activeContext, activeProperty);
+
+        // 4)
+        // Initialize language to the language mapping for active property in active context,
+        // if any, otherwise to the default language of active context.
+        json language;
+        if (termDefinition.contains(JsonLdConsts::LANGUAGE))
+            language = termDefinition.at(JsonLdConsts::LANGUAGE);
+        else if (!activeContext.getDefaultLanguage().empty())
+            language = activeContext.getDefaultLanguage();
+
+        // 5)
+        // Initialize direction to the direction mapping for active property in active context,
+        // if any, otherwise to the default base direction of active context.
+        json direction;
+        if (termDefinition.contains(JsonLdConsts::DIRECTION))
+            direction = termDefinition.at(JsonLdConsts::DIRECTION);
+        else if (activeContext.getDefaultBaseDirection() != "null")
+            direction = activeContext.getDefaultBaseDirection();
+
+        json typeMapping;
+        if (termDefinition.contains(JsonLdConsts::TYPE))
+            typeMapping = termDefinition.at(JsonLdConsts::TYPE);
+
+        // An @index entry can only be dropped if the container mapping will preserve it.
+        bool indexIsPreserved =
+                !value.contains(JsonLdConsts::INDEX) || includes(containerMapping, JsonLdConsts::INDEX);
+
+        // 6)
+        // If value has an @id entry and has no other entries other than @index:
+        if (value.contains(JsonLdConsts::ID) && value.at(JsonLdConsts::ID).is_string() &&
+            (value.size() == 1 || (value.size() == 2 && value.contains(JsonLdConsts::INDEX)))) {
+            const std::string & id = value.at(JsonLdConsts::ID).get_ref<const std::string &>();
+
+            // 6.1)
+            // If the type mapping of active property is set to @id, set result to the result
+            // of IRI compacting the value associated with the @id entry using false for vocab.
+            if (indexIsPreserved && typeMapping == JsonLdConsts::ID)
+                result = CompactionProcessor::compactIri(activeContext, id, nullptr, false);
+
+            // 6.2)
+            // Otherwise, if the type mapping of active property is set to @vocab, set result to
+            // the result of IRI compacting the value associated with the @id entry.
+            else if (indexIsPreserved && typeMapping == JsonLdConsts::VOCAB)
+                result = CompactionProcessor::compactIri(activeContext, id);
+        }
+
+        // 7)
+        // Otherwise, if value has an @type entry whose value matches the type mapping of
+        // active property, set result to the value associated with the @value entry of value.
+        else if (value.contains(JsonLdConsts::TYPE) && value.at(JsonLdConsts::TYPE) == typeMapping) {
+            if (indexIsPreserved)
+                result = value.at(JsonLdConsts::VALUE);
+        }
+
+        // 8)
+        // Otherwise, if the type mapping of active property is @none, or value has an @type
+        // entry, and the value of @type in value does not match the type mapping of active
+        // property, leave value as is, as value compaction is disabled.
+        else if (typeMapping == JsonLdConsts::NONE || value.contains(JsonLdConsts::TYPE)) {
+
+            // 8.1)
+            // Replace any value of @type in result with the result of IRI compacting the
+            // value of the @type entry.
+            if (result.contains(JsonLdConsts::TYPE)) {
+                json & type = result[JsonLdConsts::TYPE];
+                if (type.is_string())
+                    type = CompactionProcessor::compactIri(activeContext, type.get<std::string>());
+                else if (type.is_array()) {
+                    for (auto & t : type)
+                        t = CompactionProcessor::compactIri(activeContext, t.get<std::string>());
+                }
+            }
+        }
+
+        // 9)
+        // Otherwise, if the value of the @value entry is not a string, set result to the
+        // value associated with the @value entry.
+        else if (value.contains(JsonLdConsts::VALUE) && !value.at(JsonLdConsts::VALUE).is_string()) {
+            if (indexIsPreserved)
+                result = value.at(JsonLdConsts::VALUE);
+        }
+
+        // 10)
+        // Otherwise, if value has an @language entry whose value exactly matches language,
+        // using a case-insensitive comparison if it is not null, or is not present, if
+        // language is null, and the value has a @direction entry whose value exactly matches
+        // direction, if it is not null, or is not present, if direction is null:
+        else if (value.contains(JsonLdConsts::VALUE)) {
+            bool languageMatches = value.contains(JsonLdConsts::LANGUAGE) ?
+                    language.is_string() &&
+                    toLower(value.at(JsonLdConsts::LANGUAGE).get<std::string>()) == toLower(language.get<std::string>()) :
+                    language.is_null();
+            bool directionMatches = value.contains(JsonLdConsts::DIRECTION) ?
+                    value.at(JsonLdConsts::DIRECTION) == direction :
+                    direction.is_null();
+
+            // 10.1)
+            // Set result to the value associated with the @value entry.
+            if (languageMatches && directionMatches && indexIsPreserved)
+                result = value.at(JsonLdConsts::VALUE);
+        }
+
+        // 11)
+        // If result is a map, replace each key in result with the result of IRI compacting
+        // that key.
+        if (result.is_object()) {
+            json compacted = json::object();
+            for (auto & el : result.items())
+                compacted[CompactionProcessor::compactIri(activeContext, el.key())] = el.value();
+            result = std::move(compacted);
+        }
+
+        // 12)
+        // Return result.
+        return result;
+    }
+
+    // Returns the map that values of itemActiveProperty are added to: result itself, or
+    // the entry of result named by the nest value of itemActiveProperty.
+    json & nestResultFor(Context & activeContext, const std::string & itemActiveProperty, json & result) {
+
+        // 11.8.2)
+        // If the term definition for item active property in the active context has a
+        // nest value entry (nest term):
+        const json & termDefinition = activeContext.lookupTermDefinition(itemActiveProperty);
+        if (!termDefinition.contains(JsonLdConsts::NEST))
+            return result;
+        std::string nestTerm = termDefinition.at(JsonLdConsts::NEST).get<std::string>();
+
+        // 11.8.2.1)
+        // If nest term is not @nest, or a term in the active context that expands to @nest,
+        // an invalid @nest value error has been detected, and processing is aborted.
+        if (nestTerm != JsonLdConsts::NEST &&
+            ContextProcessor::expandIri(activeContext, nestTerm, false, true) != JsonLdConsts::NEST)
+            throw JsonLdError(JsonLdError::InvalidNestValue, nestTerm);
+
+        // 11.8.2.2)
+        // If result does not have a nest term entry, initialize it to an empty map.
+        if (!result.contains(nestTerm))
+            result[nestTerm] = json::object();
+
+        // 11.8.2.3)
+        // Initialize nest result to the value of nest term in result.
+        return result[nestTerm];
+    }
+
+    // Sets mapKey to the first value of key in compactedItem, if it is a string, and
+    // removes that value from compactedItem.
+    void takeFirstValue(json & compactedItem, const std::string & key, json & mapKey) {
+        if (!compactedItem.is_object() || !compactedItem.contains(key))
+            return;
+        json values = compactedItem.at(key);
+        if (!values.is_array())
+            values = json::array({values});
+        if (values.empty() || !values.at(0).is_string())
+            return;
+        mapKey = values.at(0);
+        compactedItem.erase(key);
+        values.erase(values.begin());
+        JsonLdUtils::addValue(compactedItem, key, values, false);
+    }
+
+}
+
+json CompactionProcessor::compact(
+        Context activeContext,
+        const std::string *activeProperty,
+        const json & element,
+        bool compactArrays,
+        bool ordered) {
+
+    // Comments in this function are labeled with numbers that correspond to sections
+    // from the description of the Compaction algorithm.
+    // See: https://www.w3.org/TR/json-ld11-api/#compaction-algorithm
+
+    // 1)
+    // Initialize type-scoped context to active context. This is used for compacting
+    // values that may be relevant to any previous type-scoped context.
+    Context typeScopedContext = activeContext;
+
+    // 2)
+    // If element is a scalar, it is already in its most compact form, so simply return
+    // element.
+    if (!element.is_structured())
+        return element;
+
+    // 3)
+    // If element is an array:
+    if (element.is_array()) {
+
+        // 3.1-2)
+        // Initialize result to an empty array. For each item in element, compact it and
+        // append it to result unless it is null.
+        json result = json::array();
+        for (const auto & item : element) {
+            json compactedItem = compact(activeContext, activeProperty, item, compactArrays, ordered);
+            if (!compactedItem.is_null())
+                result.push_back(std::move(compactedItem));
+        }
+
+        // 3.3)
+        // If result is empty or contains more than one value, or compactArrays is false, or
+        // active property is either @graph or @set, or container mapping for active property
+        // in active context includes either @list or @set, return result.
+        const json & containerMapping = containerMappingOf(activeContext, activeProperty);
+        if (result.size() != 1 || !compactArrays ||
+            (activeProperty != nullptr &&
+             (*activeProperty == JsonLdConsts::GRAPH || *activeProperty == JsonLdConsts::SET)) ||
+            includes(containerMapping, JsonLdConsts::LIST) || includes(containerMapping, JsonLdConsts::SET))
+            return result;
+
+        // 3.4)
+        // Otherwise, return the value in result.
+        return result.at(0);
+    }
+
+    // 4)
+    // Otherwise element is a map. If active context has a previous context, the active
+    // context is not propagated. If element does not contain an @value entry, and element
+    // does not consist of a single @id entry, set active context to previous context from
+    // active context, as the scope of a term-scoped context does not apply when processing
+    // new node objects.
+    // Note: the property-scoped context of active property is looked up first, as it is
+    // defined in the active context, not the previous context.
+    const json & activeTermDefinition = termDefinitionOf(activeContext, activeProperty);
+    std::unique_ptr<json> propertyScopedContext;
+    std::string propertyScopedBaseUrl;
+    if (activeTermDefinition.contains(JsonLdConsts::LOCALCONTEXT)) {
+        propertyScopedContext.reset(new json(activeTermDefinition.at(JsonLdConsts::LOCALCONTEXT)));
+        propertyScopedBaseUrl = termsBaseUrl(activeTermDefinition);
+    }
+
+    if (activeContext.getPreviousContext() != nullptr && !element.contains(JsonLdConsts::VALUE) &&
+        !(element.size() == 1 && element.contains(JsonLdConsts::ID))) {
+        Context previousContext = *activeContext.getPreviousContext();
+        activeContext = previousContext;
+    }
+
+    // 5)
+    // If the term definition for active property in active context has a local context,
+    // set active context to the result of the Context Processing algorithm, passing active
+    // context, the value of the active property's local context as local context, base
+    // URL from the term definition for active property in active context, and true for
+    // override protected.
+    if (propertyScopedContext != nullptr)
+        activeContext = ContextProcessor::process(
+                activeContext, *propertyScopedContext, propertyScopedBaseUrl, true);
+
+    // 6)
+    // If element has an @value or @id entry and the result of using the Value Compaction
+    // algorithm, passing active context, active property, and element as value is a scalar,
+    // or the term definition for active property has a type mapping of @json, return that
+    // result.
+    // Note: a node object with entries other than @id and @index always compacts to a map,
+    // so Value Compaction is only used for value objects and node references.
+    if (element.contains(JsonLdConsts::VALUE) ||
+        (element.contains(JsonLdConsts::ID) &&
+         (element.size() == 1 || (element.size() == 2 && element.contains(JsonLdConsts::INDEX))))) {
+        json result = compactValue(activeContext, activeProperty, element);
+        const json & termDefinition = termDefinitionOf(activeContext, activeProperty);
+        if (!result.is_structured() ||
+            (termDefinition.contains(JsonLdConsts::TYPE) && termDefinition.at(JsonLdConsts::TYPE) == JsonLdConsts::JSON))
+            return result;
+    }
+
+    // 7)
+    // If element is a list object, and the container mapping for active property in active
+    // context includes @list, return the result of using this algorithm recursively, passing
+    // active context, active property, value of @list in element for element, and the
+    // compactArrays and ordered flags.
+    if (JsonLdUtils::isListObject(element) &&
+        includes(containerMappingOf(activeContext, activeProperty), JsonLdConsts::LIST))
+        return compact(activeContext, activeProperty, element.at(JsonLdConsts::LIST), compactArrays, ordered);
+
+    // 8)
+    // Initialize inside reverse to true if active property equals @reverse, otherwise to
+    // false.
+    bool insideReverse = activeProperty != nullptr && *activeProperty == JsonLdConsts::REVERSE;
+
+    // 9)
+    // Initialize result to a new empty map.
+    json result = json::object();
+
+    // 10)
+    // If element has an @type entry, create a new array compacted types initialized by
+    // transforming each expanded type of that entry into its compacted form by IRI
+    // compacting expanded type. Then, for each term in compacted types ordered
+    // lexicographically, if the term definition for term in type-scoped context has a local
+    // context, set active context to the result of the Context Processing algorithm, passing
+    // active context and the value of term's local context in type-scoped context as local
+    // context, base URL from the term definition for term in type-scoped context, and false
+    // for propagate.
+    if (element.contains(JsonLdConsts::TYPE)) {
+        std::vector<std::string> compactedTypes;
+        const json & expandedTypes = element.at(JsonLdConsts::TYPE);
+        if (expandedTypes.is_string())
+            compactedTypes.push_back(compactIri(activeContext, expandedTypes.get<std::string>()));
+        else {
+            for (const auto & expandedType : expandedTypes)
+                compactedTypes.push_back(compactIri(activeContext, expandedType.get<std::string>()));
+        }
+        std::sort(compactedTypes.begin(), compactedTypes.end());
+
+        for (const auto & term : compactedTypes) {
+            const json & termDefinition = typeScopedContext.lookupTermDefinition(term);
+            if (termDefinition.contains(JsonLdConsts::LOCALCONTEXT))
+                activeContext = ContextProcessor::process(
+                        activeContext, termDefinition.at(JsonLdConsts::LOCALCONTEXT),
+                        termsBaseUrl(termDefinition), false, false);
+        }
+    }
+
+    // 11)
+    // For each key expanded property and value expanded value in element, ordered
+    // lexicographically by expanded property if ordered is true:
+    std::vector<std::string> expandedProperties;
+    expandedProperties.reserve(element.size());
+    for (auto it = element.cbegin(); it != element.cend(); ++it)
+        expandedProperties.push_back(it.key());
+    if (ordered)
+        std::sort(expandedProperties.begin(), expandedProperties.end());
+
+    for (const auto & expandedProperty : expandedProperties) {
+        const json & expandedValue = element.at(expandedProperty);
+        Keyword keyword = Keywords::classify(expandedProperty);
+
+        // 11.1)
+        // If expanded property is @id:
+        if (keyword == Keyword::Id) {
+
+            // 11.1.1)
+            // If expanded value is a string, then initialize compacted value by IRI
+            // compacting expanded value with vocab set to false.
+            json compactedValue = expandedValue;
+            if (expandedValue.is_string())
+                compactedValue = compactIri(activeContext, expandedValue.get<std::string>(), nullptr, false);
+
+            // 11.1.2-3)
+            // Initialize alias by IRI compacting expanded property, and add an entry alias to
+            // result whose value is set to compacted value.
+            result[compactIri(activeContext, expandedProperty)] = compactedValue;
+            continue;
+        }
+
+        // 11.2)
+        // If expanded property is @type:
+        if (keyword == Keyword::Type) {
+
+            // 11.2.1-2)
+            // If expanded value is a string, then initialize compacted value by IRI compacting
+            // expanded value using type-scoped context for active context. Otherwise, expanded
+            // value must be a @type array; initialize compacted value to an empty array and
+            // append the IRI compaction of each item.
+            json compactedValue;
+            if (expandedValue.is_string())
+                compactedValue = compactIri(typeScopedContext, expandedValue.get<std::string>());
+            else {
+                compactedValue = json::array();
+                for (const auto & expandedType : expandedValue)
+                    compactedValue.push_back(compactIri(typeScopedContext, expandedType.get<std::string>()));
+            }
+
+            // 11.2.3)
+            // Initialize alias by IRI compacting expanded property.
+            std::string alias = compactIri(activeContext, expandedProperty);
+
+            // 11.2.4)
+            // Initialize as array to true if processing mode is json-ld-1.1 and the container
+            // mapping for alias in the active context includes @set, otherwise to the negation
+            // of compactArrays.
+            bool asArray = (!activeContext.isProcessingMode(JsonLdConsts::JSON_LD_1_0) &&
+                            includes(containerMappingOf(activeContext, &alias), JsonLdConsts::SET)) ||
+                           !compactArrays;
+
+            // 11.2.5)
+            // Use add value to add compacted value to the alias entry in result using as array.
+            JsonLdUtils::addValue(result, alias, compactedValue, asArray);
+            continue;
+        }
+
+        // 11.3)
+        // If expanded property is @reverse:
+        if (keyword == Keyword::Reverse) {
+
+            // 11.3.1)
+            // Initialize compacted value to the result of using this algorithm recursively,
+            // passing active context, @reverse for active property, expanded value for
+            // element, and the compactArrays and ordered flags.
+            static const std::string reverseProperty = JsonLdConsts::REVERSE;
+            json compactedValue = compact(activeContext, &reverseProperty, expandedValue, compactArrays, ordered);
+
+            // 11.3.2)
+            // For each property and value in compacted value, if the term definition for
+            // property in the active context indicates that property is a reverse property,
+            // add value to the property entry in result and remove it from compacted value.
+            std::vector<std::string> reverseProperties;
+            for (auto & el : compactedValue.items()) {
+                const std::string & property = el.key();
+                if (activeContext.isReverseProperty(property)) {
+                    bool asArray = includes(containerMappingOf(activeContext, &property), JsonLdConsts::SET) ||
+                                   !compactArrays;
+                    JsonLdUtils::addValue(result, property, el.value(), asArray);
+                    reverseProperties.push_back(property);
+                }
+            }
+            for (const auto & property : reverseProperties)
+                compactedValue.erase(property);
+
+            // 11.3.3)
+            // If compacted value has some remaining map entries, add them to result under the
+            // IRI compaction of @reverse.
+            if (!compactedValue.empty())
+                result[compactIri(activeContext, JsonLdConsts::REVERSE)] = compactedValue;
+            continue;
+        }
+
+        // 11.4)
+        // If expanded property is @preserve then:
+        if (keyword == Keyword::Preserve) {
+
+            // 11.4.1-2)
+            // Initialize compacted value to the result of using this algorithm recursively,
+            // and add it as the value of @preserve in result unless expanded value is an
+            // empty array.
+            json compactedValue = compact(activeContext, activeProperty, expandedValue, compactArrays, ordered);
+            if (!(expandedValue.is_array() && expandedValue.empty()))
+                result[JsonLdConsts::PRESERVE] = compactedValue;
+            continue;
+        }
+
+        // 11.5)
+        // If expanded property is @index and active property has a container mapping in
+        // active context that includes @index, then the compacted result will be inside of
+        // an @index container, drop the @index entry by continuing to the next expanded
+        // property.
+        if (keyword == Keyword::Index &&
+            includes(containerMappingOf(activeContext, activeProperty), JsonLdConsts::INDEX))
+            continue;
+
+        // 11.6)
+        // Otherwise, if expanded property is @direction, @index, @language, or @value, add
+        // an entry to result whose key is the IRI compaction of expanded property and whose
+        // value is expanded value.
+        if (keyword == Keyword::Direction || keyword == Keyword::Index ||
+            keyword == Keyword::Language || keyword == Keyword::Value) {
+            result[compactIri(activeContext, expandedProperty)] = expandedValue;
+            continue;
+        }
+
+        // 11.7)
+        // If expanded value is an empty array:
+        if (expandedValue.is_array() && expandedValue.empty()) {
+
+            // 11.7.1)
+            // Initialize item active property by IRI compacting expanded property, using
+            // expanded value for value and inside reverse for reverse.
+            std::string itemActiveProperty =
+                    compactIri(activeContext, expandedProperty, &expandedValue, true, insideReverse);
+
+            // 11.7.2-4)
+            // Use add value to add an empty array to the item active property entry in nest
+            // result, or in result if item active property has no nest value.
+            json & nestResult = nestResultFor(activeContext, itemActiveProperty, result);
+            JsonLdUtils::addValue(nestResult, itemActiveProperty, json::array(), true);
+        }
+
+        // 11.8)
+        // At this point, expanded value must be an array due to the Expansion algorithm. For
+        // each item expanded item in expanded value:
+        for (const auto & expandedItem : expandedValue) {
+
+            // 11.8.1)
+            // Initialize item active property by IRI compacting expanded property, using
+            // expanded item for value and inside reverse for reverse.
+            std::string itemActiveProperty =
+                    compactIri(activeContext, expandedProperty, &expandedItem, true, insideReverse);
+
+            // 11.8.2-3)
+            json & nestResult = nestResultFor(activeContext, itemActiveProperty, result);
+
+            // 11.8.4)
+            // Initialize container to container mapping for item active property in active
+            // context, or to a new empty array, if there is no such container mapping.
+            const json & container = containerMappingOf(activeContext, &itemActiveProperty);
+
+            // 11.8.5)
+            // Initialize as array to true if container includes @set, or if item active
+            // property is @graph or @list, otherwise the negation of compactArrays.
+            bool asArray = includes(container, JsonLdConsts::SET) ||
+                           itemActiveProperty == JsonLdConsts::GRAPH ||
+                           itemActiveProperty == JsonLdConsts::LIST ||
+                           !compactArrays;
+
+            // 11.8.6)
+            // Initialize compacted item to the result of using this algorithm recursively,
+            // passing active context, item active property for active property, expanded item
+            // for element, along with the compactArrays and ordered flags. If expanded item is
+            // a list object or a graph object, use the value of the @list or @graph entries,
+            // respectively, for element instead of expanded item.
+            bool isListObject = JsonLdUtils::isListObject(expandedItem);
+            bool isGraphObject = JsonLdUtils::isGraphObject(expandedItem);
+            const json & itemElement =
+                    isListObject ? expandedItem.at(JsonLdConsts::LIST) :
+                    isGraphObject ? expandedItem.at(JsonLdConsts::GRAPH) :
+                    expandedItem;
+            json compactedItem = compact(activeContext, &itemActiveProperty, itemElement, compactArrays, ordered);
+
+            // 11.8.7)
+            // If expanded item is a list object:
+            if (isListObject) {
+
+                // 11.8.7.1)
+                // If compacted item is not an array, then set it to an array containing only
+                // compacted item.
+                if (!compactedItem.is_array())
+                    compactedItem = json::array({compactedItem});
+
+                // 11.8.7.2)
+                // If container does not include @list, convert compacted item to a list
+                // object, adding an @index entry if expanded item has one, and add it to
+                // nest result using as array.
+                if (!includes(container, JsonLdConsts::LIST)) {
+                    json listObject = json::object();
+                    listObject[compactIri(activeContext, JsonLdConsts::LIST)] = compactedItem;
+                    if (expandedItem.contains(JsonLdConsts::INDEX))
+                        listObject[compactIri(activeContext, JsonLdConsts::INDEX)] = expandedItem.at(JsonLdConsts::INDEX);
+                    JsonLdUtils::addValue(nestResult, itemActiveProperty, listObject, asArray);
+                }
+
+                // 11.8.7.3)
+                // Otherwise, set the value of the item active property entry in nest result
+                // to compacted item.
+                else
+                    nestResult[itemActiveProperty] = compactedItem;
+            }
+
+            // 11.8.8)
+            // If expanded item is a graph object:
+            else if (isGraphObject) {
+                bool isSimpleGraphObject = !expandedItem.contains(JsonLdConsts::ID);
+
+                // 11.8.8.1)
+                // If container includes @graph and @id, add compacted item to the map in the
+                // item active property entry of nest result, using the IRI compaction of the
+                // @id of expanded item (or of @none) as the map key.
+                if (includes(container, JsonLdConsts::GRAPH) && includes(container, JsonLdConsts::ID)) {
+                    if (!nestResult.contains(itemActiveProperty))
+                        nestResult[itemActiveProperty] = json::object();
+                    json & mapObject = nestResult[itemActiveProperty];
+                    std::string mapKey = expandedItem.contains(JsonLdConsts::ID) ?
+                            compactIri(activeContext, expandedItem.at(JsonLdConsts::ID).get<std::string>(), nullptr, false) :
+                            compactIri(activeContext, JsonLdConsts::NONE);
+                    JsonLdUtils::addValue(mapObject, mapKey, compactedItem, asArray);
+                }
+
+                // 11.8.8.2)
+                // Otherwise, if container includes @graph and @index and expanded item is a
+                // simple graph object, add compacted item to the map in the item active
+                // property entry of nest result, using the @index of expanded item (or the
+                // IRI compaction of @none) as the map key.
+                else if (includes(container, JsonLdConsts::GRAPH) && includes(container, JsonLdConsts::INDEX) &&
+                         isSimpleGraphObject) {
+                    if (!nestResult.contains(itemActiveProperty))
+                        nestResult[itemActiveProperty] = json::object();
+                    json & mapObject = nestResult[itemActiveProperty];
+                    std::string mapKey = expandedItem.contains(JsonLdConsts::INDEX) ?
+                            expandedItem.at(JsonLdConsts::INDEX).get<std::string>() :
+                            compactIri(activeContext, JsonLdConsts::NONE);
+                    JsonLdUtils::addValue(mapObject, mapKey, compactedItem, asArray);
+                }
+
+                // 11.8.8.3)
+                // Otherwise, if container includes @graph and expanded item is a simple graph
+                // object the value cannot be represented as a map object. If compacted item is
+                // an array with more than one value, it cannot be directly represented, as
+                // multiple objects would be interpreted as different named graphs, so set
+                // compacted item to a new map containing the IRI compaction of @included as
+                // the key and the original compacted item as the value. Then add compacted
+                // item to nest result using as array.
+                else if (includes(container, JsonLdConsts::GRAPH) && isSimpleGraphObject) {
+                    if (compactedItem.is_array() && compactedItem.size() > 1) {
+                        json included = json::object();
+                        included[compactIri(activeContext, JsonLdConsts::INCLUDED)] = compactedItem;
+                        compactedItem = std::move(included);
+                    }
+                    JsonLdUtils::addValue(nestResult, itemActiveProperty, compactedItem, asArray);
+                }
+
+                // 11.8.8.4)
+                // Otherwise, container does not include @graph or otherwise does not match
+                // one of the previous cases. Wrap compacted item in a map under the IRI
+                // compaction of @graph, adding the compacted @id and the @index of expanded
+                // item if it has them, and add it to nest result using as array.
+                else {
+                    json graphObject = json::object();
+                    graphObject[compactIri(activeContext, JsonLdConsts::GRAPH)] = compactedItem;
+                    if (expandedItem.contains(JsonLdConsts::ID))
+                        graphObject[compactIri(activeContext, JsonLdConsts::ID)] =
+                                compactIri(activeContext, expandedItem.at(JsonLdConsts::ID).get<std::string>(), nullptr, false);
+                    if (expandedItem.contains(JsonLdConsts::INDEX))
+                        graphObject[compactIri(activeContext, JsonLdConsts::INDEX)] = expandedItem.at(JsonLdConsts::INDEX);
+                    JsonLdUtils::addValue(nestResult, itemActiveProperty, graphObject, asArray);
+                }
+            }
+
+            // 11.8.9)
+            // Otherwise, if container includes @language, @index, @id, or @type and container
+            // does not include @graph:
+            else if ((includes(container, JsonLdConsts::LANGUAGE) || includes(container, JsonLdConsts::INDEX) ||
+                      includes(container, JsonLdConsts::ID) || includes(container, JsonLdConsts::TYPE)) &&
+                     !includes(container, JsonLdConsts::GRAPH)) {
+
+                // 11.8.9.1)
+                // Initialize map object to the value of item active property in nest result,
+                // initializing it to a new empty map, if necessary.
+                if (!nestResult.contains(itemActiveProperty))
+                    nestResult[itemActiveProperty] = json::object();
+                json & mapObject = nestResult[itemActiveProperty];
+
+                // 11.8.9.2)
+                // Set container key by IRI compacting either @language, @index, @id, or @type
+                // based on the contents of container.
+                const char * containerKeyword =
+                        includes(container, JsonLdConsts::LANGUAGE) ? JsonLdConsts::LANGUAGE :
+                        includes(container, JsonLdConsts::INDEX) ? JsonLdConsts::INDEX :
+                        includes(container, JsonLdConsts::ID) ? JsonLdConsts::ID :
+                        JsonLdConsts::TYPE;
+                std::string containerKey = compactIri(activeContext, containerKeyword);
+
+                // 11.8.9.3)
+                // Initialize index key to the value of index mapping in the term definition
+                // associated with item active property in active context, or @index, if no
+                // such value exists.
+                const json & itemTermDefinition = activeContext.lookupTermDefinition(itemActiveProperty);
+                std::string indexKey = itemTermDefinition.contains(JsonLdConsts::INDEX) ?
+                        itemTermDefinition.at(JsonLdConsts::INDEX).get<std::string>() :
+                        JsonLdConsts::INDEX;
+
+                json mapKey;
+
+                // 11.8.9.4)
+                // If container includes @language and expanded item contains a @value entry,
+                // then set compacted item to the value associated with its @value entry. Set
+                // map key to the value of @language in expanded item, if any.
+                if (includes(container, JsonLdConsts::LANGUAGE) && expandedItem.contains(JsonLdConsts::VALUE)) {
+                    compactedItem = expandedItem.at(JsonLdConsts::VALUE);
+                    if (expandedItem.contains(JsonLdConsts::LANGUAGE))
+                        mapKey = expandedItem.at(JsonLdConsts::LANGUAGE);
+                }
+
+                // 11.8.9.5)
+                // Otherwise, if container includes @index and index key is @index, set map
+                // key to the value of @index in expanded item, if any.
+                else if (includes(container, JsonLdConsts::INDEX) && indexKey == JsonLdConsts::INDEX) {
+                    if (expandedItem.contains(JsonLdConsts::INDEX))
+                        mapKey = expandedItem.at(JsonLdConsts::INDEX);
+                }
+
+                // 11.8.9.6)
+                // Otherwise, if container includes @index and index key is not @index:
+                else if (includes(container, JsonLdConsts::INDEX)) {
+
+                    // 11.8.9.6.1)
+                    // Reinitialize container key by IRI compacting index key after first IRI
+                    // expanding it.
+                    containerKey = compactIri(activeContext,
+                                              ContextProcessor::expandIri(activeContext, indexKey, false, true));
+
+                    // 11.8.9.6.2-4)
+                    // Set map key to the first value of container key in compacted item, if
+                    // any, and remove that value from compacted item.
+                    takeFirstValue(compactedItem, containerKey, mapKey);
+                }
+
+                // 11.8.9.7)
+                // Otherwise, if container includes @id, set map key to the value of container
+                // key in compacted item and remove container key from compacted item.
+                else if (includes(container, JsonLdConsts::ID)) {
+                    if (compactedItem.is_object() && compactedItem.contains(containerKey)) {
+                        mapKey = compactedItem.at(containerKey);
+                        compactedItem.erase(containerKey);
+                    }
+                }
+
+                // 11.8.9.8)
+                // Otherwise, if container includes @type:
+                else {
+
+                    // 11.8.9.8.1-3)
+                    // Set map key to the first value of container key in compacted item, if
+                    // any, and remove that value from compacted item.
+                    takeFirstValue(compactedItem, containerKey, mapKey);
+
+                    // 11.8.9.8.4)
+                    // If compacted item contains a single entry with a key expanding to @id,
+                    // set compacted item to the result of using this algorithm recursively,
+                    // passing active context, item active property for active property, and a
+                    // map composed of the single entry for @id from expanded item for element.
+                    if (compactedItem.is_object() && compactedItem.size() == 1 &&
+                        ContextProcessor::expandIri(activeContext, compactedItem.begin().key(), false, true) == JsonLdConsts::ID) {
+                        json idOnly = json::object();
+                        idOnly[JsonLdConsts::ID] = expandedItem.at(JsonLdConsts::ID);
+                        compactedItem = compact(activeContext, &itemActiveProperty, idOnly, compactArrays, ordered);
+                    }
+                }
+
+                // 11.8.9.9)
+                // If map key is null, set it to the result of IRI compacting @none.
+                if (!mapKey.is_string())
+                    mapKey = compactIri(activeContext, JsonLdConsts::NONE);
+
+                // 11.8.9.10)
+                // Use add value to add compacted item to the map key entry in map object using
+                // as array.
+                JsonLdUtils::addValue(mapObject, mapKey.get<std::string>(), compactedItem, asArray);
+            }
+
+            // 11.8.10)
+            // Otherwise, use add value to add compacted item to the item active property entry
+            // in nest result using as array.
+            // Note: a JSON literal that is an array is added as a single value, not as the
+            // values it contains.
+            else if (compactedItem.is_array() && isJsonLiteral(activeContext, itemActiveProperty)) {
+                if (!asArray && !nestResult.contains(itemActiveProperty))
+                    nestResult[itemActiveProperty] = compactedItem;
+                else
+                    JsonLdUtils::addValue(nestResult, itemActiveProperty, json::array({compactedItem}), asArray);
+            }
+            else
+                JsonLdUtils::addValue(nestResult, itemActiveProperty, compactedItem, asArray);
+        }
+    }
+
+    // 12)
+    // Return result.
+    return result;
+}
+
+std::string CompactionProcessor::compactIri(
+        const Context & activeContext,
+        const std::string & var,
+        const json * value,
+        bool vocab,
+        bool reverse) {
+
+    // Comments in this function are labeled with numbers that correspond to sections
+    // from the description of the IRI Compaction algorithm.
+    // See: https://www.w3.org/TR/json-ld11-api/#iri-compaction
+
+    // 2)
+    // If the active context has a null inverse context, set inverse context in active
+    // context to the result of calling the Inverse Context Creation algorithm using active
+    // context.
+    // 3)
+    // Initialize inverse context to the value of inverse context in active context.
+    const InverseContext & inverseContext = activeContext.getInverseContext();
+
+    // 4)
+    // If vocab is true and var is an entry of inverse context:
+    if (vocab && inverseContext.contains(var)) {
+
+        // 4.1)
+        // Initialize default language based on the active context's default language,
+        // normalized to lower case and default base direction.
+        std::string defaultLanguage = JsonLdConsts::NONE;
+        if (activeContext.getDefaultBaseDirection() != "null")
+            defaultLanguage = toLower(activeContext.getDefaultLanguage() + "_" + activeContext.getDefaultBaseDirection());
+        else if (!activeContext.getDefaultLanguage().empty())
+            defaultLanguage = toLower(activeContext.getDefaultLanguage());
+
+        // 4.2)
+        // If value is a map containing an @preserve entry, use the first element from the
+        // value of @preserve as value.
+        if (value != nullptr && value->is_object() && value->contains(JsonLdConsts::PRESERVE)) {
+            const json & preserve = value->at(JsonLdConsts::PRESERVE);
+            value = !preserve.is_array() ? &preserve : preserve.empty() ? nullptr : &preserve.at(0);
+        }
+
+        bool valueIsMap = value != nullptr && value->is_object();
+        bool valueHasIndex = valueIsMap && value->contains(JsonLdConsts::INDEX);
+
+        // 4.3)
+        // Initialize containers to an empty array. This array will be used to keep track of
+        // an ordered list of preferred container mapping for a term, based on what is
+        // compatible with value.
+        std::vector<std::string> containers;
+
+        // 4.4)
+        // Initialize type/language to @language, and type/language value to @null. These
+        // two variables will keep track of the preferred type mapping or language mapping
+        // for a term, based on what is compatible with value.
+        InverseContext::Selector typeLanguage = InverseContext::Selector::Language;
+        std::string typeLanguageValue = JsonLdConsts::ATNULL;
+
+        // 4.5)
+        // If value is a map containing an @index entry, and value is not a graph object
+        // then append the values @index and @index@set to containers.
+        if (valueHasIndex && !JsonLdUtils::isGraphObject(*value)) {
+            containers.emplace_back("@index");
+            containers.emplace_back("@index@set");
+        }
+
+        // 4.6)
+        // If reverse is true, set type/language to @type, type/language value to @reverse,
+        // and append @set to containers.
+        if (reverse) {
+            typeLanguage = InverseContext::Selector::Type;
+            typeLanguageValue = JsonLdConsts::REVERSE;
+            containers.emplace_back("@set");
+        }
+
+        // 4.7)
+        // Otherwise, if value is a list object, then set type/language and type/language
+        // value to the most specific values that work for all items in the list as follows:
+        else if (valueIsMap && JsonLdUtils::isListObject(*value)) {
+
+            // 4.7.1)
+            // If @index is not an entry in value, then append @list to containers.
+            if (!valueHasIndex)
+                containers.emplace_back("@list");
+
+            // 4.7.2)
+            // Initialize list to the array associated with the @list entry in value.
+            const json & list = value->at(JsonLdConsts::LIST);
+
+            // 4.7.3)
+            // Initialize common type and common language to null. If list is empty, set
+            // common language to default language.
+            std::string commonType;
+            std::string commonLanguage;
+            if (list.empty())
+                commonLanguage = defaultLanguage;
+
+            // 4.7.4)
+            // For each item in list:
+            for (const auto & item : list) {
+
+                // 4.7.4.1)
+                // Initialize item language to @none and item type to @none.
+                std::string itemLanguage = JsonLdConsts::NONE;
+                std::string itemType = JsonLdConsts::NONE;
+
+                // 4.7.4.2)
+                // If item contains an @value entry, set item language from its @direction
+                // and @language entries, or item type from its @type entry, or item language
+                // to @null if it has none of them.
+                if (item.contains(JsonLdConsts::VALUE)) {
+                    if (item.contains(JsonLdConsts::DIRECTION) || item.contains(JsonLdConsts::LANGUAGE))
+                        itemLanguage = languageOf(item);
+                    else if (item.contains(JsonLdConsts::TYPE))
+                        itemType = item.at(JsonLdConsts::TYPE).get<std::string>();
+                    else
+                        itemLanguage = JsonLdConsts::ATNULL;
+                }
+
+                // 4.7.4.3)
+                // Otherwise, set item type to @id.
+                else
+                    itemType = JsonLdConsts::ID;
+
+                // 4.7.4.4-5)
+                // If common language is null, set common language to item language. Otherwise,
+                // if item language does not equal common language and item contains a @value
+                // entry, then set common language to @none because list items have conflicting
+                // languages.
+                if (commonLanguage.empty())
+                    commonLanguage = itemLanguage;
+                else if (itemLanguage != commonLanguage && item.contains(JsonLdConsts::VALUE))
+                    commonLanguage = JsonLdConsts::NONE;
+
+                // 4.7.4.6-7)
+                // If common type is null, set common type to item type. Otherwise, if item
+                // type does not equal common type, then set common type to @none because list
+                // items have conflicting types.
+                if (commonType.empty())
+                    commonType = itemType;
+                else if (itemType != commonType)
+                    commonType = JsonLdConsts::NONE;
+
+                // 4.7.4.8)
+                // If common language is @none and common type is @none, then stop processing
+                // items in the list because it has been detected that there is no common
+                // language or type amongst the items.
+                if (commonLanguage == JsonLdConsts::NONE && commonType == JsonLdConsts::NONE)
+                    break;
+            }
+
+            // 4.7.5)
+            // If common language is null, set common language to @none.
+            if (commonLanguage.empty())
+                commonLanguage = JsonLdConsts::NONE;
+
+            // 4.7.6)
+            // If common type is null, set common type to @none.
+            if (commonType.empty())
+                commonType = JsonLdConsts::NONE;
+
+            // 4.7.7-8)
+            // If common type is not @none then set type/language to @type and type/language
+            // value to common type. Otherwise, set type/language value to common language.
+            if (commonType != JsonLdConsts::NONE) {
+                typeLanguage = InverseContext::Selector::Type;
+                typeLanguageValue = commonType;
+            }
+            else
+                typeLanguageValue = commonLanguage;
+        }
+
+        // 4.8)
+        // Otherwise, if value is a graph object, prefer a mapping most appropriate for the
+        // particular value.
+        else if (valueIsMap && JsonLdUtils::isGraphObject(*value)) {
+            bool valueHasId = value->contains(JsonLdConsts::ID);
+
+            // 4.8.1)
+            // If value contains an @index entry, append the values @graph@index and
+            // @graph@index@set to containers.
+            if (valueHasIndex) {
+                containers.emplace_back("@graph@index");
+                containers.emplace_back("@graph@index@set");
+            }
+
+            // 4.8.2)
+            // If value contains an @id entry, append the values @graph@id and @graph@id@set
+            // to containers.
+            if (valueHasId) {
+                containers.emplace_back("@graph@id");
+                containers.emplace_back("@graph@id@set");
+            }
+
+            // 4.8.3)
+            // Append the values @graph, @graph@set, and @set to containers.
+            containers.emplace_back("@graph");
+            containers.emplace_back("@graph@set");
+            containers.emplace_back("@set");
+
+            // 4.8.4)
+            // If value does not contain an @index entry, append the values @graph@index and
+            // @graph@index@set to containers.
+            if (!valueHasIndex) {
+                containers.emplace_back("@graph@index");
+                containers.emplace_back("@graph@index@set");
+            }
+
+            // 4.8.5)
+            // If the value does not contain an @id entry, append the values @graph@id and
+            // @graph@id@set to containers.
+            if (!valueHasId) {
+                containers.emplace_back("@graph@id");
+                containers.emplace_back("@graph@id@set");
+            }
+
+            // 4.8.6)
+            // Append the values @index and @index@set to containers.
+            containers.emplace_back("@index");
+            containers.emplace_back("@index@set");
+
+            // 4.8.7)
+            // Set type/language to @type and set type/language value to @id.
+            typeLanguage = InverseContext::Selector::Type;
+            typeLanguageValue = JsonLdConsts::ID;
+        }
+
+        // 4.9)
+        // Otherwise:
+        else {
+
+            // 4.9.1)
+            // If value is a value object:
+            if (valueIsMap && value->contains(JsonLdConsts::VALUE)) {
+
+                // 4.9.1.1-2)
+                // If value has an @direction or @language entry and does not have an @index
+                // entry, then set type/language value to its language, normalized to lower
+                // case, and append @language and @language@set to containers.
+                if ((value->contains(JsonLdConsts::DIRECTION) || value->contains(JsonLdConsts::LANGUAGE)) &&
+                    !valueHasIndex) {
+                    typeLanguageValue = languageOf(*value);
+                    containers.emplace_back("@language");
+                    containers.emplace_back("@language@set");
+                }
+
+                // 4.9.1.3)
+                // Otherwise, if value has an @type entry, set type/language value to its
+                // associated value and set type/language to @type.
+                else if (value->contains(JsonLdConsts::TYPE)) {
+                    typeLanguage = InverseContext::Selector::Type;
+                    typeLanguageValue = value->at(JsonLdConsts::TYPE).get<std::string>();
+                }
+            }
+
+            // 4.9.2)
+            // Otherwise, set type/language to @type and set type/language value to @id, and
+            // append @id, @id@set, @type, and @set@type, to containers.
+            else {
+                typeLanguage = InverseContext::Selector::Type;
+                typeLanguageValue = JsonLdConsts::ID;
+                containers.emplace_back("@id");
+                containers.emplace_back("@id@set");
+                containers.emplace_back("@type");
+                containers.emplace_back("@set@type");
+            }
+
+            // 4.9.3)
+            // Append @set to containers.
+            containers.emplace_back("@set");
+        }
+
+        // 4.10)
+        // Append @none to containers. This represents the non-existence of a container
+        // mapping, and it will be the last container mapping value to be checked as it is
+        // the most generic.
+        containers.emplace_back(JsonLdConsts::NONE);
+
+        // 4.11)
+        // If processing mode is not json-ld-1.0 and value is either not a map or does not
+        // contain an @index entry, append @index and @index@set to containers.
+        bool jsonLd10 = activeContext.isProcessingMode(JsonLdConsts::JSON_LD_1_0);
+        if (!jsonLd10 && !valueHasIndex) {
+            containers.emplace_back("@index");
+            containers.emplace_back("@index@set");
+        }
+
+        // 4.12)
+        // If processing mode is not json-ld-1.0 and value is a map containing only an @value
+        // entry, append @language and @language@set to containers.
+        if (!jsonLd10 && valueIsMap && value->size() == 1 && value->contains(JsonLdConsts::VALUE)) {
+            containers.emplace_back("@language");
+            containers.emplace_back("@language@set");
+        }
+
+        // 4.13-14)
+        // Initialize preferred values to an empty array. This array will indicate, in order,
+        // the preferred values for a term's type mapping or language mapping. If
+        // type/language value is @null, it is used as is.
+        std::vector<std::string> preferredValues;
+
+        // 4.15)
+        // If type/language value is @reverse, append @reverse to preferred values.
+        if (typeLanguageValue == JsonLdConsts::REVERSE)
+            preferredValues.emplace_back(JsonLdConsts::REVERSE);
+
+        // 4.16)
+        // If type/language value is @id or @reverse and value is a map containing an @id
+        // entry:
+        if ((typeLanguageValue == JsonLdConsts::ID || typeLanguageValue == JsonLdConsts::REVERSE) &&
+            valueIsMap && value->contains(JsonLdConsts::ID)) {
+
+            // 4.16.1)
+            // If the result of IRI compacting the value of the @id entry in value has a term
+            // definition in the active context with an IRI mapping that equals the value of
+            // the @id entry in value, then append @vocab, @id, and @none, in that order, to
+            // preferred values.
+            const json & id = value->at(JsonLdConsts::ID);
+            bool idIsTerm = false;
+            if (id.is_string()) {
+                const json & termDefinition =
+                        activeContext.lookupTermDefinition(compactIri(activeContext, id.get<std::string>()));
+                idIsTerm = termDefinition.contains(JsonLdConsts::ID) && termDefinition.at(JsonLdConsts::ID) == id;
+            }
+            if (idIsTerm) {
+                preferredValues.emplace_back(JsonLdConsts::VOCAB);
+                preferredValues.emplace_back(JsonLdConsts::ID);
+                preferredValues.emplace_back(JsonLdConsts::NONE);
+            }
+
+            // 4.16.2)
+            // Otherwise, append @id, @vocab, and @none, in that order, to preferred values.
+            else {
+                preferredValues.emplace_back(JsonLdConsts::ID);
+                preferredValues.emplace_back(JsonLdConsts::VOCAB);
+                preferredValues.emplace_back(JsonLdConsts::NONE);
+            }
+        }
+
+        // 4.17)
+        // Otherwise, append type/language value and @none, in that order, to preferred values.
+        // If value is a list object with an empty array as the value of @list, set
+        // type/language to @any.
+        else {
+            preferredValues.push_back(typeLanguageValue);
+            preferredValues.emplace_back(JsonLdConsts::NONE);
+            if (valueIsMap && JsonLdUtils::isListObject(*value) && value->at(JsonLdConsts::LIST).empty())
+                typeLanguage = InverseContext::Selector::Any;
+        }
+
+        // 4.18)
+        // Append @any to preferred values.
+        preferredValues.emplace_back(JsonLdConsts::ANY);
+
+        // 4.19)
+        // If preferred values contains any entry having an underscore ("_"), append the
+        // substring of that entry from the underscore to the end of the string to preferred
+        // values.
+        for (std::size_t i = 0, size = preferredValues.size(); i < size; ++i) {
+            std::size_t underscore = preferredValues[i].find('_');
+            if (underscore != std::string::npos)
+                preferredValues.push_back(preferredValues[i].substr(underscore));
+        }
+
+        // 4.20-21)
+        // Initialize term to the result of the Term Selection algorithm, passing var,
+        // containers, type/language, and preferred values. If term is not null, return term.
+        const std::string * term = inverseContext.selectTerm(var, containers, typeLanguage, preferredValues);
+        if (term != nullptr)
+            return *term;
+    }
+
+    // 5)
+    // At this point, there is no simple term that var can be compacted to. If vocab is true
+    // and active context has a vocabulary mapping:
+    const std::string & vocabularyMapping = activeContext.getVocabularyMapping();
+    if (vocab && !vocabularyMapping.empty()) {
+
+        // 5.1)
+        // If var begins with the vocabulary mapping's value and its length is greater than
+        // the length of the vocabulary mapping, set suffix to the substring of var that does
+        // not match. If suffix does not have a term definition in active context, then
+        // return suffix.
+        if (var.size() > vocabularyMapping.size() &&
+            var.compare(0, vocabularyMapping.size(), vocabularyMapping) == 0) {
+            std::string suffix = var.substr(vocabularyMapping.size());
+            if (!activeContext.getTermDefinitions().contains(suffix))
+                return suffix;
+        }
+    }
+
+    // 6)
+    // The var could not be compacted using the active context's vocabulary mapping. Try to
+    // create a compact IRI, starting by initializing compact IRI to null. This variable will
+    // be used to store the created compact IRI, if any.
+    std::string compactIri;
+
+    // 7)
+    // For each term definition that may be used as a prefix:
+    for (const auto & prefix : inverseContext.getPrefixes()) {
+        const std::string & iriMapping = prefix.first;
+        const std::string & term = prefix.second;
+
+        // 7.1)
+        // If the IRI mapping equals var, the IRI mapping is not a substring at the beginning
+        // of var, or the term definition does not contain the prefix flag having a value of
+        // true, the term cannot be used as a prefix.
+        if (iriMapping == var || var.compare(0, iriMapping.size(), iriMapping) != 0)
+            continue;
+
+        // 7.2)
+        // Initialize candidate by concatenating term, a colon (:), and the substring of var
+        // that follows after the value of the term definition's IRI mapping.
+        std::string candidate = term + ":" + var.substr(iriMapping.size());
+
+        // 7.3)
+        // If either compact IRI is null, candidate is shorter or the same length but
+        // lexicographically less than compact IRI and candidate does not have a term
+        // definition in active context, or if that term definition has an IRI mapping that
+        // equals var and value is null, set compact IRI to candidate.
+        bool isShortest = compactIri.empty() || candidate.size() < compactIri.size() ||
+                          (candidate.size() == compactIri.size() && candidate < compactIri);
+        if (!isShortest)
+            continue;
+        if (!activeContext.getTermDefinitions().contains(candidate))
+            compactIri = candidate;
+        else if (value == nullptr) {
+            const json & candidateDefinition = activeContext.lookupTermDefinition(candidate);
+            if (candidateDefinition.contains(JsonLdConsts::ID) && candidateDefinition.at(JsonLdConsts::ID) == var)
+                compactIri = candidate;
+        }
+    }
+
+    // 8)
+    // If compact IRI is not null, return compact IRI.
+    if (!compactIri.empty())
+        return compactIri;
+
+    // 9)
+    // To ensure that the IRI var is not confused with a compact IRI, if the IRI scheme of
+    // var matches any term in active context with prefix flag set to true, and var has no
+    // IRI authority (preceded by double-forward-slash (//), an IRI confused with prefix
+    // error has been detected, and processing is aborted.
+    std::size_t colon = var.find(':');
+    if (colon != std::string::npos && var.compare(colon + 1, 2, "//") != 0) {
+        const json & termDefinition = activeContext.lookupTermDefinition(var.substr(0, colon));
+        if (termDefinition.contains(JsonLdConsts::IS_PREFIX_FLAG) &&
+            termDefinition.at(JsonLdConsts::IS_PREFIX_FLAG).get<bool>())
+            throw JsonLdError(JsonLdError::IriConfusedWithPrefix, var);
+    }
+
+    // 10)
+    // If vocab is false, transform var to a relative IRI reference using the base IRI from
+    // active context, if it exists.
+    if (!vocab && activeContext.getOptions().getCompactToRelative() && !activeContext.getBaseIri().empty())
+        return JsonLdUrl::removeBase(activeContext.getBaseIri(), var);
+
+    // 11)
+    // Finally, return var as is.
+    return var;
+}
@@ -0,0 +1,64 @@
+#ifndef LIBJSONLD_CPP_COMPACTIONPROCESSOR_H
+#define LIBJSONLD_CPP_COMPACTIONPROCESSOR_H
+
+#include <string>
+
+#include "jsonld-cpp/jsoninc.h"
+
+class Context;
+
+struct CompactionProcessor {
+
+    /**
+     * Compaction Algorithm
+     *
+     * This algorithm compacts a JSON-LD document, such that the given context is applied.
+     * This must result in shortening any applicable IRIs to terms or compact IRIs, any
+     * applicable keywords to keyword aliases, and any applicable JSON-LD values expressed
+     * in expanded form to simple values such as strings or numbers.
+     *
+     * https://www.w3.org/TR/json-ld11-api/#compaction-algorithm
+     *
+     * @param activeContext Currently active Context used to select terms.
+     * @param activeProperty Currently active property or keyword. Can be null.
+     * @param element The expanded element to be compacted.
+     * @param compactArrays If true, arrays with a single element are replaced by that element.
+     * @param ordered If true, the entries of each map are processed in lexicographical order.
+     * @return The compacted element.
+     */
+    static nlohmann::ordered_json compact(
+            Context activeContext,
+            const std::string *activeProperty,
+            const nlohmann::ordered_json & element,
+            bool compactArrays,
+            bool ordered);
+
+    /**
+     * IRI Compaction Algorithm
+     *
+     * Terms are selected using the inverse context of activeContext, which is built on
+     * first use and shared by all copies of activeContext.
+     *
+     * https://www.w3.org/TR/json-ld11-api/#iri-compaction
+     *
+     * @param activeContext Currently active Context used to select terms.
+     * @param var The IRI or keyword to be compacted.
+     * @param value The value associated with var, used to select a term. Can be null.
+     * @param vocab If true, var is compacted relative to the vocabulary mapping, otherwise
+     *              relative to the base IRI.
+     * @param reverse If true, var is compacted to a reverse property.
+     * @return The compacted IRI.
+     * @throws JsonLdError
+     *             If var could be confused with a compact IRI.
+     */
+    static std::string compactIri(
+            const Context & activeContext,
+            const std::string & var,
+            const nlohmann::ordered_json * value = nullptr,
+            bool vocab = true,
+            bool reverse = false);
+
+};
+
+
+#endif //LIBJSONLD_CPP_COMPACTIONPROCESSOR_H
@@ -8,6 +8,18 @@
 
 using json = nlohmann::ordered_json;
 
+namespace {
+
+    // Values such as node identifiers rarely repeat, so stop caching new IRI expansions
+    // once this many are cached for one combination of flags.
+    const std::size_t MAX_CACHED_EXPANDED_IRIS = 10000;
+
+    std::size_t expandedIriIndex(bool relative, bool vocab) {
+        return (relative ? 2 : 0) + (vocab ? 1 : 0);
+    }
+
+}
+
 bool Context::isReverseProperty(const std::string &property) const {
     auto td = getTermDefinition(property);
     if (td.is_null()) {
@@ -24,13 +36,20 @@ json Context::getTermDefinition(const std::string & key) const {
         return nullptr;
 }
 
+const json &Context::lookupTermDefinition(const std::string & key) const {
+    static const json noTermDefinition;
+    auto it = termDefinitions.find(key);
+    if(it != termDefinitions.end())
+        return *it;
+    return noTermDefinition;
+}
+
 
 Context::Context(const JsonLdOptions& options)
         : options(options)
 {
     setBaseIri(options.getBase());
     termDefinitions = json::object();
-    inverseContext = nullptr;
     previousContext = nullptr;
     defaultBaseDirection = "null";
 }
@@ -45,6 +64,7 @@ const std::string &Context::getBaseIri() const {
 
 void Context::setBaseIri(const std::string &baseIri) {
     baseIRI = baseIri;
+    clearExpandedIris();
 }
 
 const std::string &Context::getOriginalBaseUrl() const {
@@ -61,18 +81,25 @@ std::string Context::getDefaultBaseDirection() const {
 
 void Context::setDefaultBaseDirection(const std::string & direction) {
     defaultBaseDirection = direction;
+    clearInverseContext();
 }
 
 const JsonLdOptions &Context::getOptions() const {
     return options;
 }
 
+void Context::setOptions(const JsonLdOptions &ioptions) {
+    options = ioptions;
+    clearExpandedIris();
+}
+
 const std::string &Context::getDefaultLanguage() const {
     return defaultLanguage;
 }
 
 void Context::setDefaultLanguage(const std::string &idefaultLanguage) {
     defaultLanguage = idefaultLanguage;
+    clearInverseContext();
 }
 
 const std::string &Context::getVocabularyMapping() const {
@@ -81,6 +108,7 @@ const std::string &Context::getVocabularyMapping() const {
 
 void Context::setVocabularyMapping(const std::string &ivocabularyMapping) {
     vocabularyMapping = ivocabularyMapping;
+    clearExpandedIris();
 }
 
 const std::shared_ptr<Context> &Context::getPreviousContext() const {
@@ -91,18 +119,43 @@ void Context::setPreviousContext(const std::shared_ptr<Context> &previousContext
     Context::previousContext = previousContext;
 }
 
-const std::shared_ptr<Context> &Context::getInverseContext() const {
-    return inverseContext;
+const InverseContext &Context::getInverseContext() const {
+    if(inverseContext == nullptr)
+        inverseContext = std::make_shared<const InverseContext>(*this);
+    return *inverseContext;
 }
 
-void Context::setInverseContext(const std::shared_ptr<Context> &inverseContext) {
-    Context::inverseContext = inverseContext;
+void Context::clearInverseContext() {
+    inverseContext = nullptr;
 }
 
 json &Context::getTermDefinitions() {
+    clearExpandedIris();
+    clearInverseContext();
     return termDefinitions;
 }
 
 const json &Context::getTermDefinitions() const {
     return termDefinitions;
 }
+
+void Context::clearExpandedIris() {
+    // other copies of this Context may still use the cache, so only drop our reference
+    expandedIris.reset();
+}
+
+const std::string *Context::findExpandedIri(const std::string &value, bool relative, bool vocab) const {
+    if (!expandedIris)
+        return nullptr;
+    const ExpandedIriMap &map = (*expandedIris)[expandedIriIndex(relative, vocab)];
+    auto it = map.find(value);
+    return it == map.end() ? nullptr : &it->second;
+}
+
+void Context::cacheExpandedIri(const std::string &value, bool relative, bool vocab, const std::string &expandedIri) const {
+    if (!expandedIris)
+        expandedIris = std::make_shared<std::array<ExpandedIriMap, 4>>();
+    ExpandedIriMap &map = (*expandedIris)[expandedIriIndex(relative, vocab)];
+    if (map.size() < MAX_CACHED_EXPANDED_IRIS)
+        map.emplace(value, expandedIri);
+}
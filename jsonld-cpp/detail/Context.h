@@ -1,12 +1,15 @@
 #ifndef LIBJSONLD_CPP_CONTEXT_H
 #define LIBJSONLD_CPP_CONTEXT_H
 
+#include <array>
 #include <string>
 #include <memory>
+#include <unordered_map>
 
 #include "jsonld-cpp/jsoninc.h"
 #include "jsonld-cpp/JsonLdConsts.h"
 #include "jsonld-cpp/JsonLdOptions.h"
+#include "jsonld-cpp/detail/InverseContext.h"
 
 
 class Context {
@@ -24,7 +27,19 @@ private:
 
     std::string defaultBaseDirection;
     std::shared_ptr<Context> previousContext;
-    std::shared_ptr<Context> inverseContext;
+
+    // Built on first use by getInverseContext(). Copies of a Context share the inverse
+    // context until one of them changes its term definitions, default language or default
+    // base direction.
+    mutable std::shared_ptr<const InverseContext> inverseContext;
+
+    // Results of IRI expansion against this context, one map per combination of the
+    // relative and vocab flags. Copies of a Context share the cache until one of them
+    // changes its term definitions, base IRI or vocabulary mapping.
+    typedef std::unordered_map<std::string, std::string> ExpandedIriMap;
+    mutable std::shared_ptr<std::array<ExpandedIriMap, 4>> expandedIris;
+
+    void clearExpandedIris();
 
 
 public:
@@ -35,6 +50,13 @@ public:
 
     nlohmann::ordered_json getTermDefinition(const std::string & key) const;
 
+    /**
+     * Returns the term definition for key, or a null value if there is none. Unlike
+     * getTermDefinition(), the definition is not copied, so the reference is only valid
+     * until the term definitions of this context are changed.
+     */
+    const nlohmann::ordered_json &lookupTermDefinition(const std::string & key) const;
+
     bool isReverseProperty(const std::string& property) const;
     bool isProcessingMode(const std::string& mode) const;
 
@@ -55,19 +77,42 @@ public:
 
     void setPreviousContext(const std::shared_ptr<Context> &previousContext);
 
-    const std::shared_ptr<Context> &getInverseContext() const;
+    /**
+     * Returns the inverse context of this context, creating it if necessary. Creating it
+     * is not thread-safe, so a Context that is shared between threads should have its
+     * inverse context created before it is shared.
+     */
+    const InverseContext &getInverseContext() const;
 
-    void setInverseContext(const std::shared_ptr<Context> &inverseContext);
+    void clearInverseContext();
 
     std::string getDefaultBaseDirection() const;
 
     const JsonLdOptions &getOptions() const;
 
+    /**
+     * Replaces the options of this context. The IRI expansion cache is no longer shared
+     * with other copies of this context, so this copy may be used on another thread.
+     */
+    void setOptions(const JsonLdOptions &options);
+
     void setDefaultBaseDirection(const std::string & direction);
 
     const nlohmann::ordered_json &getTermDefinitions() const;
 
+    /**
+     * Returns the term definitions for modification. Clears the IRI expansion cache, so
+     * use the const overload when only reading.
+     */
     nlohmann::ordered_json &getTermDefinitions();
+
+    /**
+     * Returns the cached result of expanding value with the given flags, or nullptr if
+     * there is none.
+     */
+    const std::string * findExpandedIri(const std::string & value, bool relative, bool vocab) const;
+
+    void cacheExpandedIri(const std::string & value, bool relative, bool vocab, const std::string & expandedIri) const;
 };
 
 #endif //LIBJSONLD_CPP_CONTEXT_H
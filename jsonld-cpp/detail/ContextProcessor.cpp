@@ -1,17 +1,17 @@
 #include "jsonld-cpp/detail/ContextProcessor.h"
 
 #include <map>
-#include <set>
 #include <vector>
 #include <string>
-#include <iostream>
 #include <sstream>
 #include <algorithm>
 #include <memory>
 
 #include "jsonld-cpp/JsonLdError.h"
 #include "jsonld-cpp/JsonLdUrl.h"
+#include "jsonld-cpp/ProcessingStats.h"
 #include "jsonld-cpp/detail/JsonLdUtils.h"
+#include "jsonld-cpp/detail/Keyword.h"
 #include "jsonld-cpp/RemoteDocument.h"
 #include "jsonld-cpp/BlankNodeNames.h"
 #include "jsonld-cpp/detail/Uri.h"
@@ -24,8 +24,18 @@ namespace {
     // 1.1 spec provides for returning error if too many remote contexts are loaded
     const int MAX_REMOTE_CONTEXTS = 256;
 
+    // Loads the remote context at url with the DocumentLoader of activeContext. The load
+    // is counted and timed in the ProcessingStats of activeContext, if any.
+    std::unique_ptr<RemoteDocument> loadRemoteContext(const Context & activeContext, const std::string & url) {
+        ProcessingStats * stats = activeContext.getOptions().getProcessingStats();
+        ProcessingStats::PhaseTimer timer(stats, ProcessingStats::Phase::DocumentLoading);
+        if (stats != nullptr)
+            stats->add(ProcessingStats::Counter::RemoteContextLoads);
+        return activeContext.getOptions().getDocumentLoader()->loadDocument(url);
+    }
+
     std::string expandIri(Context & activeContext,
-                          std::string value, bool relative, bool vocab,
+                          const std::string & value, bool relative, bool vocab,
                           const json& localContext, std::map<std::string, bool> & defined);
 
     Context process(
@@ -127,7 +137,9 @@ namespace {
         else if (JsonLdUtils::isKeyword(term)) {
             throw JsonLdError(JsonLdError::KeywordRedefinition, term);
         } else if (JsonLdUtils::isKeywordForm(term)){
-            std::cerr << "Warning: term " << term << " should not have the form of a keyword.\n";
+            if(auto sink = activeContext.getOptions().getDiagnosticsSink())
+                sink->warning(DiagnosticsSink::Code::TermHasKeywordForm,
+                              "term " + term + " should not have the form of a keyword.");
             return;
         }
 
@@ -256,7 +268,9 @@ namespace {
             // a keyword (i.e., it matches the ABNF rule "@"1*ALPHA from [RFC5234]), return;
             // processors SHOULD generate a warning.
             if(JsonLdUtils::isKeywordForm(reverseStr)) {
-                std::cerr << "Warning: @reverse entry " << reverseStr << " should not have the form of a keyword.\n";
+                if(auto sink = activeContext.getOptions().getDiagnosticsSink())
+                    sink->warning(DiagnosticsSink::Code::ReverseHasKeywordForm,
+                                  "@reverse entry " + reverseStr + " should not have the form of a keyword.");
                 return;
             }
 
@@ -328,7 +342,9 @@ namespace {
                 // form of a keyword (i.e., it matches the ABNF rule "@"1*ALPHA from [RFC5234]),
                 // return; processors SHOULD generate a warning.
                 if(!JsonLdUtils::isKeyword(idStr) && JsonLdUtils::isKeywordForm(idStr)) {
-                    std::cerr << "Warning: @id entry " << idStr << " should not have the form of a keyword.\n";
+                    if(auto sink = activeContext.getOptions().getDiagnosticsSink())
+                        sink->warning(DiagnosticsSink::Code::IdHasKeywordForm,
+                                      "@id entry " + idStr + " should not have the form of a keyword.");
                     return;
                 }
 
@@ -641,7 +657,9 @@ namespace {
 
             if (language.is_null() || language.is_string()) {
                 if(language.is_string() && !WellFormed::language(language.get<std::string>())) {
-                    std::cerr << "Warning: language tag " << language << " is not well-formed.\n";
+                    if(auto sink = activeContext.getOptions().getDiagnosticsSink())
+                        sink->warning(DiagnosticsSink::Code::MalformedLanguageTag,
+                                      "language tag " + language.get<std::string>() + " is not well-formed.");
                 }
                 // 22.2)
                 // Set the language mapping of definition to language.
@@ -749,14 +767,23 @@ namespace {
         // If value contains any entry other than @id, @reverse, @container, @context,
         // @direction, @index, @language, @nest, @prefix, @protected, or @type, an invalid
         // term definition error has been detected and processing is aborted.
-        std::set<std::string> validKeywords {
-                JsonLdConsts::ID,JsonLdConsts::REVERSE,JsonLdConsts::CONTAINER,JsonLdConsts::CONTEXT,
-                JsonLdConsts::DIRECTION,JsonLdConsts::INDEX,JsonLdConsts::LANGUAGE,JsonLdConsts::NEST,
-                JsonLdConsts::PREFIX,JsonLdConsts::PROTECTED,JsonLdConsts::TYPE
-        };
         for (auto& el : value.items()) {
-            if(validKeywords.find(el.key()) == validKeywords.end())
-                throw JsonLdError(JsonLdError::InvalidTermDefinition,el.key() + " not in list of valid keywords");
+            switch (Keywords::classify(el.key())) {
+                case Keyword::Id:
+                case Keyword::Reverse:
+                case Keyword::Container:
+                case Keyword::Context:
+                case Keyword::Direction:
+                case Keyword::Index:
+                case Keyword::Language:
+                case Keyword::Nest:
+                case Keyword::Prefix:
+                case Keyword::Protected:
+                case Keyword::Type:
+                    break;
+                default:
+                    throw JsonLdError(JsonLdError::InvalidTermDefinition,el.key() + " not in list of valid keywords");
+            }
         }
 
         // 27)
@@ -784,6 +811,8 @@ namespace {
         // 28)
         activeContext.getTermDefinitions()[term] = definition;
         defined[term] = true;
+        if (auto stats = activeContext.getOptions().getProcessingStats())
+            stats->add(ProcessingStats::Counter::TermsDefined);
 
     }
 
@@ -805,7 +834,7 @@ namespace {
   * @throws JsonLdError
   */
     std::string expandIri(Context & activeContext,
-                          std::string value, bool relative, bool vocab,
+                          const std::string & value, bool relative, bool vocab,
                           const json& localContext, std::map<std::string, bool> & defined) {
 
         // Comments in this function are labeled with numbers that correspond to sections
@@ -822,7 +851,9 @@ namespace {
         //  If value has the form of a keyword (i.e., it matches the ABNF rule "@"1*ALPHA
         //  from [RFC5234]), a processor SHOULD generate a warning and return null.
         if (JsonLdUtils::isKeywordForm(value)) {
-            std::cerr << "Warning: IRI value " << value << " should not have the form of a keyword.\n";
+            if(auto sink = activeContext.getOptions().getDiagnosticsSink())
+                sink->warning(DiagnosticsSink::Code::IriHasKeywordForm,
+                              "IRI value " + value + " should not have the form of a keyword.");
             return "";
         }
 
@@ -841,11 +872,16 @@ namespace {
             }
         }
 
+        // Note: term definitions are only read from here on, so use the const overload
+        // of getTermDefinitions(), which leaves the IRI expansion cache intact.
+        const json & termDefinitions = static_cast<const Context &>(activeContext).getTermDefinitions();
+        auto tdIt = termDefinitions.find(value);
+
         // 4)
         // If active context has a term definition for value, and the associated IRI mapping
         // is a keyword, return that keyword.
-        if (activeContext.getTermDefinitions().contains(value)) {
-            auto td = activeContext.getTermDefinitions().at(value);
+        if (tdIt != termDefinitions.end()) {
+            const json & td = *tdIt;
             if (!td.is_null() &&
                 td.contains(JsonLdConsts::ID) &&
                 JsonLdUtils::isKeyword(td.at(JsonLdConsts::ID).get<std::string>()))
@@ -855,8 +891,8 @@ namespace {
         // 5)
         // If vocab is true and the active context has a term definition for value, return the
         // associated IRI mapping.
-        if (vocab && activeContext.getTermDefinitions().contains(value)) {
-            auto td = activeContext.getTermDefinitions().at(value);
+        if (vocab && tdIt != termDefinitions.end()) {
+            const json & td = *tdIt;
             if (!td.is_null() &&
                 td.contains(JsonLdConsts::ID))
                 return td.at(JsonLdConsts::ID).get<std::string>();
@@ -895,8 +931,10 @@ namespace {
             // If active context contains a term definition for prefix having a non-null IRI mapping
             // and the prefix flag of the term definition is true, return the result of concatenating
             // the IRI mapping associated with prefix and suffix.
-            if (activeContext.getTermDefinitions().contains(prefix)) {
-                auto prefixDef = activeContext.getTermDefinitions().at(prefix);
+            const json & prefixDefinitions = static_cast<const Context &>(activeContext).getTermDefinitions();
+            auto prefixIt = prefixDefinitions.find(prefix);
+            if (prefixIt != prefixDefinitions.end()) {
+                const json & prefixDef = *prefixIt;
                 if (prefixDef.contains(JsonLdConsts::ID) &&
                     prefixDef.contains(JsonLdConsts::IS_PREFIX_FLAG) &&
                     prefixDef.at(JsonLdConsts::IS_PREFIX_FLAG)) {
@@ -955,7 +993,7 @@ namespace {
         // 1)
         // Initialize result to the result of cloning active context, with inverse context set to null.
         Context result = activeContext;
-        result.setInverseContext(nullptr);
+        result.clearInverseContext();
 
         // 2)
         // If local context is an object containing the member @propagate, its value MUST be
@@ -1083,7 +1121,7 @@ namespace {
                 }
                 std::unique_ptr<RemoteDocument> rd;
                 try {
-                    rd = activeContext.getOptions().getDocumentLoader()->loadDocument(contextUri);
+                    rd = loadRemoteContext(activeContext, contextUri);
                     if (rd == nullptr)
                         throw JsonLdError(JsonLdError::LoadingRemoteContextFailed, "Document is null");
                 }
@@ -1193,7 +1231,7 @@ namespace {
                 }
                 std::unique_ptr<RemoteDocument> rd;
                 try {
-                    rd = activeContext.getOptions().getDocumentLoader()->loadDocument(importUri);
+                    rd = loadRemoteContext(activeContext, importUri);
                     if (rd == nullptr)
                         throw JsonLdError(JsonLdError::LoadingRemoteContextFailed, "Document is null");
                 }
@@ -1328,7 +1366,9 @@ namespace {
                     std::transform(v.begin(), v.end(), v.begin(), &::tolower);
                     result.setDefaultLanguage(v);
                     if(!WellFormed::language(v)) {
-                        std::cerr << "Warning: language tag " << v << " is not well-formed.\n";
+                        if(auto sink = result.getOptions().getDiagnosticsSink())
+                            sink->warning(DiagnosticsSink::Code::MalformedLanguageTag,
+                                          "language tag " + v + " is not well-formed.");
                     }
                 } else {
                     throw JsonLdError(JsonLdError::InvalidDefaultLanguage);
@@ -1421,15 +1461,29 @@ ContextProcessor::process(
         bool propagate,
         bool validateScopedContext) {
 
+    ProcessingStats::PhaseTimer timer(activeContext.getOptions().getProcessingStats(),
+                                      ProcessingStats::Phase::ContextProcessing);
     std::vector<std::string> remoteContexts;
     return ::process(activeContext, localContext, baseURL, remoteContexts,
                    overrideProtected, propagate, validateScopedContext);
 }
 
-std::string ContextProcessor::expandIri(Context & activeContext, std::string value, bool relative, bool vocab) {
+std::string ContextProcessor::expandIri(const Context & activeContext, const std::string & value, bool relative, bool vocab) {
+    // Without a local context, the result only depends on the active context, so it can
+    // be cached in it.
+    if (const std::string * cached = activeContext.findExpandedIri(value, relative, vocab))
+        return *cached;
+
     // dummy objects
     json j;
     std::map<std::string, bool> m;
-    return ::expandIri(activeContext, std::move(value), relative, vocab, j, m);
+    // Note: without a local context, IRI expansion never creates term definitions, so
+    // activeContext is not modified.
+    std::string result = ::expandIri(const_cast<Context &>(activeContext), value, relative, vocab, j, m);
+    // values having the form of a keyword are not cached, so that every occurrence
+    // still reaches the diagnostics sink
+    if (!result.empty() || !JsonLdUtils::isKeywordForm(value))
+        activeContext.cacheExpandedIri(value, relative, vocab, result);
+    return result;
 }
 
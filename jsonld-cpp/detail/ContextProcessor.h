@@ -30,11 +30,14 @@ struct ContextProcessor {
       *
       * https://www.w3.org/TR/json-ld11-api/#iri-expansion
       *
+      * Results are cached in activeContext, keyed by value, relative and vocab, until
+      * activeContext is modified.
+      *
       * @return the expanded Iri
       * @throws JsonLdError
       *             If there is an error expanding the IRI.
       */
-    static std::string expandIri(Context & activeContext, std::string value, bool relative, bool vocab);
+    static std::string expandIri(const Context & activeContext, const std::string & value, bool relative, bool vocab);
 
 };
 
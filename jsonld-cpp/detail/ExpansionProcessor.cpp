@@ -1,16 +1,16 @@
 #include "jsonld-cpp/detail/ExpansionProcessor.h"
 
-#include <set>
 #include <vector>
 #include <string>
-#include <iostream>
 #include <sstream>
 #include <algorithm>
 #include <memory>
 
 #include "jsonld-cpp/detail/Context.h"
 #include "jsonld-cpp/detail/JsonLdUtils.h"
+#include "jsonld-cpp/detail/Keyword.h"
 #include "jsonld-cpp/JsonLdError.h"
+#include "jsonld-cpp/ProcessingStats.h"
 #include "jsonld-cpp/detail/ContextProcessor.h"
 #include "jsonld-cpp/detail/WellFormed.h"
 
@@ -18,11 +18,152 @@ using json = nlohmann::ordered_json;
 
 namespace {
 
+    /**
+     * The keys of an element, together with their IRI expansion against the active context.
+     * Steps 7, 11 and 13 of the Expansion algorithm all need the expanded keys, so each key
+     * is expanded once and shared until the active context changes, at which point clear()
+     * must be called.
+     *
+     * The keys point into element, which must outlive the ElementKeys. An ElementKeys can
+     * be reset() to the keys of another element, which reuses its buffers.
+     */
+    class ElementKeys {
+    private:
+        std::vector<const std::string *> keys;
+        std::vector<std::string> expandedKeys;
+        std::vector<bool> isExpanded;
+        std::vector<std::size_t> order;
+
+    public:
+        ElementKeys() = default;
+
+        void reset(const json &element) {
+            keys.clear();
+            for (auto it = element.begin(); it != element.end(); ++it)
+                keys.push_back(&it.key());
+            if (expandedKeys.size() < keys.size())
+                expandedKeys.resize(keys.size());
+            isExpanded.assign(keys.size(), false);
+        }
+
+        std::size_t size() const {
+            return keys.size();
+        }
+
+        const std::string &key(std::size_t i) const {
+            return *keys[i];
+        }
+
+        /**
+         * Returns the result of IRI expanding key i against activeContext, which must be
+         * the same active context as for previous calls since the last clear().
+         */
+        const std::string &expandedKey(std::size_t i, const Context &activeContext) {
+            if (!isExpanded[i]) {
+                expandedKeys[i] = ContextProcessor::expandIri(activeContext, *keys[i], false, true);
+                isExpanded[i] = true;
+            }
+            return expandedKeys[i];
+        }
+
+        void clear() {
+            isExpanded.assign(keys.size(), false);
+        }
+
+        /**
+         * Returns the key indexes, ordered lexicographically by key if ordered is true. The
+         * result is overwritten by the next call.
+         */
+        const std::vector<std::size_t> &indexes(bool ordered) {
+            order.resize(keys.size());
+            for (std::size_t i = 0; i < order.size(); i++)
+                order[i] = i;
+            if (ordered)
+                std::sort(order.begin(), order.end(), [this](std::size_t lhs, std::size_t rhs) {
+                    return *keys[lhs] < *keys[rhs];
+                });
+            return order;
+        }
+    };
+
+    /**
+     * Scratch buffers shared by all the elements expanded during one call of
+     * ExpansionProcessor::expand(). Each object element borrows an ElementKeys for as long
+     * as it is being expanded. Borrowing follows the recursion, so the ElementKeys are kept
+     * in a stack, one per nesting level, and their buffers are reused by the next element
+     * at the same level instead of being allocated again.
+     */
+    class ExpansionWorkspace {
+    private:
+        std::vector<std::unique_ptr<ElementKeys>> elementKeys;
+        std::size_t elementKeysInUse = 0;
+
+    public:
+        /**
+         * Borrows an ElementKeys from a workspace, reset to the keys of element, and gives
+         * it back when destroyed.
+         */
+        class BorrowedElementKeys {
+        private:
+            ExpansionWorkspace &workspace;
+            ElementKeys &keys;
+
+        public:
+            BorrowedElementKeys(ExpansionWorkspace &workspace, const json &element)
+                    : workspace(workspace), keys(workspace.borrowElementKeys()) {
+                keys.reset(element);
+            }
+
+            BorrowedElementKeys(const BorrowedElementKeys&) = delete;
+            BorrowedElementKeys& operator=(const BorrowedElementKeys&) = delete;
+
+            ~BorrowedElementKeys() {
+                workspace.elementKeysInUse--;
+            }
+
+            ElementKeys &get() {
+                return keys;
+            }
+        };
+
+    private:
+        ElementKeys &borrowElementKeys() {
+            if (elementKeysInUse == elementKeys.size())
+                elementKeys.emplace_back(new ElementKeys());
+            return *elementKeys[elementKeysInUse++];
+        }
+    };
+
+    json expandElement(
+            const Context & activeContext,
+            const std::string * activeProperty,
+            const json & element,
+            const std::string & baseUrl,
+            bool fromMap,
+            ExpansionWorkspace & workspace);
+
     bool arrayContains(const json &array, const std::string &value) {
         return array.is_array() && std::find(array.cbegin(), array.cend(), value) != array.end();
     }
 
-    std::string findInputType(Context &activeContext, Context &typeScopedContext, json &element) {
+    // Only strings can be language-tagged. A frame may instead hold an array of strings
+    // and empty maps to match against.
+    bool isLanguageTaggable(const json &value, bool frameExpansion) {
+        if (value.is_string())
+            return true;
+        if (!frameExpansion || !value.is_array())
+            return false;
+        return std::all_of(value.cbegin(), value.cend(), [](const json &v) {
+            return v.is_string() || JsonLdUtils::isEmptyObject(v);
+        });
+    }
+
+    /**
+     * Finds the input type of element. If a type has a type-scoped context, activeContext is
+     * set to point at the result of processing it, which is held in typeScopedActiveContext.
+     */
+    std::string findInputType(const Context *&activeContext, const Context &typeScopedContext, Context &typeScopedActiveContext,
+                              const json &element, ElementKeys &elementKeys) {
 
         // Comments in this function are labeled with numbers that correspond to sections
         // from the description of the Expansion algorithm.
@@ -34,14 +175,10 @@ namespace {
         // 11)
         // For each key and value in element ordered lexicographically by key where key
         // IRI expands to @type:
-        std::vector<std::string> element_keys;
-        for (json::iterator it = element.begin(); it != element.end(); ++it) {
-            element_keys.push_back(it.key());
-        }
-        std::sort(element_keys.begin(), element_keys.end());
-        for (auto & key : element_keys) {
+        for (std::size_t i : elementKeys.indexes(true)) {
 
-            std::string expandedKey = ContextProcessor::expandIri(activeContext, key, false, true);
+            const std::string & key = elementKeys.key(i);
+            const std::string & expandedKey = elementKeys.expandedKey(i, *activeContext);
 
             if (expandedKey != JsonLdConsts::TYPE)
                 continue;
@@ -70,16 +207,19 @@ namespace {
             std::sort(terms.begin(), terms.end());
 
             for (auto &term : terms) {
-                if (typeScopedContext.getTermDefinition(term).contains(JsonLdConsts::LOCALCONTEXT)) {
-                    auto termValue = activeContext.getTermDefinition(term);
-                    auto localContext = typeScopedContext.getTermDefinition(term).at(JsonLdConsts::LOCALCONTEXT);
+                const json &typeScopedTermDefinition = typeScopedContext.lookupTermDefinition(term);
+                if (typeScopedTermDefinition.contains(JsonLdConsts::LOCALCONTEXT)) {
+                    auto termValue = activeContext->getTermDefinition(term);
+                    const json &localContext = typeScopedTermDefinition.at(JsonLdConsts::LOCALCONTEXT);
                     if(termValue.contains(JsonLdConsts::BASEURL))
-                        activeContext = ContextProcessor::process(activeContext, localContext,
-                                                                  termValue.at(JsonLdConsts::BASEURL).get<std::string>(),
-                                                                  false, false);
+                        typeScopedActiveContext = ContextProcessor::process(*activeContext, localContext,
+                                                                            termValue.at(JsonLdConsts::BASEURL).get<std::string>(),
+                                                                            false, false);
                     else
-                        activeContext = ContextProcessor::process(activeContext, localContext, "",
-                                                                  false, false);
+                        typeScopedActiveContext = ContextProcessor::process(*activeContext, localContext, "",
+                                                                            false, false);
+                    activeContext = &typeScopedActiveContext;
+                    elementKeys.clear();
                 }
             }
         }
@@ -108,21 +248,21 @@ namespace {
             }
 
             if(!lastValue.empty()) {
-                inputType = ContextProcessor::expandIri(activeContext, lastValue, false, true);
+                inputType = ContextProcessor::expandIri(*activeContext, lastValue, false, true);
             }
         }
 
         return inputType;
     }
 
-    json expandValue(Context &activeContext, const std::string & activeProperty, const json& value)  {
+    json expandValue(const Context &activeContext, const std::string & activeProperty, const json& value)  {
 
         // Comments in this function are labeled with numbers that correspond to sections
         // from the description of the Value Expansion algorithm.
         // See: https://www.w3.org/TR/json-ld11-api/#value-expansion
 
         json result;
-        json termDefinition = activeContext.getTermDefinition(activeProperty);
+        const json &termDefinition = activeContext.lookupTermDefinition(activeProperty);
 
         if(termDefinition.contains(JsonLdConsts::TYPE)) {
 
@@ -204,11 +344,12 @@ namespace {
     }
 
     json expandArrayElement(
-            Context activeContext,
+            const Context &activeContext,
             const std::string * activeProperty,
             const json& element,
             const std::string & baseUrl,
-            bool fromMap) {
+            bool fromMap,
+            ExpansionWorkspace &workspace) {
 
         // Comments in this function are labeled with numbers that correspond to sections
         // from the description of the Expansion algorithm.
@@ -225,17 +366,17 @@ namespace {
             // Initialize expanded item to the result of using this algorithm recursively, passing
             // active context, active property, item as element, base URL, the frameExpansion,
             // ordered, and from map flags.
-            json expandedItem = ExpansionProcessor::expand(activeContext, activeProperty, item, baseUrl, fromMap);
+            json expandedItem = expandElement(activeContext, activeProperty, item, baseUrl, fromMap, workspace);
 
             // 5.2.2)
             // If the container mapping of active property includes @list, and expanded item is
             // an array, set expanded item to a new map containing the entry @list where the value
             // is the original expanded item.
             if(activeProperty != nullptr) {
-                auto termDefinition = activeContext.getTermDefinition(*activeProperty);
+                const json &termDefinition = activeContext.lookupTermDefinition(*activeProperty);
                 if (!termDefinition.empty()) {
                     if (termDefinition.contains(JsonLdConsts::CONTAINER)) {
-                        auto containerMapping = termDefinition[JsonLdConsts::CONTAINER];
+                        const json &containerMapping = termDefinition.at(JsonLdConsts::CONTAINER);
                         if (arrayContains(containerMapping, JsonLdConsts::LIST) &&
                             expandedItem.is_array())
                             expandedItem = json::object({{JsonLdConsts::LIST, expandedItem}});
@@ -259,51 +400,53 @@ namespace {
     }
 
     std::unique_ptr<json>
-    initializePropertyScopedContext(Context &activeContext, const std::string *activeProperty) {
+    initializePropertyScopedContext(const Context &activeContext, const std::string *activeProperty) {
         // 3)
         // If active property has a term definition in active context with a local
         // context, initialize property-scoped context to that local context.
+        // Note: the local context is copied, since the active context may change before
+        // it is used.
         std::unique_ptr<json> propertyScopedContext;
-        if(activeProperty != nullptr &&
-           !activeContext.getTermDefinition(*activeProperty).is_null() &&
-           activeContext.getTermDefinition(*activeProperty).contains(JsonLdConsts::LOCALCONTEXT) ) {
-            propertyScopedContext.reset(new json(activeContext.getTermDefinition(*activeProperty)[JsonLdConsts::LOCALCONTEXT]));
+        if(activeProperty != nullptr) {
+            const json &termDefinition = activeContext.lookupTermDefinition(*activeProperty);
+            if(termDefinition.contains(JsonLdConsts::LOCALCONTEXT))
+                propertyScopedContext.reset(new json(termDefinition.at(JsonLdConsts::LOCALCONTEXT)));
         }
         return propertyScopedContext;
     }
 
-    Context &
-    updateActiveContext(Context &activeContext, const std::string *activeProperty, const json *propertyScopedContext) {
+    Context
+    updateActiveContext(const Context &activeContext, const std::string *activeProperty, const json *propertyScopedContext) {
         // 8)
         // If property-scoped context is defined, set active context to the result of the
         // Context Processing algorithm, passing active context, property-scoped context as
         // local context, base URL from the term definition for active property in active
         // context and true for override protected.
-        auto termDef = activeContext.getTermDefinition(*activeProperty);
+        const json &termDef = activeContext.lookupTermDefinition(*activeProperty);
         std::string termsBaseUrl;
         if(termDef.contains(JsonLdConsts::BASEURL))
-            termsBaseUrl = termDef[JsonLdConsts::BASEURL].get<std::string>();
-        activeContext = ContextProcessor::process(activeContext, *propertyScopedContext, termsBaseUrl, true);
-        return activeContext;
+            termsBaseUrl = termDef.at(JsonLdConsts::BASEURL).get<std::string>();
+        return ContextProcessor::process(activeContext, *propertyScopedContext, termsBaseUrl, true);
     }
 
     void expandObjectElement_step13(
-            const std::string *activeProperty, const json &element, const std::string &baseUrl,
-            Context &typeScopedContext, const std::string &inputType, Context &activeContext, json &result,
-            json &nests);
+            const std::string *activeProperty, const json &element, ElementKeys &elementKeys,
+            const std::string &baseUrl, const Context &typeScopedContext, const std::string &inputType,
+            const Context &activeContext, json &result, json &nests, ExpansionWorkspace &workspace);
 
     void expandObjectElement_step14(
-            Context &activeContext, const json &element,
-            const std::string &baseUrl, Context &typeScopedContext, json &result,
-            json &nests, const std::string &inputType);
+            const Context &activeContext, const json &element,
+            const std::string &baseUrl, const Context &typeScopedContext, json &result,
+            json &nests, const std::string &inputType, ExpansionWorkspace &workspace);
 
     json expandObjectElement(
-            Context activeContext,
+            const Context & callerActiveContext,
             const std::string * activeProperty,
-            json element,
+            const json & element,
             const std::string & baseUrl,
             json * propertyScopedContext,
-            bool fromMap) {
+            bool fromMap,
+            ExpansionWorkspace & workspace) {
 
         // Comments in this function are labeled with numbers that correspond to sections
         // from the description of the Expansion algorithm.
@@ -315,17 +458,24 @@ namespace {
         // @value, and element does not consist of a single entry expanding to @id (where entries
         // are IRI expanded, set active context to previous context from active context, as the
         // scope of a term-scoped context does not apply when processing new node objects.
-        if(activeContext.getPreviousContext() != nullptr && !fromMap) {
+        // Note: the expanded keys are shared with steps 11 and 13, and are cleared
+        // whenever active context changes.
+        ExpansionWorkspace::BorrowedElementKeys borrowedKeys(workspace, element);
+        ElementKeys &elementKeys = borrowedKeys.get();
 
-            bool usePrevious = true;
-            std::vector<std::string> element_keys;
-            for (json::iterator it = element.begin(); it != element.end(); ++it) {
-                element_keys.push_back(it.key());
-            }
+        // Note: the active context of the caller is used as is until a step below replaces
+        // it. Only steps 8, 9 and 11 create a new context, which is held in replacedContext
+        // or typeScopedActiveContext. The previous context is shared, so step 7 copies nothing.
+        const Context * activeContext = &callerActiveContext;
+        Context replacedContext;
+        Context typeScopedActiveContext;
 
-            for (auto & key : element_keys) {
+        if(activeContext->getPreviousContext() != nullptr && !fromMap) {
 
-                std::string expandedKey = ContextProcessor::expandIri(activeContext, key, false, true);
+            bool usePrevious = true;
+            for (std::size_t i = 0; i < elementKeys.size(); i++) {
+
+                const std::string & expandedKey = elementKeys.expandedKey(i, *activeContext);
 
                 if(expandedKey == JsonLdConsts::VALUE ||
                    (element.size() == 1 && expandedKey == JsonLdConsts::ID)) {
@@ -333,8 +483,10 @@ namespace {
                     break;
                 }
             }
-            if(usePrevious)
-                activeContext = * activeContext.getPreviousContext();
+            if(usePrevious) {
+                activeContext = activeContext->getPreviousContext().get();
+                elementKeys.clear();
+            }
 
         }
 
@@ -344,7 +496,9 @@ namespace {
         // local context, base URL from the term definition for active property in active
         // context and true for override protected.
         if(propertyScopedContext != nullptr) {
-            activeContext = updateActiveContext(activeContext, activeProperty, propertyScopedContext);
+            replacedContext = updateActiveContext(*activeContext, activeProperty, propertyScopedContext);
+            activeContext = &replacedContext;
+            elementKeys.clear();
         }
 
         // 9)
@@ -352,16 +506,18 @@ namespace {
         // Context Processing algorithm, passing active context, the value of the @context entry
         // as local context and base URL.
         if (element.contains(JsonLdConsts::CONTEXT)) {
-            activeContext = ContextProcessor::process(activeContext, element[JsonLdConsts::CONTEXT], baseUrl);
+            replacedContext = ContextProcessor::process(*activeContext, element[JsonLdConsts::CONTEXT], baseUrl);
+            activeContext = &replacedContext;
+            elementKeys.clear();
         }
 
         // 10)
         // Initialize type-scoped context to active context. This is used for expanding values
         // that may be relevant to any previous type-scoped context.
-        Context typeScopedContext = activeContext;
+        const Context & typeScopedContext = *activeContext;
 
         // 11) [Find input type...] For each key and value in element [...]
-        std::string inputType = findInputType(activeContext, typeScopedContext, element);
+        std::string inputType = findInputType(activeContext, typeScopedContext, typeScopedActiveContext, element, elementKeys);
 
         // 12)
         // Initialize two empty maps, result and nests.
@@ -370,12 +526,12 @@ namespace {
 
         // 13)
         // For each key and value in element, ordered lexicographically by key if ordered is true:
-        expandObjectElement_step13(activeProperty, element, baseUrl, typeScopedContext, inputType, activeContext, result, nests);
+        expandObjectElement_step13(activeProperty, element, elementKeys, baseUrl, typeScopedContext, inputType, *activeContext, result, nests, workspace);
 
         // 14)
         // For each key nesting-key in nests, ordered lexicographically if ordered is true:
-        expandObjectElement_step14(activeContext, element, baseUrl, typeScopedContext, result,
-                                   nests, inputType);
+        expandObjectElement_step14(*activeContext, element, baseUrl, typeScopedContext, result,
+                                   nests, inputType, workspace);
 
         // 15)
         // If result contains the entry @value:
@@ -386,13 +542,17 @@ namespace {
             // @type, and @value. It must not contain an @type entry if it contains either
             // @language or @direction entries. Otherwise, an invalid value object error has
             // been detected and processing is aborted.
-            std::set<std::string> validKeywords {
-                    JsonLdConsts::DIRECTION,JsonLdConsts::INDEX,JsonLdConsts::LANGUAGE,
-                    JsonLdConsts::TYPE,JsonLdConsts::VALUE
-            };
             for (auto& el : result.items()) {
-                if(validKeywords.find(el.key()) == validKeywords.end())
-                    throw JsonLdError(JsonLdError::InvalidValueObject,el.key() + " not in list of valid keywords");
+                switch (Keywords::classify(el.key())) {
+                    case Keyword::Direction:
+                    case Keyword::Index:
+                    case Keyword::Language:
+                    case Keyword::Type:
+                    case Keyword::Value:
+                        break;
+                    default:
+                        throw JsonLdError(JsonLdError::InvalidValueObject,el.key() + " not in list of valid keywords");
+                }
             }
             if(result.contains(JsonLdConsts::TYPE) &&
                (result.contains(JsonLdConsts::LANGUAGE) || result.contains(JsonLdConsts::DIRECTION))) {
@@ -415,7 +575,9 @@ namespace {
                 // Otherwise, if the value of result's @value entry is not a string and result
                 // contains the entry @language, an invalid language-tagged value error has been
                 // detected (only strings can be language-tagged) and processing is aborted.
-                else if(!result[JsonLdConsts::VALUE].is_string() && result.contains(JsonLdConsts::LANGUAGE))
+                // When the frameExpansion flag is set, @value is an array of value patterns.
+                else if(result.contains(JsonLdConsts::LANGUAGE) && !isLanguageTaggable(
+                        result[JsonLdConsts::VALUE], activeContext->getOptions().isFrameExpansion()))
                     throw JsonLdError(JsonLdError::InvalidLanguageTaggedValue);
 
                 // 15.5)
@@ -478,34 +640,32 @@ namespace {
             // 19.2)
             // Otherwise, if result is a map whose only entry is @id, set result to null. When the
             // frameExpansion flag is set, a map containing only the @id entry is retained.
-            else if (!result.is_null() && !activeContext.getOptions().isFrameExpansion() && result.contains(JsonLdConsts::ID)
+            else if (!result.is_null() && !activeContext->getOptions().isFrameExpansion() && result.contains(JsonLdConsts::ID)
                      && result.size() == 1) {
                 result = json();
             }
         }
 
         // 20)
+        // Note: node objects are counted in the ProcessingStats of the options, if any.
+        if (result.is_object() && !result.contains(JsonLdConsts::VALUE) && !result.contains(JsonLdConsts::LIST)) {
+            if (auto stats = activeContext->getOptions().getProcessingStats())
+                stats->add(ProcessingStats::Counter::NodesExpanded);
+        }
         return result;
     }
 
-    void expandObjectElement_step13(const std::string *activeProperty, const json &element, const std::string &baseUrl,
-             Context &typeScopedContext, const std::string &inputType, Context &activeContext, json &result,
-             json &nests) {
+    void expandObjectElement_step13(const std::string *activeProperty, const json &element, ElementKeys &elementKeys,
+             const std::string &baseUrl, const Context &typeScopedContext, const std::string &inputType,
+             const Context &activeContext, json &result, json &nests, ExpansionWorkspace &workspace) {
 
         // 13)
         // For each key and value in element, ordered lexicographically by key if ordered is true:
+        for (std::size_t i : elementKeys.indexes(activeContext.getOptions().isOrdered())) {
 
-        std::vector<std::string> element_keys;
-        for (json::const_iterator it = element.begin(); it != element.end(); ++it) {
-            element_keys.push_back(it.key());
-        }
+            const std::string & key = elementKeys.key(i);
 
-        if(activeContext.getOptions().isOrdered())
-            std::sort(element_keys.begin(), element_keys.end());
-
-        for (auto & key : element_keys) {
-
-            auto element_value = element[key];
+            const json &element_value = element[key];
 
             // 13.1)
             // If key is @context, continue to the next key.
@@ -515,7 +675,8 @@ namespace {
 
             // 13.2)
             // Initialize expanded property to the result of IRI expanding key.
-            std::string expandedProperty = ContextProcessor::expandIri(activeContext, key, false, true);
+            std::string expandedProperty = elementKeys.expandedKey(i, activeContext);
+            Keyword keyword = Keywords::classify(expandedProperty);
 
             // 13.3)
             // If expanded property is null or it neither contains a colon (:) nor it is a
@@ -523,7 +684,7 @@ namespace {
             if (
                     expandedProperty.empty() ||
                     !(expandedProperty.find(':') != std::string::npos ||
-                      JsonLdUtils::isKeyword(expandedProperty))) {
+                      keyword != Keyword::NotAKeyword)) {
                 continue;
             }
 
@@ -531,7 +692,7 @@ namespace {
 
             // 13.4)
             // If expanded property is a keyword:
-            if (JsonLdUtils::isKeyword(expandedProperty)) {
+            if (keyword != Keyword::NotAKeyword) {
                 // 13.4.1)
                 // If active property equals @reverse, an invalid reverse property map error
                 // has been detected and processing is aborted.
@@ -548,13 +709,13 @@ namespace {
                         throw JsonLdError(JsonLdError::CollidingKeywords,
                                           expandedProperty + " already exists in result");
                     }
-                    if(expandedProperty != JsonLdConsts::INCLUDED && expandedProperty != JsonLdConsts::TYPE)
+                    if(keyword != Keyword::Included && keyword != Keyword::Type)
                         throw JsonLdError(JsonLdError::CollidingKeywords,
                                           expandedProperty + " already exists in result");
                 }
                 // 13.4.3)
                 // If expanded property is @id:
-                if (expandedProperty == JsonLdConsts::ID) {
+                if (keyword == Keyword::Id) {
                     // 13.4.3.2)
                     // [If expanded property is a string], set expanded value to the result of
                     // IRI expanding value using true for document relative and false for
@@ -593,7 +754,7 @@ namespace {
                 }
                 // 13.4.4)
                 // If expanded property is @type:
-                else if (expandedProperty == JsonLdConsts::TYPE) {
+                else if (keyword == Keyword::Type) {
                     // 13.4.4.1)
                     // If value is neither a string nor an array of strings, an invalid type
                     // value error has been detected and processing is aborted. When the
@@ -677,15 +838,15 @@ namespace {
                 // this algorithm recursively passing active context, @graph for active
                 // property, value for element, base URL, and the frameExpansion and ordered
                 // flags, ensuring that expanded value is an array of one or more maps.
-                else if (expandedProperty == JsonLdConsts::GRAPH) {
-                    expandedValue = ExpansionProcessor::expand(activeContext, &expandedProperty, element_value, baseUrl);
+                else if (keyword == Keyword::Graph) {
+                    expandedValue = expandElement(activeContext, &expandedProperty, element_value, baseUrl, false, workspace);
                     if(!expandedValue.is_array()) {
                         expandedValue = json::array({expandedValue});
                     }
                 }
                 // 13.4.6)
                 // If expanded property is @included:
-                else if (expandedProperty == JsonLdConsts::INCLUDED) {
+                else if (keyword == Keyword::Included) {
                     // 13.4.6.1)
                     // If processing mode is json-ld-1.0, continue with the next key from element.
                     if (activeContext.isProcessingMode(JsonLdConsts::JSON_LD_1_0)) {
@@ -695,7 +856,7 @@ namespace {
                     // Set expanded value to the result of using this algorithm recursively passing
                     // active context, null for active property, value for element, base URL, and the
                     // frameExpansion and ordered flags, ensuring that the result is an array.
-                    expandedValue = ExpansionProcessor::expand(activeContext, nullptr, element_value, baseUrl);
+                    expandedValue = expandElement(activeContext, nullptr, element_value, baseUrl, false, workspace);
                     if(!expandedValue.is_array()) {
                         expandedValue = json::array({expandedValue});
                     }
@@ -729,7 +890,7 @@ namespace {
                 }
                 // 13.4.7)
                 // If expanded property is @value
-                else if (expandedProperty == JsonLdConsts::VALUE) {
+                else if (keyword == Keyword::Value) {
                     // 13.4.7.1)
                     // If input type is @json, set expanded value to value. If processing mode
                     // is json-ld-1.0, an invalid value object value error has been detected and
@@ -772,7 +933,7 @@ namespace {
                 }
                 // 13.4.8)
                 // If expanded property is @language:
-                else if (expandedProperty == JsonLdConsts::LANGUAGE) {
+                else if (keyword == Keyword::Language) {
                     // 13.4.8.1)
                     // If value is not a string, an invalid language-tagged string error has been
                     // detected and processing is aborted. When the frameExpansion flag is set, value
@@ -787,19 +948,30 @@ namespace {
                         //  warning. When the frameExpansion flag is set, expanded value will
                         //  be an array of one or more string values or an array containing
                         //  an empty map.
-                        std::string v = element_value.get<std::string>();
-                        if(!WellFormed::language(v)) {
-                            std::cerr << "Warning: language tag " << v << " is not well-formed.\n";
+                        expandedValue = json::array();
+                        for (const auto & language : element_value.is_array() ? element_value : json::array({element_value})) {
+                            if (!language.is_string()) {
+                                expandedValue.push_back(language);
+                                continue;
+                            }
+                            std::string v = language.get<std::string>();
+                            if(!WellFormed::language(v)) {
+                                if(auto sink = activeContext.getOptions().getDiagnosticsSink())
+                                    sink->warning(DiagnosticsSink::Code::MalformedLanguageTag,
+                                                  "language tag " + v + " is not well-formed.");
+                            }
+                            std::transform(v.begin(), v.end(), v.begin(), &tolower);
+                            expandedValue.push_back(v);
                         }
-                        std::transform(v.begin(), v.end(), v.begin(), &tolower);
-                        expandedValue = v;
+                        if (!activeContext.getOptions().isFrameExpansion())
+                            expandedValue = expandedValue.at(0);
                     } else {
                         throw JsonLdError(JsonLdError::InvalidLanguageTaggedString);
                     }
                 }
                 // 13.4.9)
                 // If expanded property is @direction:
-                else if (expandedProperty == JsonLdConsts::DIRECTION) {
+                else if (keyword == Keyword::Direction) {
                     // 13.4.9.1)
                     // If processing mode is json-ld-1.0, continue with the next key from element.
                     if (activeContext.isProcessingMode(JsonLdConsts::JSON_LD_1_0)) {
@@ -829,7 +1001,7 @@ namespace {
                 }
                 // 13.4.10)
                 // If expanded property is @index:
-                else if (expandedProperty == JsonLdConsts::INDEX) {
+                else if (keyword == Keyword::Index) {
                     // 13.4.10.1
                     // If value is not a string, an invalid @index value error has been detected
                     // and processing is aborted.
@@ -842,7 +1014,7 @@ namespace {
                 }
                 // 13.4.11)
                 // If expanded property is @list:
-                else if (expandedProperty == JsonLdConsts::LIST) {
+                else if (keyword == Keyword::List) {
                     // 13.4.11.1)
                     // If active property is null or @graph, continue with the next key from
                     // element to remove the free-floating list.
@@ -854,7 +1026,7 @@ namespace {
                     // recursively passing active context, active property, value for element, base
                     // URL, and the frameExpansion and ordered flags, ensuring that the result is
                     // an array.
-                    expandedValue = ExpansionProcessor::expand(activeContext, activeProperty, element_value, baseUrl);
+                    expandedValue = expandElement(activeContext, activeProperty, element_value, baseUrl, false, workspace);
                     if (!expandedValue.is_array()) {
                         expandedValue = json::array({expandedValue});
                     }
@@ -863,12 +1035,12 @@ namespace {
                 // If expanded property is @set, set expanded value to the result of using this
                 // algorithm recursively, passing active context, active property, value for
                 // element, base URL, and the frameExpansion and ordered flags.
-                else if (expandedProperty == JsonLdConsts::SET) {
-                    expandedValue = ExpansionProcessor::expand(activeContext, activeProperty, element_value, baseUrl);
+                else if (keyword == Keyword::Set) {
+                    expandedValue = expandElement(activeContext, activeProperty, element_value, baseUrl, false, workspace);
                 }
                 // 13.4.13)
                 // If expanded property is @reverse:
-                else if (expandedProperty == JsonLdConsts::REVERSE) {
+                else if (keyword == Keyword::Reverse) {
                     // 13.4.13.1)
                     // If value is not a map, an invalid @reverse value error has been detected and
                     // processing is aborted.
@@ -882,7 +1054,7 @@ namespace {
                     // element, base URL, and the frameExpansion and ordered flags.
                     {
                         std::string currentProperty = JsonLdConsts::REVERSE;
-                        expandedValue = ExpansionProcessor::expand(activeContext, &currentProperty, element_value, baseUrl);
+                        expandedValue = expandElement(activeContext, &currentProperty, element_value, baseUrl, false, workspace);
                     }
                     // 13.4.13.3)
                     // If expanded value contains an @reverse entry, i.e., properties that are
@@ -936,7 +1108,7 @@ namespace {
                 // 13.4.14)
                 // If expanded property is @nest, add key to nests, initializing it to an empty
                 // array, if necessary. Continue with the next key from element.
-                if (expandedProperty == JsonLdConsts::NEST) {
+                if (keyword == Keyword::Nest) {
                     if (!nests.contains(key)) {
                         nests[key] = json::array();
                     }
@@ -950,19 +1122,22 @@ namespace {
                 // active context, active property, value for element, base URL, and the
                 // frameExpansion and ordered flags.
                 if (activeContext.getOptions().isFrameExpansion() &&
-                    (expandedProperty == JsonLdConsts::DEFAULT ||
-                     expandedProperty == JsonLdConsts::EMBED ||
-                     expandedProperty == JsonLdConsts::EXPLICIT ||
-                     expandedProperty == JsonLdConsts::OMIT_DEFAULT ||
-                     expandedProperty == JsonLdConsts::REQUIRE_ALL)) {
-                    expandedValue = ExpansionProcessor::expand(activeContext, activeProperty, element_value, baseUrl);
+                    (keyword == Keyword::Default ||
+                     keyword == Keyword::Embed ||
+                     keyword == Keyword::Explicit ||
+                     keyword == Keyword::OmitDefault ||
+                     keyword == Keyword::RequireAll)) {
+                    // Note: expanded property is passed as active property, so that a
+                    // scalar value is expanded to a value object instead of being dropped as
+                    // a free-floating scalar at the top level of a frame.
+                    expandedValue = expandElement(activeContext, &expandedProperty, element_value, baseUrl, false, workspace);
                 }
 
                 // 13.4.16)
                 // Unless expanded value is null, expanded property is @value, and input type is
                 // not @json, set the expanded property entry of result to expanded value.
                 if (!(expandedValue.is_null()) ||
-                    (expandedProperty == JsonLdConsts::VALUE && inputType != JsonLdConsts::JSON)) {
+                    (keyword == Keyword::Value && inputType != JsonLdConsts::JSON)) {
                     // note: setting null instead of empty string, since expandIRI might return that
                     if(expandedValue.is_string() && expandedValue.get<std::string>().empty())
                         result[expandedProperty] = nullptr;
@@ -977,11 +1152,11 @@ namespace {
 
             // 13.5)
             // Initialize container mapping to key's container mapping in active context.
-            auto keyTermDefinition = activeContext.getTermDefinition(key);
+            const json &keyTermDefinition = activeContext.lookupTermDefinition(key);
 
             json containerMapping;
             if(keyTermDefinition.contains(JsonLdConsts::CONTAINER)) {
-                containerMapping = keyTermDefinition[JsonLdConsts::CONTAINER];
+                containerMapping = keyTermDefinition.at(JsonLdConsts::CONTAINER);
             }
 
             // 13.6)
@@ -1013,7 +1188,7 @@ namespace {
                 // For each key-value pair language-language value in value, ordered
                 // lexicographically by language if ordered is true:
                 std::vector<std::string> value_keys;
-                for (json::iterator it = element_value.begin(); it != element_value.end(); ++it) {
+                for (json::const_iterator it = element_value.begin(); it != element_value.end(); ++it) {
                     value_keys.push_back(it.key());
                 }
 
@@ -1059,7 +1234,9 @@ namespace {
                         // say "If language is neither..."
                         // See https://github.com/w3c/json-ld-api/issues/563
                         if(language != JsonLdConsts::NONE && !WellFormed::language(language)) {
-                            std::cerr << "Warning: language tag " << language << " is not well-formed.\n";
+                            if(auto sink = activeContext.getOptions().getDiagnosticsSink())
+                                sink->warning(DiagnosticsSink::Code::MalformedLanguageTag,
+                                              "language tag " + language + " is not well-formed.");
                         }
 
                         // 13.7.4.2.4)
@@ -1116,11 +1293,14 @@ namespace {
                     // 13.8.3.1)
                     // If container mapping includes @id or @type, initialize map context to the previous context
                     // from active context if it exists, otherwise, set map context to active context.
-                    Context mapContext = activeContext;
+                    // Note: map context only needs a context of its own when 13.8.3.2 processes
+                    // a local context; otherwise it refers to an existing context.
+                    const Context * mapContext = &activeContext;
+                    Context processedMapContext;
                     if(arrayContains(containerMapping, JsonLdConsts::TYPE) ||
                        arrayContains(containerMapping, JsonLdConsts::ID)) {
                         if(activeContext.getPreviousContext())
-                            mapContext = *activeContext.getPreviousContext();
+                            mapContext = activeContext.getPreviousContext().get();
                     }
 
                     // 13.8.3.2)
@@ -1130,17 +1310,18 @@ namespace {
                     // value of the index's local context as local context and base URL from
                     // the term definition for index in map context.
                     if(arrayContains(containerMapping, JsonLdConsts::TYPE)) {
-                        auto indexTermDefinition = mapContext.getTermDefinition(index);
+                        auto indexTermDefinition = mapContext->getTermDefinition(index);
                         if(indexTermDefinition.contains(JsonLdConsts::LOCALCONTEXT)) {
-                            mapContext = ContextProcessor::process(mapContext,
+                            processedMapContext = ContextProcessor::process(*mapContext,
                                     indexTermDefinition.at(JsonLdConsts::LOCALCONTEXT),
                                     indexTermDefinition.at(JsonLdConsts::BASEURL).get<std::string>());
+                            mapContext = &processedMapContext;
                         }
                     }
                     // 13.8.3.3)
                     // Otherwise, set map context to active context.
                     else
-                        mapContext = activeContext;
+                        mapContext = &activeContext;
 
                     // 13.8.3.4)
                     // Initialize expanded index to the result of IRI expanding index.
@@ -1157,7 +1338,7 @@ namespace {
                     // Initialize index value to the result of using this algorithm recursively,
                     // passing map context as active context, key as active property, index value
                     // as element, base URL, true for from map, and the frameExpansion and ordered flags.
-                    indexValue = ExpansionProcessor::expand(mapContext, &key, indexValue, baseUrl, true);
+                    indexValue = expandElement(*mapContext, &key, indexValue, baseUrl, true, workspace);
 
                     // 13.8.3.7)
                     // For each item in index value:
@@ -1261,7 +1442,7 @@ namespace {
             // recursively, passing active context, key for active property, value for element,
             // base URL, and the frameExpansion and ordered flags.
             else {
-                expandedValue = ExpansionProcessor::expand(activeContext, &key, element_value, baseUrl);
+                expandedValue = expandElement(activeContext, &key, element_value, baseUrl, false, workspace);
             }
 
             // 13.10)
@@ -1356,9 +1537,9 @@ namespace {
         }
     }
 
-    void expandObjectElement_step14(Context &activeContext, const json &element,
-                                    const std::string &baseUrl, Context &typeScopedContext, json &result,
-                                    json &nests, const std::string &inputType) {
+    void expandObjectElement_step14(const Context &activeContext, const json &element,
+                                    const std::string &baseUrl, const Context &typeScopedContext, json &result,
+                                    json &nests, const std::string &inputType, ExpansionWorkspace &workspace) {
         // 14)
         // For each key nesting-key in nests, ordered lexicographically if ordered is true:
         std::vector<std::string> nestKeys;
@@ -1390,8 +1571,10 @@ namespace {
                     throw JsonLdError(JsonLdError::InvalidNestValue);
                 }
 
-                for(const auto& el : nestedValue.items()) {
-                    if(ContextProcessor::expandIri(activeContext, el.key(), false, true) == JsonLdConsts::VALUE)
+                ExpansionWorkspace::BorrowedElementKeys borrowedKeys(workspace, nestedValue);
+                ElementKeys &nestedKeys = borrowedKeys.get();
+                for(std::size_t i = 0; i < nestedKeys.size(); i++) {
+                    if(nestedKeys.expandedKey(i, activeContext) == JsonLdConsts::VALUE)
                         throw JsonLdError(JsonLdError::InvalidNestValue);
                 }
 
@@ -1404,12 +1587,14 @@ namespace {
                 // associated with nesting-key. Updates to active context are restricted to the
                 // recursive operation, and do not propagate to subsequent iterations on nested
                 // values and nesting-key.
-                Context copyActiveContext = activeContext;
+                // Note: the active context is only copied when step 8 replaces it.
+                const Context * nestedActiveContext = &activeContext;
+                Context propertyScopedActiveContext;
 
                 // 3)
                 // If active property has a term definition in active context with a local
                 // context, initialize property-scoped context to that local context.
-                std::unique_ptr<json> localPropertyScopedContext = initializePropertyScopedContext(copyActiveContext, &nestingKey);
+                std::unique_ptr<json> localPropertyScopedContext = initializePropertyScopedContext(activeContext, &nestingKey);
 
                 // 8)
                 // If property-scoped context is defined, set active context to the result of the
@@ -1417,88 +1602,105 @@ namespace {
                 // local context, base URL from the term definition for active property in active
                 // context and true for override protected.
                 if(localPropertyScopedContext != nullptr) {
-                    copyActiveContext = updateActiveContext(copyActiveContext, &nestingKey, localPropertyScopedContext.get());
+                    propertyScopedActiveContext = updateActiveContext(activeContext, &nestingKey, localPropertyScopedContext.get());
+                    nestedActiveContext = &propertyScopedActiveContext;
+                    nestedKeys.clear();
                 }
 
                 json localNests = json::object();
 
                 // 13)
                 // For each key and value in element, ordered lexicographically by key if ordered is true:
-                expandObjectElement_step13(&nestingKey, nestedValue, baseUrl, typeScopedContext, inputType, copyActiveContext, result, localNests);
+                expandObjectElement_step13(&nestingKey, nestedValue, nestedKeys, baseUrl, typeScopedContext, inputType, *nestedActiveContext, result, localNests, workspace);
 
                 // 14)
                 // For each key nesting-key in nests, ordered lexicographically if ordered is true:
-                expandObjectElement_step14(copyActiveContext, nestedValue, baseUrl, typeScopedContext, result,
-                                           localNests, inputType);
+                expandObjectElement_step14(*nestedActiveContext, nestedValue, baseUrl, typeScopedContext, result,
+                                           localNests, inputType, workspace);
 
             }
         }
     }
 
-}
-
-json ExpansionProcessor::expand(
-        Context activeContext,
-        const std::string *activeProperty,
-        json element,
-        const std::string &baseUrl,
-        bool fromMap)
-{
-    // Comments in this function are labeled with numbers that correspond to sections
-    // from the description of the Expansion algorithm.
-    // See: https://www.w3.org/TR/json-ld11-api/#expansion-algorithm
-
-    // 1)
-    // If element is null, return null.
-    if (element.is_null()) {
-        return element;
-    }
+    json expandElement(
+            const Context & activeContext,
+            const std::string * activeProperty,
+            const json & element,
+            const std::string & baseUrl,
+            bool fromMap,
+            ExpansionWorkspace & workspace) {
+        // Comments in this function are labeled with numbers that correspond to sections
+        // from the description of the Expansion algorithm.
+        // See: https://www.w3.org/TR/json-ld11-api/#expansion-algorithm
 
-    // 2)
-    // If active property is @default, initialize the frameExpansion flag to false.
-    if (activeProperty != nullptr && *activeProperty == JsonLdConsts::DEFAULT) {
-    }
+        // 1)
+        // If element is null, return null.
+        if (element.is_null()) {
+            return element;
+        }
 
-    // 3)
-    // If active property has a term definition in active context with a local
-    // context, initialize property-scoped context to that local context.
-    std::unique_ptr<json> propertyScopedContext = initializePropertyScopedContext(activeContext, activeProperty);
-
-    // 5)
-    // If element is an array
-    if(element.is_array())
-        return expandArrayElement(activeContext, activeProperty, element, baseUrl, fromMap);
-    // 6)
-    // [If] element is a map.
-    else if(element.is_object())
-        return expandObjectElement(activeContext, activeProperty, element, baseUrl, propertyScopedContext.get(), fromMap);
-    // 4)
-    // [else] element is a scalar
-    else
-    {
-        // 4.1)
-        // If active property is null or @graph, drop the free-floating scalar by returning null.
-        if (activeProperty == nullptr || *activeProperty == JsonLdConsts::GRAPH) {
-            return {};
+        // 2)
+        // If active property is @default, initialize the frameExpansion flag to false.
+        if (activeProperty != nullptr && *activeProperty == JsonLdConsts::DEFAULT) {
         }
 
-        // 4.2)
-        // If property-scoped context is defined, set active context to the result of the
-        // Context Processing algorithm, passing active context, property-scoped context
-        // as local context, and base URL from the term definition for active property in
-        // active context.
-        if(propertyScopedContext != nullptr) {
-            auto termDef = activeContext.getTermDefinition(*activeProperty);
-            std::string termsBaseUrl;
-            if(termDef.contains(JsonLdConsts::BASEURL))
-                termsBaseUrl = termDef[JsonLdConsts::BASEURL].get<std::string>();
-            activeContext = ContextProcessor::process(activeContext, *propertyScopedContext, termsBaseUrl);
+        // 3)
+        // If active property has a term definition in active context with a local
+        // context, initialize property-scoped context to that local context.
+        std::unique_ptr<json> propertyScopedContext = initializePropertyScopedContext(activeContext, activeProperty);
+
+        // 5)
+        // If element is an array
+        if(element.is_array())
+            return expandArrayElement(activeContext, activeProperty, element, baseUrl, fromMap, workspace);
+        // 6)
+        // [If] element is a map.
+        else if(element.is_object())
+            return expandObjectElement(activeContext, activeProperty, element, baseUrl, propertyScopedContext.get(), fromMap, workspace);
+        // 4)
+        // [else] element is a scalar
+        else
+        {
+            // 4.1)
+            // If active property is null or @graph, drop the free-floating scalar by returning null.
+            if (activeProperty == nullptr || *activeProperty == JsonLdConsts::GRAPH) {
+                return {};
+            }
+
+            // 4.2)
+            // If property-scoped context is defined, set active context to the result of the
+            // Context Processing algorithm, passing active context, property-scoped context
+            // as local context, and base URL from the term definition for active property in
+            // active context.
+            if(propertyScopedContext != nullptr) {
+                const json &termDef = activeContext.lookupTermDefinition(*activeProperty);
+                std::string termsBaseUrl;
+                if(termDef.contains(JsonLdConsts::BASEURL))
+                    termsBaseUrl = termDef.at(JsonLdConsts::BASEURL).get<std::string>();
+                Context propertyScopedActiveContext =
+                        ContextProcessor::process(activeContext, *propertyScopedContext, termsBaseUrl);
+                return expandValue(propertyScopedActiveContext, *activeProperty, element);
+            }
+
+            // 4.3)
+            // Return the result of the Value Expansion algorithm, passing the active
+            // context, active property, and element as value.
+            return expandValue(activeContext, *activeProperty, element);
         }
 
-        // 4.3)
-        // Return the result of the Value Expansion algorithm, passing the active
-        // context, active property, and element as value.
-        return expandValue(activeContext, *activeProperty, element);
     }
 
 }
+
+json ExpansionProcessor::expand(
+        const Context & activeContext,
+        const std::string *activeProperty,
+        const json & element,
+        const std::string &baseUrl,
+        bool fromMap)
+{
+    ProcessingStats::PhaseTimer timer(activeContext.getOptions().getProcessingStats(),
+                                      ProcessingStats::Phase::Expansion);
+    ExpansionWorkspace workspace;
+    return expandElement(activeContext, activeProperty, element, baseUrl, fromMap, workspace);
+}
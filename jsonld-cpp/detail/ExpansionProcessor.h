@@ -27,9 +27,9 @@ struct ExpansionProcessor {
      * @return Fully expanded JSON-LD document.
      */
     static nlohmann::ordered_json expand(
-            Context activeContext,
+            const Context & activeContext,
             const std::string *activeProperty,
-            nlohmann::ordered_json element,
+            const nlohmann::ordered_json & element,
             const std::string & baseUrl,
             bool fromMap=false);
 
@@ -0,0 +1,90 @@
+#include "jsonld-cpp/detail/FlatteningProcessor.h"
+
+#include "jsonld-cpp/JsonLdConsts.h"
+#include "jsonld-cpp/detail/NodeMap.h"
+
+using json = nlohmann::ordered_json;
+
+namespace {
+
+    // a node that only has an @id entry adds no information to the flattened output
+    bool hasOnlyId(const nlohmann::json & node) {
+        return node.size() == 1 && node.contains(JsonLdConsts::ID);
+    }
+
+    json nodesOf(const nlohmann::json & graph) {
+        json nodes = json::array();
+        for (const auto & node : graph) {
+            if (!hasOnlyId(node))
+                nodes.push_back(node);
+        }
+        return nodes;
+    }
+
+}
+
+json FlatteningProcessor::flatten(const NodeMap & nodeMap) {
+
+    // Comments in this function are labeled with numbers that correspond to sections
+    // from the description of the Flattening algorithm.
+    // See: https://www.w3.org/TR/json-ld11-api/#flattening-algorithm
+
+    // 1-2)
+    // Initialize node map to a map consisting of a single member whose key is @default and
+    // whose value is an empty map, and invoke the Node Map Generation algorithm.
+    // Note: done by the caller, see NodeMap::add().
+    const nlohmann::json & graphs = nodeMap.getGraphs();
+
+    // 3)
+    // Initialize default graph to the value of the @default entry of node map, which is a
+    // map representing the default graph.
+    const nlohmann::json & defaultGraph = graphs.at(JsonLdConsts::DEFAULT);
+
+    // 4)
+    // For each key-value pair graph name-graph in node map where graph name is not
+    // @default, ordered lexicographically by graph name if ordered is true, add an entry
+    // to default graph for graph name, if there is none, and set its @graph entry to the
+    // nodes of graph.
+    // Note: the node map is not modified, as it may still be used to deserialize the
+    // document to RDF. Instead, the @graph entries are added below, when the nodes of the
+    // default graph are copied to the flattened output.
+    nlohmann::json namedGraphNodes = nlohmann::json::object();
+    for (auto it = graphs.begin(); it != graphs.end(); ++it) {
+        if (it.key() == JsonLdConsts::DEFAULT)
+            continue;
+        if (!defaultGraph.contains(it.key()))
+            namedGraphNodes[it.key()] = {{JsonLdConsts::ID, it.key()}};
+    }
+
+    // 5)
+    // Initialize an empty array flattened.
+    json flattened = json::array();
+
+    // 6)
+    // For each id and node in default graph ordered lexicographically by id if ordered is
+    // true, add node to flattened, unless the only entry of node is @id.
+    auto defaultIt = defaultGraph.begin();
+    auto namedIt = namedGraphNodes.begin();
+    while (defaultIt != defaultGraph.end() || namedIt != namedGraphNodes.end()) {
+        const nlohmann::json * node;
+        if (namedIt == namedGraphNodes.end() ||
+            (defaultIt != defaultGraph.end() && defaultIt.key() < namedIt.key()))
+            node = &*defaultIt++;
+        else
+            node = &*namedIt++;
+
+        const std::string & id = node->at(JsonLdConsts::ID).get_ref<const std::string &>();
+        auto graph = graphs.find(id);
+        if (id != JsonLdConsts::DEFAULT && graph != graphs.end()) {
+            json entry = *node;
+            entry[JsonLdConsts::GRAPH] = nodesOf(*graph);
+            flattened.push_back(std::move(entry));
+        }
+        else if (!hasOnlyId(*node))
+            flattened.push_back(*node);
+    }
+
+    // 7)
+    // Return flattened.
+    return flattened;
+}
@@ -0,0 +1,34 @@
+#ifndef LIBJSONLD_CPP_FLATTENINGPROCESSOR_H
+#define LIBJSONLD_CPP_FLATTENINGPROCESSOR_H
+
+#include "jsonld-cpp/jsoninc.h"
+
+class NodeMap;
+
+struct FlatteningProcessor {
+
+    /**
+     * Flattening Algorithm
+     *
+     * This algorithm flattens an expanded JSON-LD document by collecting all properties
+     * of a node in a single map and labeling all blank nodes with blank node identifiers.
+     * This results in a flat document where all nodes of the default graph are top-level
+     * and the nodes of each named graph are listed under the @graph entry of the node
+     * naming that graph.
+     *
+     * The node map generation step of the algorithm is done by the caller, so that the
+     * same node map can also be used to deserialize the document to RDF. The nodes of a
+     * node map are always held in lexicographical order of their identifiers, so the
+     * output is the ordered output of the algorithm.
+     *
+     * https://www.w3.org/TR/json-ld11-api/#flattening-algorithm
+     *
+     * @param nodeMap The node map of the expanded document.
+     * @return The flattened document, in expanded form.
+     */
+    static nlohmann::ordered_json flatten(const NodeMap & nodeMap);
+
+};
+
+
+#endif //LIBJSONLD_CPP_FLATTENINGPROCESSOR_H
@@ -0,0 +1,916 @@
+#include "jsonld-cpp/detail/FramingProcessor.h"
+
+#include <algorithm>
+#include <string>
+#include <unordered_map>
+#include <unordered_set>
+#include <utility>
+#include <vector>
+
+#include "jsonld-cpp/JsonLdConsts.h"
+#include "jsonld-cpp/JsonLdError.h"
+#include "jsonld-cpp/JsonLdOptions.h"
+#include "jsonld-cpp/detail/JsonLdUtils.h"
+#include "jsonld-cpp/detail/NodeMap.h"
+
+using json = nlohmann::ordered_json;
+
+namespace {
+
+    // Nodes of a graph are referenced by their identifier, pointing into the node map,
+    // which is not modified while framing.
+    typedef std::vector<const std::string *> NodeIds;
+
+    // Indexes of the nodes of one graph, used to select the nodes that could match a frame.
+    // The nodes in each list are in lexicographical order of their identifiers.
+    struct GraphIndex {
+        std::unordered_map<std::string, NodeIds> byType;
+        NodeIds typed;
+        std::unordered_map<std::string, NodeIds> byProperty;
+
+        // for each node identifier, the nodes referencing it and the properties they
+        // reference it with, built only when a frame has an @reverse entry
+        bool hasReferences = false;
+        std::unordered_map<std::string, std::vector<std::pair<const std::string *, const std::string *>>> referencedBy;
+    };
+
+    struct Flags {
+        std::string embed;
+        bool explicitInclusion;
+        bool requireAll;
+    };
+
+    struct FramingState {
+        const JsonLdOptions & options;
+        const nlohmann::json & graphMap;
+        bool useIndexes = true;
+        nlohmann::json mergedGraph;
+        std::unordered_map<std::string, GraphIndex> indexes;
+
+        // nodes being embedded, to detect circular references
+        std::vector<std::pair<std::string, std::string>> subjectStack;
+
+        // for each graph name, the identifiers of the nodes already embedded
+        std::unordered_map<std::string, std::unordered_set<std::string>> uniqueEmbeds;
+
+        // number of times each blank node identifier is used in the output
+        std::unordered_map<std::string, std::size_t> blankNodeUsages;
+
+        FramingState(const JsonLdOptions & options, const nlohmann::json & graphMap)
+                : options(options), graphMap(graphMap) {}
+
+        const nlohmann::json & graph(const std::string & graphName) const {
+            if (graphName == JsonLdConsts::MERGED)
+                return mergedGraph;
+            return graphMap.at(graphName);
+        }
+
+        bool isGraphName(const std::string & id) const {
+            return graphMap.contains(id);
+        }
+    };
+
+    const nlohmann::json & emptyFrame() {
+        static const nlohmann::json frame = nlohmann::json::object();
+        return frame;
+    }
+
+    // the values of key in element, as an array
+    nlohmann::json valuesOf(const nlohmann::json & element, const std::string & key) {
+        if (!element.is_object() || !element.contains(key))
+            return nlohmann::json::array();
+        const nlohmann::json & values = element.at(key);
+        if (values.is_array())
+            return values;
+        return nlohmann::json::array({values});
+    }
+
+    bool isEmptyMap(const nlohmann::json & element) {
+        return element.is_object() && element.empty();
+    }
+
+    bool isBlankNodeIdentifier(const std::string & id) {
+        return id.compare(0, 2, JsonLdConsts::BLANK_NODE_PREFIX) == 0;
+    }
+
+    bool isNodeReference(const nlohmann::json & element) {
+        return element.is_object() && element.size() == 1 && element.contains(JsonLdConsts::ID);
+    }
+
+    bool includes(const nlohmann::json & values, const nlohmann::json & value) {
+        return std::find(values.begin(), values.end(), value) != values.end();
+    }
+
+    // Checks that frame is an array holding a single map, or a map, and returns the map.
+    const nlohmann::json & validateFrame(const nlohmann::json & frame) {
+        if (frame.is_object())
+            return frame;
+        if (frame.is_array() && frame.empty())
+            return emptyFrame();
+        if (!frame.is_array() || frame.size() != 1 || !frame.at(0).is_object())
+            throw JsonLdError(JsonLdError::InvalidFrame, "frame must be a map or an array holding one map");
+        return frame.at(0);
+    }
+
+    // The value of a framing flag in frame. Flags are expanded to value objects, or left as
+    // plain values in implicit frames.
+    nlohmann::json frameFlag(const nlohmann::json & frame, const std::string & flag) {
+        if (!frame.contains(flag))
+            return nullptr;
+        nlohmann::json value = frame.at(flag);
+        if (value.is_array())
+            value = value.empty() ? nlohmann::json() : value.at(0);
+        if (value.is_object() && value.contains(JsonLdConsts::VALUE))
+            value = value.at(JsonLdConsts::VALUE);
+        return value;
+    }
+
+    bool booleanFlag(const nlohmann::json & frame, const std::string & flag, bool defaultValue) {
+        nlohmann::json value = frameFlag(frame, flag);
+        return value.is_boolean() ? value.get<bool>() : defaultValue;
+    }
+
+    std::string embedFlag(const nlohmann::json & frame, const JsonLdOptions & options) {
+        nlohmann::json value = frameFlag(frame, JsonLdConsts::EMBED);
+        std::string embed;
+        if (value.is_null())
+            embed = options.getEmbed();
+        else if (value.is_boolean())
+            embed = value.get<bool>() ? JsonLdConsts::ONCE : JsonLdConsts::NEVER;
+        else if (value.is_string())
+            embed = value.get<std::string>();
+        else
+            throw JsonLdError(JsonLdError::InvalidEmbedValue, value.dump());
+
+        if (embed != JsonLdConsts::ALWAYS && embed != JsonLdConsts::ONCE && embed != JsonLdConsts::NEVER)
+            throw JsonLdError(JsonLdError::InvalidEmbedValue, embed);
+        return embed;
+    }
+
+    Flags frameFlags(const nlohmann::json & frame, const JsonLdOptions & options) {
+        return Flags{
+                embedFlag(frame, options),
+                booleanFlag(frame, JsonLdConsts::EXPLICIT, options.getExplicit()),
+                booleanFlag(frame, JsonLdConsts::REQUIRE_ALL, options.getRequireAll())};
+    }
+
+    // A frame with only the flags in flags, used for properties not in a frame.
+    nlohmann::json implicitFrame(const Flags & flags) {
+        nlohmann::json frame = nlohmann::json::object();
+        frame[JsonLdConsts::EMBED] = nlohmann::json::array({flags.embed});
+        frame[JsonLdConsts::EXPLICIT] = nlohmann::json::array({flags.explicitInclusion});
+        frame[JsonLdConsts::REQUIRE_ALL] = nlohmann::json::array({flags.requireAll});
+        return nlohmann::json::array({frame});
+    }
+
+    /**
+     * Merge Node Maps
+     *
+     * https://www.w3.org/TR/json-ld11-framing/#merge-node-maps
+     */
+    nlohmann::json mergeNodeMaps(const nlohmann::json & graphMap) {
+        nlohmann::json merged = nlohmann::json::object();
+        for (const auto & graph : graphMap) {
+            for (const auto & node : graph) {
+                const std::string & id = node.at(JsonLdConsts::ID).get_ref<const std::string &>();
+                nlohmann::json & mergedNode = merged[id];
+                if (mergedNode.is_null())
+                    mergedNode[JsonLdConsts::ID] = id;
+                for (auto it = node.begin(); it != node.end(); ++it) {
+                    if (it.key() != JsonLdConsts::TYPE && JsonLdUtils::isKeyword(it.key())) {
+                        mergedNode[it.key()] = it.value();
+                        continue;
+                    }
+                    nlohmann::json & values = mergedNode[it.key()];
+                    if (values.is_null())
+                        values = nlohmann::json::array();
+                    for (const auto & value : it.value()) {
+                        if (!includes(values, value))
+                            values.push_back(value);
+                    }
+                }
+            }
+        }
+        return merged;
+    }
+
+    GraphIndex & indexFor(FramingState & state, const std::string & graphName) {
+        auto it = state.indexes.find(graphName);
+        if (it != state.indexes.end())
+            return it->second;
+
+        GraphIndex & index = state.indexes[graphName];
+        for (const auto & node : state.graph(graphName)) {
+            const std::string * id = &node.at(JsonLdConsts::ID).get_ref<const std::string &>();
+            for (auto property = node.begin(); property != node.end(); ++property) {
+                if (property.key() == JsonLdConsts::TYPE) {
+                    if (!property.value().empty())
+                        index.typed.push_back(id);
+                    for (const auto & type : property.value()) {
+                        if (type.is_string())
+                            index.byType[type.get<std::string>()].push_back(id);
+                    }
+                }
+                else if (!JsonLdUtils::isKeyword(property.key()))
+                    index.byProperty[property.key()].push_back(id);
+            }
+        }
+        return index;
+    }
+
+    GraphIndex & referenceIndexFor(FramingState & state, const std::string & graphName) {
+        GraphIndex & index = indexFor(state, graphName);
+        if (index.hasReferences)
+            return index;
+        index.hasReferences = true;
+
+        for (const auto & node : state.graph(graphName)) {
+            const std::string * id = &node.at(JsonLdConsts::ID).get_ref<const std::string &>();
+            for (auto property = node.begin(); property != node.end(); ++property) {
+                if (JsonLdUtils::isKeyword(property.key()))
+                    continue;
+                std::unordered_set<std::string> referenced;
+                for (const auto & value : property.value()) {
+                    if (value.is_object() && value.contains(JsonLdConsts::ID) && value.at(JsonLdConsts::ID).is_string()) {
+                        const std::string & object = value.at(JsonLdConsts::ID).get_ref<const std::string &>();
+                        if (referenced.insert(object).second)
+                            index.referencedBy[object].emplace_back(id, &property.key());
+                    }
+                }
+            }
+        }
+        return index;
+    }
+
+    /**
+     * Value Pattern Matching Algorithm
+     *
+     * https://www.w3.org/TR/json-ld11-framing/#value-pattern-matching-algorithm
+     */
+    bool valueMatches(const nlohmann::json & pattern, const nlohmann::json & value) {
+        nlohmann::json v2 = valuesOf(pattern, JsonLdConsts::VALUE);
+        nlohmann::json t2 = valuesOf(pattern, JsonLdConsts::TYPE);
+        nlohmann::json l2 = valuesOf(pattern, JsonLdConsts::LANGUAGE);
+        if (v2.empty() && t2.empty() && l2.empty())
+            return true;
+
+        nlohmann::json v1 = value.contains(JsonLdConsts::VALUE) ? value.at(JsonLdConsts::VALUE) : nlohmann::json();
+        nlohmann::json t1 = value.contains(JsonLdConsts::TYPE) ? value.at(JsonLdConsts::TYPE) : nlohmann::json();
+        nlohmann::json l1 = value.contains(JsonLdConsts::LANGUAGE) ? value.at(JsonLdConsts::LANGUAGE) : nlohmann::json();
+
+        if (!(includes(v2, v1) || (!v2.empty() && isEmptyMap(v2.at(0)))))
+            return false;
+        if (!((t1.is_null() && t2.empty()) || includes(t2, t1) || (!t1.is_null() && !t2.empty() && isEmptyMap(t2.at(0)))))
+            return false;
+        if (!((l1.is_null() && l2.empty()) || includes(l2, l1) || (!l1.is_null() && !l2.empty() && isEmptyMap(l2.at(0)))))
+            return false;
+        return true;
+    }
+
+    bool nodeMatches(FramingState & state, const std::string & graphName, const nlohmann::json & node,
+                     const nlohmann::json & frame, bool requireAll);
+
+    // Does value reference a node of the graph that matches frame?
+    bool referenceMatches(FramingState & state, const std::string & graphName, const nlohmann::json & frame,
+                          const nlohmann::json & value, bool requireAll) {
+        if (!value.is_object() || !value.contains(JsonLdConsts::ID) || !value.at(JsonLdConsts::ID).is_string())
+            return false;
+        const nlohmann::json & graph = state.graph(graphName);
+        auto node = graph.find(value.at(JsonLdConsts::ID).get<std::string>());
+        return node != graph.end() && nodeMatches(state, graphName, *node, frame, requireAll);
+    }
+
+    /**
+     * Frame Matching Algorithm
+     *
+     * https://www.w3.org/TR/json-ld11-framing/#frame-matching-algorithm
+     */
+    bool nodeMatches(FramingState & state, const std::string & graphName, const nlohmann::json & node,
+                     const nlohmann::json & frame, bool requireAll) {
+        bool wildcard = true;
+        bool matchesSome = false;
+
+        for (auto entry = frame.begin(); entry != frame.end(); ++entry) {
+            const std::string & key = entry.key();
+            nlohmann::json frameValues = valuesOf(frame, key);
+            nlohmann::json nodeValues = valuesOf(node, key);
+            bool matchThis = false;
+
+            if (key == JsonLdConsts::ID) {
+                // node matches if its @id is one of the identifiers in frame, or frame has
+                // a wildcard @id
+                if (frameValues.empty() || isEmptyMap(frameValues.at(0)))
+                    matchThis = true;
+                else
+                    matchThis = includes(frameValues, node.at(JsonLdConsts::ID));
+                if (!requireAll)
+                    return matchThis;
+            }
+            else if (key == JsonLdConsts::TYPE) {
+                wildcard = false;
+                if (frameValues.empty()) {
+                    // match none: node only matches if it has no @type
+                    if (!nodeValues.empty())
+                        return false;
+                    matchThis = true;
+                }
+                else if (frameValues.size() == 1 && isEmptyMap(frameValues.at(0)))
+                    // match on any @type
+                    matchThis = !nodeValues.empty();
+                else {
+                    for (const auto & type : frameValues) {
+                        if (type.is_object() && type.contains(JsonLdConsts::DEFAULT))
+                            matchThis = true;
+                        else if (includes(nodeValues, type))
+                            matchThis = true;
+                    }
+                    if (!requireAll)
+                        return matchThis;
+                }
+            }
+            else if (JsonLdUtils::isKeyword(key))
+                continue;
+            else {
+                wildcard = false;
+                const nlohmann::json & propertyFrame = frameValues.empty() ? emptyFrame() : frameValues.at(0);
+                bool hasDefault = propertyFrame.is_object() && propertyFrame.contains(JsonLdConsts::DEFAULT);
+
+                if (nodeValues.empty() && hasDefault)
+                    continue;
+
+                if (frameValues.empty()) {
+                    // match none: node only matches if it does not have the property
+                    if (!nodeValues.empty())
+                        return false;
+                    matchThis = true;
+                }
+                else if (propertyFrame.is_object() && propertyFrame.contains(JsonLdConsts::LIST)) {
+                    nlohmann::json listFrames = valuesOf(propertyFrame, JsonLdConsts::LIST);
+                    if (!listFrames.empty() && !nodeValues.empty() && nodeValues.at(0).contains(JsonLdConsts::LIST)) {
+                        const nlohmann::json & listFrame = listFrames.at(0);
+                        for (const auto & item : nodeValues.at(0).at(JsonLdConsts::LIST)) {
+                            if (listFrame.contains(JsonLdConsts::VALUE) ? valueMatches(listFrame, item)
+                                                                        : referenceMatches(state, graphName, listFrame, item, requireAll)) {
+                                matchThis = true;
+                                break;
+                            }
+                        }
+                    }
+                }
+                else if (propertyFrame.is_object() && propertyFrame.contains(JsonLdConsts::VALUE)) {
+                    for (const auto & value : nodeValues) {
+                        if (valueMatches(propertyFrame, value)) {
+                            matchThis = true;
+                            break;
+                        }
+                    }
+                }
+                else if (isNodeReference(propertyFrame)) {
+                    for (const auto & value : nodeValues) {
+                        if (referenceMatches(state, graphName, propertyFrame, value, requireAll)) {
+                            matchThis = true;
+                            break;
+                        }
+                    }
+                }
+                else if (propertyFrame.is_object())
+                    matchThis = !nodeValues.empty();
+            }
+
+            if (!matchThis && requireAll)
+                return false;
+            matchesSome = matchesSome || matchThis;
+        }
+
+        return wildcard || matchesSome;
+    }
+
+    void addToCandidates(NodeIds & candidates, const NodeIds & ids) {
+        candidates.insert(candidates.end(), ids.begin(), ids.end());
+    }
+
+    // Selects the nodes of a graph that could match frame from the indexes of the graph.
+    // Returns false if any node could match.
+    bool selectCandidates(FramingState & state, const std::string & graphName, const nlohmann::json & frame,
+                          bool requireAll, NodeIds & candidates) {
+        const nlohmann::json & graph = state.graph(graphName);
+        GraphIndex & index = indexFor(state, graphName);
+        static const NodeIds none;
+        auto indexed = [](const std::unordered_map<std::string, NodeIds> & map, const std::string & key) -> const NodeIds & {
+            auto it = map.find(key);
+            return it == map.end() ? none : it->second;
+        };
+
+        // the node identifiers in the @id entry of frame, or null for a wildcard
+        std::unique_ptr<NodeIds> byId;
+        if (frame.contains(JsonLdConsts::ID)) {
+            nlohmann::json ids = valuesOf(frame, JsonLdConsts::ID);
+            if (!ids.empty() && !isEmptyMap(ids.at(0))) {
+                byId.reset(new NodeIds());
+                for (const auto & id : ids) {
+                    auto node = id.is_string() ? graph.find(id.get<std::string>()) : graph.end();
+                    if (node != graph.end())
+                        byId->push_back(&node->at(JsonLdConsts::ID).get_ref<const std::string &>());
+                }
+            }
+            else if (!requireAll)
+                return false;
+        }
+
+        // the nodes having one of the types in the @type entry of frame, or null if nodes
+        // without such a type could match
+        std::unique_ptr<NodeIds> byType;
+        bool typeMatchesAll = false;
+        if (frame.contains(JsonLdConsts::TYPE)) {
+            nlohmann::json types = valuesOf(frame, JsonLdConsts::TYPE);
+            if (types.empty())
+                typeMatchesAll = true;
+            else if (types.size() == 1 && isEmptyMap(types.at(0)))
+                byType.reset(new NodeIds(index.typed));
+            else {
+                byType.reset(new NodeIds());
+                for (const auto & type : types) {
+                    if (!type.is_string()) {
+                        byType.reset();
+                        typeMatchesAll = true;
+                        break;
+                    }
+                    addToCandidates(*byType, indexed(index.byType, type.get<std::string>()));
+                }
+            }
+        }
+
+        // for each property of frame, the nodes having it, or null if nodes without it
+        // could match
+        std::vector<const NodeIds *> byProperty;
+        bool propertyMatchesAll = false;
+        for (auto entry = frame.begin(); entry != frame.end(); ++entry) {
+            if (JsonLdUtils::isKeyword(entry.key()))
+                continue;
+            nlohmann::json frameValues = valuesOf(frame, entry.key());
+            if (frameValues.empty() ||
+                (frameValues.at(0).is_object() && frameValues.at(0).contains(JsonLdConsts::DEFAULT)))
+                propertyMatchesAll = true;
+            else
+                byProperty.push_back(&indexed(index.byProperty, entry.key()));
+        }
+
+        if (!requireAll) {
+            // the first of @id, then @type that is in frame decides the match, otherwise a
+            // node matches if it matches on any property
+            if (byId != nullptr) {
+                candidates = std::move(*byId);
+            }
+            else if (frame.contains(JsonLdConsts::TYPE) && !(byType != nullptr && valuesOf(frame, JsonLdConsts::TYPE).size() == 1 &&
+                                                             isEmptyMap(valuesOf(frame, JsonLdConsts::TYPE).at(0)))) {
+                if (typeMatchesAll)
+                    return false;
+                candidates = std::move(*byType);
+            }
+            else {
+                if (propertyMatchesAll || (byType == nullptr && byProperty.empty()))
+                    return false;
+                if (byType != nullptr)
+                    candidates = std::move(*byType);
+                for (const NodeIds * ids : byProperty)
+                    addToCandidates(candidates, *ids);
+            }
+        }
+        else {
+            // every entry of frame must match, so the smallest set of nodes is selected
+            const NodeIds * smallest = nullptr;
+            if (byId != nullptr)
+                smallest = byId.get();
+            if (byType != nullptr && (smallest == nullptr || byType->size() < smallest->size()))
+                smallest = byType.get();
+            for (const NodeIds * ids : byProperty) {
+                if (smallest == nullptr || ids->size() < smallest->size())
+                    smallest = ids;
+            }
+            if (smallest == nullptr)
+                return false;
+            candidates = *smallest;
+        }
+
+        std::sort(candidates.begin(), candidates.end(),
+                  [](const std::string * lhs, const std::string * rhs) { return *lhs < *rhs; });
+        candidates.erase(std::unique(candidates.begin(), candidates.end()), candidates.end());
+        return true;
+    }
+
+    // Adds output to parent: to the property entry of parent if parent is a map, or to
+    // parent if it is an array.
+    void addFrameOutput(json & parent, const std::string * property, json output) {
+        if (parent.is_object()) {
+            json & values = parent[*property];
+            if (values.is_null())
+                values = json::array();
+            values.push_back(std::move(output));
+        }
+        else
+            parent.push_back(std::move(output));
+    }
+
+    bool createsCircularReference(const FramingState & state, const std::string & id, const std::string & graphName) {
+        for (auto it = state.subjectStack.rbegin(); it != state.subjectStack.rend(); ++it) {
+            if (it->first == id && it->second == graphName)
+                return true;
+        }
+        return false;
+    }
+
+    void countBlankNode(FramingState & state, const std::string & id) {
+        if (isBlankNodeIdentifier(id))
+            state.blankNodeUsages[id]++;
+    }
+
+    /**
+     * Framing Algorithm
+     *
+     * subjects are the identifiers of the nodes to frame, or null for all nodes of the
+     * graph, which are then selected using the indexes of the graph.
+     */
+    void frameSubjects(FramingState & state, const std::string & graphName, bool embedded,
+                       const std::vector<std::string> * subjects, const nlohmann::json & frameElement,
+                       json & parent, const std::string * property) {
+
+        // Comments in this function are labeled with numbers that correspond to sections
+        // from the description of the Framing algorithm.
+        // See: https://www.w3.org/TR/json-ld11-framing/#framing-algorithm
+
+        // 1)
+        // If frame is not a valid frame, an invalid frame error has been detected and
+        // processing is aborted.
+        const nlohmann::json & frame = validateFrame(frameElement);
+
+        // 2)
+        // Initialize flags embed, explicit, and requireAll from object embed flag, explicit
+        // inclusion flag, and require all flag in state overriding from any property values
+        // for @embed, @explicit, and @requireAll in frame.
+        Flags flags = frameFlags(frame, state.options);
+
+        // 3)
+        // Create a list of matched subjects by filtering subjects against frame using the
+        // Frame Matching algorithm with state, subjects, frame, and requireAll.
+        const nlohmann::json & graph = state.graph(graphName);
+        std::vector<const nlohmann::json *> matches;
+        if (subjects == nullptr) {
+            NodeIds candidates;
+            if (state.useIndexes && selectCandidates(state, graphName, frame, flags.requireAll, candidates)) {
+                for (const std::string * id : candidates) {
+                    const nlohmann::json & node = graph.at(*id);
+                    if (nodeMatches(state, graphName, node, frame, flags.requireAll))
+                        matches.push_back(&node);
+                }
+            }
+            else {
+                for (const auto & node : graph) {
+                    if (nodeMatches(state, graphName, node, frame, flags.requireAll))
+                        matches.push_back(&node);
+                }
+            }
+        }
+        else {
+            std::vector<std::string> ids(*subjects);
+            std::sort(ids.begin(), ids.end());
+            for (const auto & id : ids) {
+                auto node = graph.find(id);
+                if (node != graph.end() && nodeMatches(state, graphName, *node, frame, flags.requireAll))
+                    matches.push_back(&*node);
+            }
+        }
+
+        // 4-5)
+        // For each id and associated node object node from the set of matched subjects,
+        // ordered lexicographically by id:
+        for (const nlohmann::json * nodePtr : matches) {
+            const nlohmann::json & node = *nodePtr;
+            const std::string & id = node.at(JsonLdConsts::ID).get_ref<const std::string &>();
+
+            // Each top-level match is framed on its own, so nodes embedded in another
+            // top-level match are embedded again.
+            if (property == nullptr)
+                state.uniqueEmbeds.clear();
+            std::unordered_set<std::string> & uniqueEmbeds = state.uniqueEmbeds[graphName];
+
+            // 5.1)
+            // Initialize output to a new map with @id and id.
+            json output = json::object();
+            output[JsonLdConsts::ID] = id;
+            countBlankNode(state, id);
+
+            // Skip adding a node to the top level of a graph if it is already embedded.
+            if (!embedded && uniqueEmbeds.count(id))
+                continue;
+
+            // 5.2)
+            // If embed is @never or if a circular reference would be created by an embed,
+            // add output to parent and do not perform additional processing for this node.
+            if (embedded && (flags.embed == JsonLdConsts::NEVER || createsCircularReference(state, id, graphName))) {
+                addFrameOutput(parent, property, std::move(output));
+                continue;
+            }
+
+            // 5.3)
+            // Otherwise, if embed is @once and parent has an existing embedded node in parent
+            // associated with graph name and id in state, add output to parent and do not
+            // perform additional processing for this node.
+            if (embedded && flags.embed == JsonLdConsts::ONCE && uniqueEmbeds.count(id)) {
+                addFrameOutput(parent, property, std::move(output));
+                continue;
+            }
+
+            uniqueEmbeds.insert(id);
+            state.subjectStack.emplace_back(id, graphName);
+
+            // 5.4)
+            // If graph map in state has an entry for id:
+            if (state.isGraphName(id)) {
+                bool recurse;
+                nlohmann::json subframe;
+
+                // 5.4.1)
+                // If frame does not have the key @graph, set recurse to true, unless graph
+                // name in state is @merged and set subframe to a new empty map.
+                if (!frame.contains(JsonLdConsts::GRAPH)) {
+                    recurse = graphName != JsonLdConsts::MERGED;
+                    subframe = nlohmann::json::object();
+                }
+
+                // 5.4.2)
+                // Otherwise, set subframe to the first entry for @graph in frame, or a new
+                // empty map, if it does not exist, and set recurse to true, unless id is
+                // @merged or @default.
+                else {
+                    nlohmann::json graphFrames = valuesOf(frame, JsonLdConsts::GRAPH);
+                    subframe = graphFrames.empty() || !graphFrames.at(0).is_object() ? nlohmann::json::object()
+                                                                                      : graphFrames.at(0);
+                    recurse = id != JsonLdConsts::MERGED && id != JsonLdConsts::DEFAULT;
+                }
+
+                // 5.4.3)
+                // If recurse is true, invoke the recursive algorithm using state with graph
+                // name set to id, the keys of that graph as subjects, subframe as frame,
+                // output as parent, and @graph as active property.
+                if (recurse) {
+                    static const std::string graphProperty = JsonLdConsts::GRAPH;
+                    frameSubjects(state, id, false, nullptr, subframe, output, &graphProperty);
+                }
+            }
+
+            // 5.5)
+            // If frame has an @included entry, invoke the recursive algorithm using state,
+            // subjects, value of @included as frame, output as parent, and @included as
+            // active property.
+            if (frame.contains(JsonLdConsts::INCLUDED)) {
+                static const std::string includedProperty = JsonLdConsts::INCLUDED;
+                frameSubjects(state, graphName, false, subjects, frame.at(JsonLdConsts::INCLUDED), output, &includedProperty);
+            }
+
+            // 5.6)
+            // For each property and objects in node, ordered by property:
+            for (auto entry = node.begin(); entry != node.end(); ++entry) {
+                const std::string & nodeProperty = entry.key();
+                const nlohmann::json & objects = entry.value();
+
+                // 5.6.1)
+                // If property is @id, or another keyword, copy objects to output.
+                if (JsonLdUtils::isKeyword(nodeProperty)) {
+                    output[nodeProperty] = objects;
+                    if (nodeProperty == JsonLdConsts::TYPE) {
+                        for (const auto & type : objects) {
+                            if (type.is_string())
+                                countBlankNode(state, type.get<std::string>());
+                        }
+                    }
+                    continue;
+                }
+
+                // 5.6.2)
+                // Otherwise, if explicit is true and frame does not have the property,
+                // continue to the next property.
+                if (flags.explicitInclusion && !frame.contains(nodeProperty))
+                    continue;
+
+                // 5.6.3)
+                // For each item in objects:
+                nlohmann::json subframe = frame.contains(nodeProperty) ? valuesOf(frame, nodeProperty) : implicitFrame(flags);
+                if (subframe.empty())
+                    subframe = nlohmann::json::array({nlohmann::json::object()});
+                for (const auto & item : objects) {
+
+                    // 5.6.3.1)
+                    // If item is a list object, add a new list object to output for property,
+                    // and add each of its items, recursing into node references using the
+                    // list frame from frame, if any.
+                    if (item.is_object() && item.contains(JsonLdConsts::LIST)) {
+                        nlohmann::json listFrame = implicitFrame(flags);
+                        if (frame.contains(nodeProperty) && subframe.at(0).is_object() &&
+                            subframe.at(0).contains(JsonLdConsts::LIST))
+                            listFrame = valuesOf(subframe.at(0), JsonLdConsts::LIST);
+
+                        json list = json::object();
+                        list[JsonLdConsts::LIST] = json::array();
+                        static const std::string listProperty = JsonLdConsts::LIST;
+                        for (const auto & listItem : item.at(JsonLdConsts::LIST)) {
+                            if (isNodeReference(listItem)) {
+                                std::vector<std::string> listSubject = {listItem.at(JsonLdConsts::ID).get<std::string>()};
+                                frameSubjects(state, graphName, true, &listSubject, listFrame, list, &listProperty);
+                            }
+                            else
+                                list[JsonLdConsts::LIST].push_back(listItem);
+                        }
+                        addFrameOutput(output, &nodeProperty, std::move(list));
+                    }
+
+                    // 5.6.3.2)
+                    // If item is a node reference, invoke the recursive algorithm using state,
+                    // the value of @id from item as subjects, subframe as frame, output as
+                    // parent, and property as active property.
+                    else if (isNodeReference(item)) {
+                        std::vector<std::string> itemSubject = {item.at(JsonLdConsts::ID).get<std::string>()};
+                        frameSubjects(state, graphName, true, &itemSubject, subframe, output, &nodeProperty);
+                    }
+
+                    // 5.6.3.3)
+                    // If item is a value object matching the value pattern in subframe, add
+                    // a copy of item to output for property.
+                    else if (valueMatches(subframe.at(0), item))
+                        addFrameOutput(output, &nodeProperty, item);
+                }
+            }
+
+            // 5.7)
+            // For each non-keyword property and objects in frame (other than @type) that is
+            // not in output:
+            for (auto entry = frame.begin(); entry != frame.end(); ++entry) {
+                const std::string & frameProperty = entry.key();
+                nlohmann::json frameValues = valuesOf(frame, frameProperty);
+                const nlohmann::json & next = frameValues.empty() ? emptyFrame() : frameValues.at(0);
+
+                // a default object for @type is handled as a property
+                if (frameProperty == JsonLdConsts::TYPE) {
+                    if (!next.is_object() || !next.contains(JsonLdConsts::DEFAULT))
+                        continue;
+                }
+                else if (JsonLdUtils::isKeyword(frameProperty))
+                    continue;
+
+                // 5.7.1-2)
+                // Let item be the first element in objects, which must be a frame object. Set
+                // property frame to the first item in objects or a newly created frame
+                // object if value is objects. property frame must be a map.
+                // 5.7.3)
+                // Skip property and property frame if property frame contains @omitDefault
+                // with a value of true, or does not contain @omitDefault and the value of the
+                // omit default flag is true.
+                if (!next.is_object() ||
+                    booleanFlag(next, JsonLdConsts::OMIT_DEFAULT, state.options.getOmitDefault()) ||
+                    output.contains(frameProperty))
+                    continue;
+
+                // 5.7.4)
+                // Add property to output with a new map having a property @preserve and a
+                // value that is a copy of the value of @default in frame if it exists, or the
+                // string @null otherwise.
+                json preserve = JsonLdConsts::ATNULL;
+                if (next.contains(JsonLdConsts::DEFAULT))
+                    preserve = next.at(JsonLdConsts::DEFAULT);
+                if (!preserve.is_array())
+                    preserve = json::array({preserve});
+                json preserved = json::object();
+                preserved[JsonLdConsts::PRESERVE] = std::move(preserve);
+                output[frameProperty] = json::array({std::move(preserved)});
+            }
+
+            // 5.8)
+            // If frame has the property @reverse, then for each reverse property and
+            // sub frame that are the values of @reverse in frame:
+            if (frame.contains(JsonLdConsts::REVERSE) && frame.at(JsonLdConsts::REVERSE).is_object()) {
+                GraphIndex & index = referenceIndexFor(state, graphName);
+                auto referencing = index.referencedBy.find(id);
+                const nlohmann::json & reverseFrame = frame.at(JsonLdConsts::REVERSE);
+                for (auto reverse = reverseFrame.begin(); reverse != reverseFrame.end(); ++reverse) {
+                    if (referencing == index.referencedBy.end())
+                        break;
+
+                    // 5.8.1-2)
+                    // For each node that has the reverse property referencing id, invoke the
+                    // recursive algorithm using state, the node as subjects, sub frame as
+                    // frame, and the reverse property entry of the @reverse entry of output
+                    // as parent.
+                    for (const auto & reference : referencing->second) {
+                        if (*reference.second != reverse.key())
+                            continue;
+                        json & reverseOutput = output[JsonLdConsts::REVERSE];
+                        if (reverseOutput.is_null())
+                            reverseOutput = json::object();
+                        json & reverseValues = reverseOutput[reverse.key()];
+                        if (reverseValues.is_null())
+                            reverseValues = json::array();
+                        std::vector<std::string> referencingSubject = {*reference.first};
+                        frameSubjects(state, graphName, true, &referencingSubject, reverse.value(), reverseValues, property);
+                    }
+                }
+            }
+
+            // 5.9)
+            // Once output has been set as required in the previous steps, add output to
+            // parent.
+            addFrameOutput(parent, property, std::move(output));
+
+            state.subjectStack.pop_back();
+        }
+    }
+
+    // Replaces each @preserve entry with its value and removes the blank node identifiers
+    // that are only used once.
+    json cleanupPreserve(json && element, const FramingState & state, bool pruneBlankNodeIdentifiers) {
+        if (element.is_array()) {
+            json result = json::array();
+            for (auto & item : element)
+                result.push_back(cleanupPreserve(std::move(item), state, pruneBlankNodeIdentifiers));
+            return result;
+        }
+        if (!element.is_object())
+            return std::move(element);
+
+        if (element.contains(JsonLdConsts::PRESERVE)) {
+            json & preserve = element.at(JsonLdConsts::PRESERVE);
+            return preserve.is_array() ? std::move(preserve.at(0)) : std::move(preserve);
+        }
+        if (element.contains(JsonLdConsts::VALUE))
+            return std::move(element);
+        if (element.contains(JsonLdConsts::LIST)) {
+            element[JsonLdConsts::LIST] = cleanupPreserve(std::move(element.at(JsonLdConsts::LIST)), state, pruneBlankNodeIdentifiers);
+            return std::move(element);
+        }
+
+        if (pruneBlankNodeIdentifiers && element.contains(JsonLdConsts::ID) && element.at(JsonLdConsts::ID).is_string()) {
+            auto usages = state.blankNodeUsages.find(element.at(JsonLdConsts::ID).get<std::string>());
+            if (usages != state.blankNodeUsages.end() && usages->second == 1)
+                element.erase(JsonLdConsts::ID);
+        }
+        for (auto & entry : element.items()) {
+            if (entry.key() != JsonLdConsts::ID)
+                entry.value() = cleanupPreserve(std::move(entry.value()), state, pruneBlankNodeIdentifiers);
+        }
+        return std::move(element);
+    }
+
+}
+
+json FramingProcessor::frame(const NodeMap & nodeMap, const json & frame, const JsonLdOptions & options, bool merged,
+                             NodeSelection selection) {
+
+    // Comments in this function are labeled with numbers that correspond to sections
+    // from the description of the frame() function in the JsonLdProcessor interface.
+    // See: https://www.w3.org/TR/json-ld11-framing/#dom-jsonldprocessor-frame
+
+    // 12-13)
+    // Initialize a new framing state, and set the subjects to the default graph of the
+    // node map, or to the merged node map if frame does not have a top-level @graph
+    // entry.
+    FramingState state(options, nodeMap.getGraphs());
+    state.useIndexes = selection == NodeSelection::Indexed;
+    std::string graphName = JsonLdConsts::DEFAULT;
+    if (merged) {
+        graphName = JsonLdConsts::MERGED;
+        state.mergedGraph = mergeNodeMaps(state.graphMap);
+    }
+
+    // 14)
+    // Initialize results as an empty array, and invoke the Framing algorithm using state,
+    // the subjects, expanded frame as frame, results as parent, and null as active property.
+    nlohmann::json sortedFrame = frame;
+    json results = json::array();
+    frameSubjects(state, graphName, false, nullptr, sortedFrame, results, nullptr);
+
+    // 15)
+    // If processing mode is not json-ld-1.0, remove the @id entry of each node object where
+    // the value is a blank node identifier which appears only once in any property value
+    // within results, and replace each @preserve entry with its value.
+    bool pruneBlankNodeIdentifiers = options.getProcessingMode() != JsonLdConsts::JSON_LD_1_0;
+    return cleanupPreserve(std::move(results), state, pruneBlankNodeIdentifiers);
+}
+
+void FramingProcessor::removeNullPlaceholders(json & element) {
+    if (element.is_array()) {
+        json result = json::array();
+        for (auto & item : element) {
+            if (item.is_string() && item.get_ref<const std::string &>() == JsonLdConsts::ATNULL)
+                continue;
+            removeNullPlaceholders(item);
+            result.push_back(std::move(item));
+        }
+        element = std::move(result);
+    }
+    else if (element.is_object()) {
+        for (auto & entry : element.items()) {
+            if (entry.value().is_string() && entry.value().get_ref<const std::string &>() == JsonLdConsts::ATNULL)
+                entry.value() = nullptr;
+            else
+                removeNullPlaceholders(entry.value());
+        }
+    }
+}
@@ -0,0 +1,64 @@
+#ifndef LIBJSONLD_CPP_FRAMINGPROCESSOR_H
+#define LIBJSONLD_CPP_FRAMINGPROCESSOR_H
+
+#include "jsonld-cpp/jsoninc.h"
+
+class JsonLdOptions;
+class NodeMap;
+
+struct FramingProcessor {
+
+    /**
+     * How the nodes that could match a frame are selected. FullScan matches every node of
+     * the graph against the frame, as described by the specification; it is slower and
+     * only used to check the indexes.
+     */
+    enum class NodeSelection { Indexed, FullScan };
+
+    /**
+     * Framing Algorithm
+     *
+     * This algorithm frames the node map of an expanded JSON-LD document, using an
+     * expanded frame: nodes matching the frame are placed at the top level, and the nodes
+     * they reference are embedded as described by the frame.
+     *
+     * Instead of testing each node of a graph against a frame, the nodes that could match
+     * are first selected from indexes of the graph by @id, by @type and by property, which
+     * are built once for each framed graph. Only those nodes are then matched against the
+     * frame. Nodes are always output in lexicographical order of their identifiers.
+     *
+     * The embed, explicit, omitDefault, requireAll and processingMode options are used.
+     * Unless processing mode is json-ld-1.0, blank node identifiers that are only used
+     * once are removed from the output.
+     *
+     * https://www.w3.org/TR/json-ld11-framing/#framing-algorithm
+     *
+     * @param nodeMap The node map of the expanded input document.
+     * @param frame The expanded frame.
+     * @param options The options used to get the default values of the framing flags.
+     * @param merged If true, the merged graph of all graphs of nodeMap is framed,
+     *               otherwise its default graph.
+     * @param selection How the nodes that could match the frame are selected.
+     * @return The framed document, in expanded form. Values defaulted to null are left as
+     *         @null placeholders, so that they are kept by compaction; they are replaced by
+     *         removeNullPlaceholders().
+     * @throws JsonLdError
+     *             If frame is invalid or has an invalid @embed value.
+     */
+    static nlohmann::ordered_json frame(
+            const NodeMap & nodeMap,
+            const nlohmann::ordered_json & frame,
+            const JsonLdOptions & options,
+            bool merged,
+            NodeSelection selection = NodeSelection::Indexed);
+
+    /**
+     * Replaces the @null placeholders in a compacted framed document with null. Array
+     * items that are placeholders are removed.
+     */
+    static void removeNullPlaceholders(nlohmann::ordered_json & element);
+
+};
+
+
+#endif //LIBJSONLD_CPP_FRAMINGPROCESSOR_H
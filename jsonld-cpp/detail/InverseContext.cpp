@@ -0,0 +1,252 @@
+#include "jsonld-cpp/detail/InverseContext.h"
+
+#include <algorithm>
+
+#include "jsonld-cpp/JsonLdConsts.h"
+#include "jsonld-cpp/detail/Context.h"
+
+using json = nlohmann::ordered_json;
+
+namespace {
+
+    std::string toLower(std::string str) {
+        std::transform(str.begin(), str.end(), str.begin(), ::tolower);
+        return str;
+    }
+
+    // adds term as the value of key in map, unless key already has a term
+    void addTerm(std::unordered_map<std::string, std::string> & map, const std::string & key, const std::string & term) {
+        map.emplace(key, term);
+    }
+
+}
+
+InverseContext::InverseContext(const Context & activeContext) {
+
+    // Comments in this function are labeled with numbers that correspond to sections
+    // from the description of the Inverse Context Creation algorithm.
+    // See: https://www.w3.org/TR/json-ld11-api/#inverse-context-creation
+
+    const json & termDefinitions = activeContext.getTermDefinitions();
+
+    // 2)
+    // Initialize default language to @none. If the active context has a default language,
+    // set default language to the default language from the active context normalized to
+    // lower case.
+    std::string defaultLanguage = JsonLdConsts::NONE;
+    if (!activeContext.getDefaultLanguage().empty())
+        defaultLanguage = toLower(activeContext.getDefaultLanguage());
+
+    // 3)
+    // For each key term and value term definition in the active context, ordered by
+    // shortest term first (breaking ties by choosing the lexicographically least term):
+    std::vector<const std::string *> terms;
+    terms.reserve(termDefinitions.size());
+    for (auto it = termDefinitions.begin(); it != termDefinitions.end(); ++it)
+        terms.push_back(&it.key());
+    std::sort(terms.begin(), terms.end(), [](const std::string * lhs, const std::string * rhs) {
+        if (lhs->size() != rhs->size())
+            return lhs->size() < rhs->size();
+        return *lhs < *rhs;
+    });
+
+    for (const std::string * termPtr : terms) {
+        const std::string & term = *termPtr;
+        const json & definition = termDefinitions.at(term);
+
+        // 3.1)
+        // If the term definition is null, term cannot be selected during compaction, so
+        // continue to the next term.
+        if (!definition.contains(JsonLdConsts::ID) || !definition.at(JsonLdConsts::ID).is_string())
+            continue;
+
+        // 3.2)
+        // Initialize container to @none. If the container mapping is not empty, set
+        // container to the concatenation of all values of the container mapping in
+        // lexicographical order.
+        std::string container = JsonLdConsts::NONE;
+        if (definition.contains(JsonLdConsts::CONTAINER) && !definition.at(JsonLdConsts::CONTAINER).empty()) {
+            std::vector<std::string> mappings;
+            for (const auto & mapping : definition.at(JsonLdConsts::CONTAINER))
+                mappings.push_back(mapping.get<std::string>());
+            std::sort(mappings.begin(), mappings.end());
+            container.clear();
+            for (const auto & mapping : mappings)
+                container += mapping;
+        }
+
+        // 3.3)
+        // Initialize var to the value of the IRI mapping for the term definition.
+        const std::string & var = definition.at(JsonLdConsts::ID).get_ref<const std::string &>();
+
+        if (definition.contains(JsonLdConsts::IS_PREFIX_FLAG) && definition.at(JsonLdConsts::IS_PREFIX_FLAG).get<bool>())
+            prefixes.emplace_back(var, term);
+
+        // 3.4 - 3.9)
+        // Reference the type/language map of container in the entry for var, creating
+        // them as necessary. A new type/language map has an @any map containing an @none
+        // entry set to term.
+        auto & containerMap = entries[var];
+        auto found = containerMap.find(container);
+        if (found == containerMap.end()) {
+            found = containerMap.emplace(container, TypeLanguageMap()).first;
+            found->second.any.emplace(JsonLdConsts::NONE, term);
+        }
+        TypeLanguageMap & typeLanguageMap = found->second;
+        TermMap & typeMap = typeLanguageMap.type;
+        TermMap & languageMap = typeLanguageMap.language;
+
+        bool hasLanguage = definition.contains(JsonLdConsts::LANGUAGE);
+        bool hasDirection = definition.contains(JsonLdConsts::DIRECTION);
+
+        // 3.10)
+        // If the term definition indicates that the term represents a reverse property, and
+        // the type map does not have an @reverse entry, set it to term.
+        if (definition.contains(JsonLdConsts::IS_REVERSE_PROPERTY_FLAG) &&
+            definition.at(JsonLdConsts::IS_REVERSE_PROPERTY_FLAG).get<bool>()) {
+            addTerm(typeMap, JsonLdConsts::REVERSE, term);
+        }
+
+        // 3.11)
+        // Otherwise, if term definition has a type mapping which is @none, set the @any
+        // entries of the language map and the type map to term, if not already set.
+        else if (definition.contains(JsonLdConsts::TYPE) && definition.at(JsonLdConsts::TYPE) == JsonLdConsts::NONE) {
+            addTerm(languageMap, JsonLdConsts::ANY, term);
+            addTerm(typeMap, JsonLdConsts::ANY, term);
+        }
+
+        // 3.12)
+        // Otherwise, if term definition has a type mapping, set the entry of type map for
+        // that type mapping to term, if not already set.
+        else if (definition.contains(JsonLdConsts::TYPE)) {
+            addTerm(typeMap, definition.at(JsonLdConsts::TYPE).get<std::string>(), term);
+        }
+
+        // 3.13)
+        // Otherwise, if term definition has both a language mapping and a direction mapping,
+        // set the lang dir entry of language map to term, if not already set.
+        else if (hasLanguage && hasDirection) {
+            const json & language = definition.at(JsonLdConsts::LANGUAGE);
+            const json & direction = definition.at(JsonLdConsts::DIRECTION);
+            std::string langDir;
+            if (!language.is_null() && !direction.is_null())
+                langDir = toLower(language.get<std::string>() + "_" + direction.get<std::string>());
+            else if (!language.is_null())
+                langDir = toLower(language.get<std::string>());
+            else if (!direction.is_null())
+                langDir = "_" + direction.get<std::string>();
+            else
+                langDir = JsonLdConsts::ATNULL;
+            addTerm(languageMap, langDir, term);
+        }
+
+        // 3.14)
+        // Otherwise, if term definition has a language mapping (might be null), set the
+        // entry of language map for that language mapping (or @null) to term, if not
+        // already set.
+        else if (hasLanguage) {
+            const json & language = definition.at(JsonLdConsts::LANGUAGE);
+            addTerm(languageMap,
+                    language.is_null() ? std::string(JsonLdConsts::ATNULL) : toLower(language.get<std::string>()),
+                    term);
+        }
+
+        // 3.15)
+        // Otherwise, if term definition has a direction mapping (might be null), set the
+        // entry of language map for that direction (or @none) to term, if not already set.
+        else if (hasDirection) {
+            const json & direction = definition.at(JsonLdConsts::DIRECTION);
+            addTerm(languageMap,
+                    direction.is_null() ? std::string(JsonLdConsts::NONE) : "_" + direction.get<std::string>(),
+                    term);
+        }
+
+        // 3.16)
+        // Otherwise, if active context has a default base direction, set the lang dir,
+        // @none entries of language map and the @none entry of type map to term, if not
+        // already set.
+        // Note: lang dir is the default language, if any, and the default base direction,
+        // which is the form value objects are matched against in IRI compaction.
+        else if (activeContext.getDefaultBaseDirection() != "null") {
+            std::string langDir = activeContext.getDefaultLanguage() + "_" + activeContext.getDefaultBaseDirection();
+            addTerm(languageMap, toLower(langDir), term);
+            addTerm(languageMap, JsonLdConsts::NONE, term);
+            addTerm(typeMap, JsonLdConsts::NONE, term);
+        }
+
+        // 3.17)
+        // Otherwise, set the default language and @none entries of language map and the
+        // @none entry of type map to term, if not already set.
+        else {
+            addTerm(languageMap, defaultLanguage, term);
+            addTerm(languageMap, JsonLdConsts::NONE, term);
+            addTerm(typeMap, JsonLdConsts::NONE, term);
+        }
+    }
+}
+
+bool InverseContext::contains(const std::string & iri) const {
+    return entries.find(iri) != entries.end();
+}
+
+const std::string * InverseContext::selectTerm(
+        const std::string & iri,
+        const std::vector<std::string> & containers,
+        Selector typeLanguage,
+        const std::vector<std::string> & preferredValues) const {
+
+    // Comments in this function are labeled with numbers that correspond to sections
+    // from the description of the Term Selection algorithm.
+    // See: https://www.w3.org/TR/json-ld11-api/#term-selection
+
+    // 3)
+    // Initialize container map to the value associated with var in the inverse context.
+    auto containerMap = entries.find(iri);
+    if (containerMap == entries.end())
+        return nullptr;
+
+    // 4)
+    // For each item container in containers:
+    for (const auto & container : containers) {
+        // 4.1)
+        // If container is not an entry of container map, then there is no term with a
+        // matching container mapping for it, so continue to the next container.
+        auto typeLanguageMap = containerMap->second.find(container);
+        if (typeLanguageMap == containerMap->second.end())
+            continue;
+
+        // 4.2 - 4.3)
+        // Initialize value map to the value associated with type/language entry in the
+        // type/language map of container.
+        const TermMap & valueMap = typeLanguageMap->second.get(typeLanguage);
+
+        // 4.4)
+        // For each item in preferred values, return the term of the first item that is an
+        // entry of value map.
+        for (const auto & item : preferredValues) {
+            auto term = valueMap.find(item);
+            if (term != valueMap.end())
+                return &term->second;
+        }
+    }
+
+    // 5)
+    // No matching term has been found. Return null.
+    return nullptr;
+}
+
+const std::vector<std::pair<std::string, std::string>> & InverseContext::getPrefixes() const {
+    return prefixes;
+}
+
+const InverseContext::TermMap & InverseContext::TypeLanguageMap::get(Selector selector) const {
+    switch (selector) {
+        case Selector::Language:
+            return language;
+        case Selector::Type:
+            return type;
+        case Selector::Any:
+            break;
+    }
+    return any;
+}
@@ -0,0 +1,82 @@
+#ifndef LIBJSONLD_CPP_INVERSECONTEXT_H
+#define LIBJSONLD_CPP_INVERSECONTEXT_H
+
+#include <string>
+#include <unordered_map>
+#include <utility>
+#include <vector>
+
+class Context;
+
+/**
+ * The inverse context of an active context, used to select the best term to compact an
+ * IRI to. For each IRI mapping it holds, by container mapping, the terms that can be used
+ * for values of a given type, language or direction.
+ *
+ * An inverse context only depends on the term definitions, default language and default
+ * base direction of its active context, so it is built once and shared by all copies of
+ * that context. See Context::getInverseContext().
+ *
+ * https://www.w3.org/TR/json-ld11-api/#inverse-context-creation
+ */
+class InverseContext {
+public:
+
+    // Which of the three maps of a container entry to select a term from
+    enum class Selector {
+        Language,
+        Type,
+        Any
+    };
+
+    /**
+     * Inverse Context Creation Algorithm
+     *
+     * https://www.w3.org/TR/json-ld11-api/#inverse-context-creation
+     */
+    explicit InverseContext(const Context & activeContext);
+
+    /**
+     * Returns true if some term of the active context has iri as its IRI mapping.
+     */
+    bool contains(const std::string & iri) const;
+
+    /**
+     * Term Selection Algorithm
+     *
+     * Returns the term that best matches iri, given containers and preferred values in
+     * order of preference, or nullptr if there is none.
+     *
+     * https://www.w3.org/TR/json-ld11-api/#term-selection
+     */
+    const std::string * selectTerm(
+            const std::string & iri,
+            const std::vector<std::string> & containers,
+            Selector typeLanguage,
+            const std::vector<std::string> & preferredValues) const;
+
+    /**
+     * Returns the terms that may be used as the prefix of a compact IRI, as pairs of the
+     * term's IRI mapping and the term.
+     */
+    const std::vector<std::pair<std::string, std::string>> & getPrefixes() const;
+
+private:
+
+    typedef std::unordered_map<std::string, std::string> TermMap;
+
+    struct TypeLanguageMap {
+        TermMap language;
+        TermMap type;
+        TermMap any;
+
+        const TermMap & get(Selector selector) const;
+    };
+
+    // IRI mapping -> container -> type/language map
+    std::unordered_map<std::string, std::unordered_map<std::string, TypeLanguageMap>> entries;
+
+    std::vector<std::pair<std::string, std::string>> prefixes;
+};
+
+#endif //LIBJSONLD_CPP_INVERSECONTEXT_H
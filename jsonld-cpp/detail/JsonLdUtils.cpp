@@ -1,10 +1,9 @@
 #include "jsonld-cpp/detail/JsonLdUtils.h"
 
-#include <set>
-#include <regex>
 #include <algorithm>
 
 #include "jsonld-cpp/JsonLdConsts.h"
+#include "jsonld-cpp/detail/Keyword.h"
 #include "jsonld-cpp/detail/RDFRegex.h"
 #include "jsonld-cpp/detail/Uri.h"
 #include "jsonld-cpp/BlankNodeNames.h"
@@ -12,59 +11,17 @@
 using json = nlohmann::ordered_json;
 using namespace JsonLdConsts;
 
-namespace {
-
-    std::set<std::string> knownKeywords = {
-            // See: https://www.w3.org/TR/json-ld11/#keywords for normative list.
-      BASE,
-      CONTAINER,
-      CONTEXT,
-      DIRECTION,
-      GRAPH,
-      ID,
-      IMPORT,
-      INCLUDED,
-      INDEX,
-      JSON,
-      LANGUAGE,
-      LIST,
-      NEST,
-      NONE,
-      PREFIX,
-      PROPAGATE,
-      PROTECTED,
-      REVERSE,
-      SET,
-      TYPE,
-      VALUE,
-      VERSION,
-      VOCAB,
-            // See: https://w3c.github.io/json-ld-api/#api-keywords
-      PRESERVE,
-            // See: https://www.w3.org/TR/json-ld11-framing/#framing-keywords
-      DEFAULT,
-      EMBED,
-      "@always",
-      "@once",
-      "@never",
-      EXPLICIT,
-      ATNULL,
-      OMIT_DEFAULT,
-      REQUIRE_ALL,
-      ATNULL,
-      NONE,
-      ANY
-    };
-}
-
 bool JsonLdUtils::isKeyword(const std::string& str) {
-    return knownKeywords.count(str) > 0;
+    return Keywords::classify(str) != Keyword::NotAKeyword;
 }
 
 bool JsonLdUtils::isKeywordForm(const std::string& str) {
-    std::regex re(R"(@[A-Za-z]+)");
-    std::smatch match;
-    return std::regex_match(str, match, re);
+    // matches the ABNF rule "@"1*ALPHA
+    if (str.size() < 2 || str[0] != '@')
+        return false;
+    return std::all_of(str.begin() + 1, str.end(), [](char c) {
+        return (c >= 'A' && c <= 'Z') || (c >= 'a' && c <= 'z');
+    });
 }
 
 bool JsonLdUtils::isAbsoluteIri(const std::string &str) {
@@ -92,10 +49,15 @@ bool JsonLdUtils::isGraphObject(const json& j) {
     // node object. When expanded, a graph object must have an @graph entry, and
     // may also have @id, and @index entries.
     if(JsonLdUtils::isObject(j) && j.contains(GRAPH)) {
-        std::set<std::string> validKeywords {GRAPH, ID, INDEX};
         for (auto& el : j.items()) {
-            if(validKeywords.find(el.key()) == validKeywords.end())
-                return false;
+            switch (Keywords::classify(el.key())) {
+                case Keyword::Graph:
+                case Keyword::Id:
+                case Keyword::Index:
+                    break;
+                default:
+                    return false;
+            }
         }
         return true;
     }
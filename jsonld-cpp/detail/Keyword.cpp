@@ -0,0 +1,106 @@
+#include "jsonld-cpp/detail/Keyword.h"
+
+#include <cstddef>
+
+#include "jsonld-cpp/JsonLdConsts.h"
+
+namespace {
+
+    // indexed by Keyword
+    constexpr const char * keywordNames[] = {
+            "",
+            JsonLdConsts::ANY,
+            "@always",
+            JsonLdConsts::BASE,
+            JsonLdConsts::CONTAINER,
+            JsonLdConsts::CONTEXT,
+            JsonLdConsts::DEFAULT,
+            JsonLdConsts::DIRECTION,
+            JsonLdConsts::EMBED,
+            JsonLdConsts::EXPLICIT,
+            JsonLdConsts::GRAPH,
+            JsonLdConsts::ID,
+            JsonLdConsts::IMPORT,
+            JsonLdConsts::INCLUDED,
+            JsonLdConsts::INDEX,
+            JsonLdConsts::JSON,
+            JsonLdConsts::LANGUAGE,
+            JsonLdConsts::LIST,
+            JsonLdConsts::NEST,
+            "@never",
+            JsonLdConsts::NONE,
+            JsonLdConsts::ATNULL,
+            JsonLdConsts::OMIT_DEFAULT,
+            "@once",
+            JsonLdConsts::PREFIX,
+            JsonLdConsts::PRESERVE,
+            JsonLdConsts::PROPAGATE,
+            JsonLdConsts::PROTECTED,
+            JsonLdConsts::REQUIRE_ALL,
+            JsonLdConsts::REVERSE,
+            JsonLdConsts::SET,
+            JsonLdConsts::TYPE,
+            JsonLdConsts::VALUE,
+            JsonLdConsts::VERSION,
+            JsonLdConsts::VOCAB
+    };
+
+    constexpr std::size_t NUM_KEYWORDS = sizeof(keywordNames) / sizeof(keywordNames[0]);
+    static_assert(NUM_KEYWORDS == static_cast<std::size_t>(Keyword::Vocab) + 1,
+                  "keywordNames must have one entry for each Keyword");
+
+    // the shortest keywords ("@id") have three characters
+    constexpr std::size_t MIN_KEYWORD_LENGTH = 3;
+
+    constexpr std::size_t HASH_TABLE_SIZE = 128;
+
+    // The multipliers were chosen so that no two keywords hash to the same slot. The
+    // static_assert below fails if a keyword is added that breaks this.
+    constexpr std::size_t hash(unsigned char second, unsigned char last, std::size_t length) {
+        return (second * 4u + last * 38u + length) % HASH_TABLE_SIZE;
+    }
+
+    constexpr std::size_t length(const char * str) {
+        std::size_t n = 0;
+        while (str[n] != '\0')
+            n++;
+        return n;
+    }
+
+    struct KeywordTable {
+        Keyword slots[HASH_TABLE_SIZE];
+        bool perfect;
+    };
+
+    constexpr KeywordTable makeKeywordTable() {
+        KeywordTable table {};
+        table.perfect = true;
+        for (std::size_t i = 1; i < NUM_KEYWORDS; i++) {
+            std::size_t n = length(keywordNames[i]);
+            std::size_t slot = hash(static_cast<unsigned char>(keywordNames[i][1]),
+                                    static_cast<unsigned char>(keywordNames[i][n - 1]), n);
+            if (table.slots[slot] != Keyword::NotAKeyword)
+                table.perfect = false;
+            table.slots[slot] = static_cast<Keyword>(i);
+        }
+        return table;
+    }
+
+    constexpr KeywordTable keywordTable = makeKeywordTable();
+    static_assert(keywordTable.perfect, "keyword hash has collisions, choose other multipliers");
+
+}
+
+Keyword Keywords::classify(const std::string &str) {
+    if (str.size() < MIN_KEYWORD_LENGTH || str[0] != '@')
+        return Keyword::NotAKeyword;
+    Keyword keyword = keywordTable.slots[hash(static_cast<unsigned char>(str[1]),
+                                              static_cast<unsigned char>(str.back()), str.size())];
+    if (keyword != Keyword::NotAKeyword && str == keywordNames[static_cast<std::size_t>(keyword)])
+        return keyword;
+    return Keyword::NotAKeyword;
+}
+
+const char * Keywords::name(Keyword keyword) {
+    return keywordNames[static_cast<std::size_t>(keyword)];
+}
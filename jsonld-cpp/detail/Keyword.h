@@ -0,0 +1,68 @@
+#ifndef LIBJSONLD_CPP_KEYWORD_H
+#define LIBJSONLD_CPP_KEYWORD_H
+
+#include <string>
+
+/**
+ * The keywords known to the processor, including the API and framing keywords. Keys are
+ * classified once into a Keyword, so that keyword dispatch compares small integers
+ * instead of strings.
+ *
+ * See: https://www.w3.org/TR/json-ld11/#keywords
+ */
+enum class Keyword : unsigned char {
+    NotAKeyword,
+    Any,
+    Always,
+    Base,
+    Container,
+    Context,
+    Default,
+    Direction,
+    Embed,
+    Explicit,
+    Graph,
+    Id,
+    Import,
+    Included,
+    Index,
+    Json,
+    Language,
+    List,
+    Nest,
+    Never,
+    None,
+    Null,
+    OmitDefault,
+    Once,
+    Prefix,
+    Preserve,
+    Propagate,
+    Protected,
+    RequireAll,
+    Reverse,
+    Set,
+    Type,
+    Value,
+    Version,
+    Vocab
+};
+
+namespace Keywords {
+
+    /**
+     * Returns the keyword str is equal to, or Keyword::NotAKeyword if str is not a keyword.
+     * The keyword is looked up in a compile-time perfect hash table, so at most one string
+     * comparison is done.
+     */
+    Keyword classify(const std::string& str);
+
+    /**
+     * Returns the string form of keyword, such as "@id", or an empty string for
+     * Keyword::NotAKeyword.
+     */
+    const char * name(Keyword keyword);
+
+}
+
+#endif //LIBJSONLD_CPP_KEYWORD_H
@@ -0,0 +1,350 @@
+#include "jsonld-cpp/detail/NodeMap.h"
+
+#include <string>
+#include <utility>
+#include <vector>
+
+#include "jsonld-cpp/JsonLdConsts.h"
+#include "jsonld-cpp/JsonLdError.h"
+#include "jsonld-cpp/detail/JsonLdUtils.h"
+
+using json = nlohmann::ordered_json;
+
+namespace {
+
+    void generateNodeMap(json & element, nlohmann::json &nodeMap, BlankNodeNames &blankNodeNames,
+                         std::string *activeGraph, json *activeSubject,
+                         std::string *activeProperty, json *list)
+    {
+        // Comments in this function are labeled with numbers that correspond to sections
+        // from the description of the node map generation algorithm.
+        // See: https://www.w3.org/TR/json-ld11-api/#node-map-generation
+
+        // Also including some of the clarifications provided in the more recently published
+        // https://w3c.github.io/json-ld-api/#node-map-generation
+
+        // 1)
+        // If element is an array, process each item in element as follows and then return:
+        if (element.is_array()) {
+            // 1.1)
+            // Run this algorithm recursively by passing item for element, node map, active
+            // graph, active subject, active property, and list.
+            for (auto item : element) {
+                generateNodeMap(item, nodeMap, blankNodeNames, activeGraph, activeSubject, activeProperty, list);
+            }
+            return;
+        }
+
+        // 2)
+        // Otherwise element is a map. Reference the map which is the value of the active graph
+        // entry of node map using the variable graph. If the active subject is null or a
+        // map, set subject node to null otherwise reference the active subject entry of graph
+        // using the variable subject node.
+        if (!nodeMap.contains(*activeGraph)) {
+            nodeMap[*activeGraph] = json::object();
+        }
+        nlohmann::json & graph = nodeMap[*activeGraph];
+
+        nlohmann::json *subjectNode = nullptr;
+        if(activeSubject == nullptr || activeSubject->is_object()) {
+            subjectNode = nullptr;
+        }
+        else if (activeSubject->is_string() &&
+                graph.contains(activeSubject->get<std::string>())) {
+            subjectNode = &graph[activeSubject->get<std::string>()];
+        }
+
+        // 3)
+        // For each item in the @type entry of element, if any, or for the value of
+        // @type, if the value of @type exists and is not an array:
+        if (element.contains(JsonLdConsts::TYPE)) {
+            // 3.1)
+            // If item is a blank node identifier, replace it with a newly generated blank
+            // node identifier passing item for identifier.
+            json oldTypes;
+            json newTypes;
+            oldTypes = element[JsonLdConsts::TYPE];
+            for (const auto& item : oldTypes) {
+                std::string s = item.get<std::string>();
+                if (BlankNodeNames::hasFormOfBlankNodeName(s)) {
+                    newTypes.push_back(blankNodeNames.get(s));
+                } else {
+                    newTypes.push_back(item);
+                }
+            }
+            if(!newTypes.empty()) {
+                if (element[JsonLdConsts::TYPE].is_array())
+                    element[JsonLdConsts::TYPE] = newTypes;
+                else
+                    element[JsonLdConsts::TYPE] = newTypes.front();
+            }
+        }
+
+        // 4)
+        // If element has an @value entry, perform the following steps:
+        if (element.contains(JsonLdConsts::VALUE)) {
+            // 4.1)
+            // If list is null:
+            if (list == nullptr) {
+                // 4.1.1)
+                // If subject node (which must necessarily be a map) does not have an active
+                // property entry, create one and initialize its value to an array containing element.
+                // 4.1.2)
+                // Otherwise, compare element against every item in the array associated with
+                // the active property entry of subject node. If there is no item equivalent
+                // to element, append element to the array. Two maps are considered equal if
+                // they have equivalent map entries.
+                JsonLdUtils::mergeValue(*subjectNode, *activeProperty, element);
+            }
+            // 4.2)
+            // Otherwise, append element to the @list entry of list.
+            else {
+                list->at(JsonLdConsts::LIST).push_back(element);
+            }
+        }
+
+        // 5)
+        // Otherwise, if element has an @list entry, perform the following steps:
+        else if (element.contains(JsonLdConsts::LIST)) {
+            // 5.1)
+            // Initialize a new map result consisting of a single entry @list whose value
+            // is initialized to an empty array.
+            json result = { { JsonLdConsts::LIST, json::array() } };
+            // 5.2)
+            // Recursively call this algorithm passing the value of element's @list entry for
+            // element, node map, active graph, active subject, active property, and result for list.
+            generateNodeMap(element[JsonLdConsts::LIST], nodeMap, blankNodeNames, activeGraph, activeSubject,
+                            activeProperty, &result);
+            // 5.3)
+            // If list is null, append result to the value of the active property entry of subject
+            // node (which must necessarily be a map).
+            if (list == nullptr) {
+                JsonLdUtils::mergeValue(*subjectNode, *activeProperty, result);
+            }
+            // 5.4)
+            // Otherwise, append result to the @list entry of list.
+            else {
+                list->at(JsonLdConsts::LIST).push_back(result);
+            }
+        }
+
+        // 6)
+        // Otherwise element is a node object, perform the following steps:
+        else {
+            // 6.1)
+            // If element has an @id entry, set id to its value and remove the entry from
+            // element. If id is a blank node identifier, replace it with a newly generated
+            // blank node identifier passing id for identifier.
+            std::string id;
+            if(element.contains(JsonLdConsts::ID)) {
+                if(element[JsonLdConsts::ID].is_null()) // note: this can happen in some cases, see toRDF test e122. Ask on list?
+                    return;
+                id = element[JsonLdConsts::ID].get<std::string>();
+                element.erase(JsonLdConsts::ID);
+                if (BlankNodeNames::hasFormOfBlankNodeName(id)) {
+                    id = blankNodeNames.get(id);
+                }
+            }
+            // 6.2)
+            // Otherwise, set id to the result of the Generate Blank Node Identifier algorithm
+            // passing null for identifier.
+            else {
+                id = blankNodeNames.get();
+            }
+            // 6.3)
+            // If graph does not contain an entry id, create one and initialize its value to
+            // a map consisting of a single entry @id whose value is id.
+            if (!graph.contains(id)) {
+                json tmp = { { JsonLdConsts::ID, id } };
+                graph[id] = tmp;
+            }
+            // 6.4)
+            // Reference the value of the id entry of graph using the variable node.
+            nlohmann::json &node = graph[id];
+
+            // 6.5)
+            // If active subject is a map, a reverse property relationship is being
+            // processed. Perform the following steps:
+            if (activeSubject != nullptr && activeSubject->is_object()) {
+                // 6.5.1)
+                // If node does not have a active property entry, create one and initialize its
+                // value to an array containing active subject.
+                // 6.5.2
+                // Otherwise, compare active subject against every item in the array associated
+                // with the active property entry of node. If there is no item equivalent to
+                // active subject, append active subject to the array. Two maps are considered
+                // equal if they have equivalent map entries.
+                JsonLdUtils::mergeValue(node, *activeProperty, *activeSubject);
+            }
+            // 6.6)
+            // Otherwise, if active property is not null, perform the following steps:
+            else if (activeProperty != nullptr) {
+                // 6.6.1)
+                // Create a new map reference consisting of a single entry @id whose value is id.
+                json reference = { { JsonLdConsts::ID, id } };
+                // 6.6.2)
+                // If list is null:
+                if (list == nullptr) {
+                    // 6.6.2.1)
+                    // If subject node does not have an active property entry, create one and
+                    // initialize its value to an array containing reference.
+                    // 6.6.2.2)
+                    // Otherwise, compare reference against every item in the array associated
+                    // with the active property entry of subject node. If there is no item
+                    // equivalent to reference, append reference to the array. Two maps are
+                    // considered equal if they have equivalent map entries.
+                    if(activeSubject == nullptr || activeSubject->is_object()) {
+                        subjectNode = nullptr;
+                    }
+                    else if (activeSubject->is_string() &&
+                            graph.contains(activeSubject->get<std::string>())) {
+                        subjectNode = &graph[activeSubject->get<std::string>()];
+                    }
+
+                    JsonLdUtils::mergeValue(*subjectNode, *activeProperty, reference);
+                }
+                // 6.6.3)
+                // Otherwise, append reference to the @list entry of list.
+                else {
+                    list->at(JsonLdConsts::LIST).push_back(reference);
+                }
+            }
+            // 6.7)
+            // If element has an @type entry, append each item of its associated array to the array
+            // associated with the @type entry of node unless it is already in that array. Finally
+            // remove the @type entry from element.
+            if (element.contains(JsonLdConsts::TYPE)) {
+                for (const auto& type : element[JsonLdConsts::TYPE]) {
+                    JsonLdUtils::mergeValue(node, JsonLdConsts::TYPE, type);
+                }
+                element.erase(JsonLdConsts::TYPE);
+            }
+            // 6.8)
+            // If element has an @index entry, set the @index entry of node to its value. If node
+            // already has an @index entry with a different value, a conflicting indexes error has
+            // been detected and processing is aborted. Otherwise, continue by removing the @index
+            // entry from element.
+            if (element.contains(JsonLdConsts::INDEX)) {
+                nlohmann::json elemIndex = element[JsonLdConsts::INDEX];
+                if (node.contains(JsonLdConsts::INDEX)) {
+                    if (node.at(JsonLdConsts::INDEX) != elemIndex) {
+                        throw JsonLdError(JsonLdError::ConflictingIndexes);
+                    }
+                }
+                node[JsonLdConsts::INDEX] = elemIndex;
+                element.erase(JsonLdConsts::INDEX);
+            }
+            // 6.9)
+            // If element has an @reverse entry:
+            if (element.contains(JsonLdConsts::REVERSE)) {
+                // 6.9.1)
+                // Create a map referenced node with a single entry @id whose value is id.
+                json referencedNode = { { JsonLdConsts::ID, id } };
+                // 6.9.2)
+                // Initialize reverse map to the value of the @reverse entry of element.
+                json reverseMap = element[JsonLdConsts::REVERSE];
+                // 6.9.3)
+                // For each key-value pair property-values in reverse map:
+                std::vector<std::string> reverseMap_keys;
+                for (json::iterator it = reverseMap.begin(); it != reverseMap.end(); ++it) {
+                    reverseMap_keys.push_back(it.key());
+                }
+                for (auto property : reverseMap_keys) {
+                    json values = reverseMap[property];
+                    // 6.9.3.1)
+                    // For each value of values:
+                    for (auto reverseMap_value : values) {
+                        // 6.9.3.1.1)
+                        // Recursively invoke this algorithm passing value for element, node
+                        // map, active graph, referenced node for active subject, and property
+                        // for active property. Passing a map for active subject indicates to
+                        // the algorithm that a reverse property relationship is being processed.
+                        generateNodeMap(reverseMap_value, nodeMap, blankNodeNames, activeGraph,
+                                        &referencedNode, &property, nullptr);
+                    }
+                }
+                // 6.9.4)
+                // Remove the @reverse entry from element.
+                element.erase(JsonLdConsts::REVERSE);
+            }
+            // 6.10)
+            // If element has an @graph entry, recursively invoke this algorithm passing the value
+            // of the @graph entry for element, node map, and id for active graph before removing
+            // the @graph entry from element.
+            if (element.contains(JsonLdConsts::GRAPH)) {
+                json elemGraph = element[JsonLdConsts::GRAPH];
+                generateNodeMap(elemGraph, nodeMap, blankNodeNames, &id, nullptr, nullptr, nullptr);
+                element.erase(JsonLdConsts::GRAPH);
+            }
+            // 6.11)
+            // If element has an @included entry, recursively invoke this algorithm passing
+            // the value of the @included entry for element, node map, and active graph before
+            // removing the @included entry from element.
+            if (element.contains(JsonLdConsts::INCLUDED)) {
+                json elemIncluded = element[JsonLdConsts::INCLUDED];
+                generateNodeMap(elemIncluded, nodeMap, blankNodeNames, activeGraph, nullptr, nullptr, nullptr);
+                element.erase(JsonLdConsts::INCLUDED);
+            }
+            // 6.12)
+            // Finally, for each key-value pair property-value in element ordered by property
+            // perform the following steps:
+            std::vector<std::string> keys;
+            for (json::iterator it = element.begin(); it != element.end(); ++it) {
+                keys.push_back(it.key());
+            }
+
+            // Note: The above statement for step 6.12 states "...ordered by property..."
+            // but if we run this sort here, then toRDF test c019 will fail.
+            // See https://github.com/w3c/json-ld-api/issues/586
+
+            // std::sort(keys.begin(), keys.end());
+
+            for (auto property : keys) {
+                json & propertyValue = element[property];
+                // 6.12.1)
+                // If property is a blank node identifier, replace it with a newly generated
+                // blank node identifier passing property for identifier.
+                if (BlankNodeNames::hasFormOfBlankNodeName(property)) {
+                    property = blankNodeNames.get(property);
+                }
+                // 6.12.2)
+                // If node does not have a property entry, create one and initialize its value
+                // to an empty array.
+                if (!node.contains(property)) {
+                    node[property] = json::array();
+                }
+                // 6.12.3)
+                // Recursively invoke this algorithm passing value for element, node map, active
+                // graph, id for active subject, and property for active property.
+                json jid = id;
+                generateNodeMap(propertyValue, nodeMap, blankNodeNames, activeGraph, &jid, &property, nullptr);
+            }
+        }
+    }
+
+}
+
+NodeMap::NodeMap()
+    : nodeMap(nlohmann::json::object())
+{
+    nodeMap[JsonLdConsts::DEFAULT] = nlohmann::json::object();
+}
+
+NodeMap::NodeMap(BlankNodeNames iblankNodeNames)
+    : NodeMap()
+{
+    blankNodeNames = std::move(iblankNodeNames);
+}
+
+void NodeMap::add(json & element) {
+    std::string defaultGraph(JsonLdConsts::DEFAULT);
+    generateNodeMap(element, nodeMap, blankNodeNames, &defaultGraph, nullptr, nullptr, nullptr);
+}
+
+const nlohmann::json & NodeMap::getGraphs() const {
+    return nodeMap;
+}
+
+BlankNodeNames & NodeMap::getBlankNodeNames() {
+    return blankNodeNames;
+}
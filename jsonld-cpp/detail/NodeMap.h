@@ -0,0 +1,56 @@
+#ifndef LIBJSONLD_CPP_NODEMAP_H
+#define LIBJSONLD_CPP_NODEMAP_H
+
+#include "jsonld-cpp/jsoninc.h"
+#include "jsonld-cpp/BlankNodeNames.h"
+
+/**
+ * A node map, as generated by the Node Map Generation algorithm: a map from each graph
+ * name (@default for the default graph) to a map from each node identifier to the node
+ * object with all of its properties, collected from everywhere it appears in a document.
+ *
+ * The blank node identifiers issued while generating the node map are kept with it, so
+ * that the algorithms that consume it (flattening and deserializing to RDF) label any
+ * blank nodes they create consistently. A document only needs to be expanded and have
+ * its node map generated once to produce all of those outputs.
+ *
+ * https://www.w3.org/TR/json-ld11-api/#node-map-generation
+ */
+class NodeMap {
+private:
+
+    nlohmann::json nodeMap;
+    BlankNodeNames blankNodeNames;
+
+public:
+
+    NodeMap();
+
+    /**
+     * Creates an empty node map that continues issuing blank node identifiers from
+     * blankNodeNames, so that identifiers stay consistent across several node maps.
+     */
+    explicit NodeMap(BlankNodeNames blankNodeNames);
+
+    /**
+     * Node Map Generation Algorithm
+     *
+     * Adds the nodes of element, an expanded JSON-LD document or part of one, to this node
+     * map. Blank node identifiers in element are relabeled, and may be modified in place.
+     *
+     * https://www.w3.org/TR/json-ld11-api/#node-map-generation
+     *
+     * @throws JsonLdError
+     *             If the same node has conflicting @index values.
+     */
+    void add(nlohmann::ordered_json & element);
+
+    /**
+     * Returns the map from graph name to graph. It always contains the @default graph.
+     */
+    const nlohmann::json & getGraphs() const;
+
+    BlankNodeNames & getBlankNodeNames();
+};
+
+#endif //LIBJSONLD_CPP_NODEMAP_H
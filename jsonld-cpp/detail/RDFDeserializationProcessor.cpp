@@ -0,0 +1,627 @@
+#include "jsonld-cpp/detail/RDFDeserializationProcessor.h"
+
+#include <algorithm>
+#include <cerrno>
+#include <cstdlib>
+#include <string>
+#include <unordered_map>
+#include <unordered_set>
+#include <vector>
+
+#include "jsonld-cpp/JsonLdConsts.h"
+#include "jsonld-cpp/JsonLdError.h"
+#include "jsonld-cpp/JsonLdOptions.h"
+#include "jsonld-cpp/RDFDataset.h"
+#include "jsonld-cpp/RDFNode.h"
+#include "jsonld-cpp/detail/WellFormed.h"
+
+using json = nlohmann::ordered_json;
+
+namespace {
+
+    using RDF::Node;
+
+    const char I18N_NS[] = "https://www.w3.org/ns/i18n#";
+
+    // A reference to one value in the node map: value number `value` of `property` in
+    // the node at position `node` of graph number `graph`. Values are only ever appended
+    // while the node map is built, so a Usage stays valid until the lists are converted.
+    struct Usage {
+        std::size_t graph;
+        std::size_t node;
+        std::string property;
+        std::size_t value;
+    };
+
+    // The nodes of one graph in the order they are first seen, indexed by identifier
+    struct GraphNodes {
+        std::vector<json> nodes;
+        std::unordered_map<std::string, std::size_t> positions;
+
+        // uses of rdf:nil as an object in this graph
+        std::vector<Usage> nilUsages;
+
+        // subjects having an rdf:direction property, in the order they are first seen
+        std::vector<std::string> compoundLiteralSubjects;
+        std::unordered_set<std::string> compoundLiteralSubjectSet;
+
+        // Returns the position of the node with identifier id, adding a new node object
+        // with only an @id entry if there is none.
+        std::size_t nodePosition(const std::string & id) {
+            auto it = positions.find(id);
+            if (it != positions.end())
+                return it->second;
+            json node = json::object();
+            node[JsonLdConsts::ID] = id;
+            positions.emplace(id, nodes.size());
+            nodes.push_back(std::move(node));
+            return nodes.size() - 1;
+        }
+
+        bool contains(const std::string & id) const {
+            return positions.count(id) > 0;
+        }
+
+        // Removes the node with identifier id. Positions of other nodes are unchanged.
+        json remove(const std::string & id) {
+            auto it = positions.find(id);
+            if (it == positions.end())
+                return json();
+            json node = std::move(nodes[it->second]);
+            nodes[it->second] = json();
+            positions.erase(it);
+            return node;
+        }
+    };
+
+    // A blank node used as an object: its single usage, or once set to false, if it is
+    // used more than once.
+    struct Reference {
+        bool once;
+        Usage usage;
+    };
+
+    bool hasOnlyId(const json & node) {
+        return node.size() == 1 && node.contains(JsonLdConsts::ID);
+    }
+
+    bool isBlankNodeIdentifier(const std::string & id) {
+        return id.compare(0, 2, "_:") == 0;
+    }
+
+    bool isIntegerLexicalForm(const std::string & value) {
+        std::size_t i = (!value.empty() && (value[0] == '+' || value[0] == '-')) ? 1 : 0;
+        if (i == value.size())
+            return false;
+        return std::all_of(value.begin() + i, value.end(), [](char c) { return c >= '0' && c <= '9'; });
+    }
+
+    bool isDoubleLexicalForm(const std::string & value) {
+        std::size_t i = 0;
+        auto digits = [&]() {
+            std::size_t start = i;
+            while (i < value.size() && value[i] >= '0' && value[i] <= '9')
+                i++;
+            return i - start;
+        };
+        if (i < value.size() && (value[i] == '+' || value[i] == '-'))
+            i++;
+        std::size_t mantissaDigits = digits();
+        if (i < value.size() && value[i] == '.') {
+            i++;
+            mantissaDigits += digits();
+        }
+        if (mantissaDigits == 0)
+            return false;
+        if (i < value.size() && (value[i] == 'e' || value[i] == 'E')) {
+            i++;
+            if (i < value.size() && (value[i] == '+' || value[i] == '-'))
+                i++;
+            if (digits() == 0)
+                return false;
+        }
+        return i == value.size();
+    }
+
+    /**
+     * RDF to Object Conversion
+     *
+     * https://www.w3.org/TR/json-ld11-api/#rdf-to-object-conversion
+     */
+    json rdfToObject(const Node & value, const JsonLdOptions & options) {
+
+        // Comments in this function are labeled with numbers that correspond to sections
+        // from the description of the RDF to Object Conversion algorithm.
+        // See: https://www.w3.org/TR/json-ld11-api/#rdf-to-object-conversion
+
+        // 1)
+        // If value is an IRI or a blank node identifier, return a new map consisting of a
+        // single entry @id whose value is set to value.
+        if (!value.isLiteral()) {
+            json result = json::object();
+            result[JsonLdConsts::ID] = value.getValue();
+            return result;
+        }
+
+        // 2)
+        // Otherwise value is an RDF literal:
+
+        // 2.1-3)
+        // Initialize a new empty map result, converted value to value and type to null.
+        json result = json::object();
+        std::string lexicalForm = value.getValue();
+        json convertedValue = lexicalForm;
+        std::string datatype = value.getDatatype();
+        std::string language = value.getLanguage();
+        std::string type;
+
+        // Note: a language-tagged string is checked first, as its datatype is
+        // rdf:langString, which must not become the @type of the value object.
+        if (!language.empty()) {
+
+            // 2.7)
+            // Otherwise, if value is a language-tagged string add an entry @language to
+            // result and set its value to the language tag of value.
+            result[JsonLdConsts::VALUE] = convertedValue;
+            result[JsonLdConsts::LANGUAGE] = language;
+            return result;
+        }
+
+        // 2.4)
+        // If useNativeTypes is true:
+        if (options.getUseNativeTypes() && datatype != JsonLdConsts::XSD_STRING) {
+
+            // 2.4.2)
+            // If the datatype IRI of value equals xsd:boolean, set converted value to true if
+            // the lexical form of value matches true, or false if it matches false. If it
+            // matches neither, set type to xsd:boolean.
+            if (datatype == JsonLdConsts::XSD_BOOLEAN) {
+                if (lexicalForm == "true")
+                    convertedValue = true;
+                else if (lexicalForm == "false")
+                    convertedValue = false;
+                else
+                    type = datatype;
+            }
+
+            // 2.4.3)
+            // Otherwise, if the datatype IRI of value equals xsd:integer or xsd:double and
+            // its lexical form is a valid xsd:integer or xsd:double, set converted value to
+            // the result of converting the lexical form to a JSON number.
+            else if (datatype == JsonLdConsts::XSD_INTEGER && isIntegerLexicalForm(lexicalForm)) {
+                errno = 0;
+                long long integer = std::strtoll(lexicalForm.c_str(), nullptr, 10);
+                if (errno == ERANGE)
+                    type = datatype;
+                else
+                    convertedValue = integer;
+            }
+            else if (datatype == JsonLdConsts::XSD_DOUBLE && isDoubleLexicalForm(lexicalForm)) {
+                errno = 0;
+                double number = std::strtod(lexicalForm.c_str(), nullptr);
+                if (errno == ERANGE)
+                    type = datatype;
+                else
+                    convertedValue = number;
+            }
+
+            // 2.4.4)
+            // Otherwise, set type to the datatype IRI of value.
+            else
+                type = datatype;
+        }
+
+        // 2.5)
+        // Otherwise, if processing mode is not json-ld-1.0, and value is a JSON literal, set
+        // converted value to the result of turning the lexical value of value into the
+        // JSON-LD internal representation, and set type to @json. If the lexical value of
+        // value is not valid JSON according to the JSON Grammar [RFC8259], an invalid JSON
+        // literal error has been detected and processing is aborted.
+        else if (options.getProcessingMode() != JsonLdConsts::JSON_LD_1_0 && datatype == JsonLdConsts::RDF_JSON) {
+            try {
+                convertedValue = json::parse(lexicalForm);
+            }
+            catch (const json::parse_error &) {
+                throw JsonLdError(JsonLdError::InvalidJsonLiteral, lexicalForm);
+            }
+            type = JsonLdConsts::JSON;
+        }
+
+        // 2.6)
+        // Otherwise, if the datatype IRI of value starts with https://www.w3.org/ns/i18n#,
+        // and rdfDirection is i18n-datatype, add an entry @language to result with the
+        // value of the fragment before the underscore, if it is not empty, and an entry
+        // @direction with the value of the fragment after the underscore.
+        else if (options.getRdfDirection() == "i18n-datatype" && datatype.compare(0, sizeof(I18N_NS) - 1, I18N_NS) == 0) {
+            std::string fragment = datatype.substr(sizeof(I18N_NS) - 1);
+            std::size_t underscore = fragment.find('_');
+            if (underscore != std::string::npos) {
+                if (underscore > 0)
+                    result[JsonLdConsts::LANGUAGE] = fragment.substr(0, underscore);
+                result[JsonLdConsts::DIRECTION] = fragment.substr(underscore + 1);
+            }
+            else
+                type = datatype;
+        }
+
+        // 2.8)
+        // Otherwise, if the datatype IRI of value is not xsd:string, set type to the
+        // datatype IRI of value.
+        else if (datatype != JsonLdConsts::XSD_STRING)
+            type = datatype;
+
+        // 2.9-11)
+        // Add an entry @value to result whose value is converted value. If type is not
+        // null, add an entry @type to result whose value is type. Return result.
+        json valueObject = json::object();
+        valueObject[JsonLdConsts::VALUE] = std::move(convertedValue);
+        for (auto & el : result.items())
+            valueObject[el.key()] = std::move(el.value());
+        if (!type.empty())
+            valueObject[JsonLdConsts::TYPE] = type;
+        return valueObject;
+    }
+
+    // A well-formed list node is a blank node with exactly one rdf:first value and one
+    // rdf:rest value, and optionally an rdf:type of rdf:List.
+    bool isWellFormedListNode(const json & node) {
+        if (!node.is_object() || !node.contains(JsonLdConsts::RDF_FIRST) || !node.contains(JsonLdConsts::RDF_REST))
+            return false;
+        if (node.at(JsonLdConsts::RDF_FIRST).size() != 1 || node.at(JsonLdConsts::RDF_REST).size() != 1)
+            return false;
+        if (node.size() == 3)
+            return true;
+        return node.size() == 4 && node.contains(JsonLdConsts::TYPE) &&
+               node.at(JsonLdConsts::TYPE) == json::array({JsonLdConsts::RDF_LIST});
+    }
+
+    // A list found from a use of rdf:nil: the value that becomes the list object, and
+    // the positions of its list nodes in graph number graph, starting with the last one
+    struct ListConversion {
+        const Usage * head;
+        std::size_t graph;
+        std::vector<std::size_t> nodes;
+        bool converted;
+    };
+
+    // Converts list number index to a list object, first converting any lists whose head
+    // is a value of one of its list nodes.
+    void convertList(std::size_t index,
+                     std::vector<ListConversion> & lists,
+                     const std::unordered_map<std::size_t, std::vector<std::size_t>> & listsByHeadNode,
+                     std::vector<GraphNodes> & graphs) {
+        ListConversion & listConversion = lists[index];
+        if (listConversion.converted)
+            return;
+        listConversion.converted = true;
+
+        GraphNodes & graph = graphs[listConversion.graph];
+        json list = json::array();
+        for (auto it = listConversion.nodes.rbegin(); it != listConversion.nodes.rend(); ++it) {
+            auto nested = listsByHeadNode.find(*it);
+            if (nested != listsByHeadNode.end()) {
+                for (std::size_t nestedIndex : nested->second)
+                    convertList(nestedIndex, lists, listsByHeadNode, graphs);
+            }
+            list.push_back(std::move(graph.nodes[*it][JsonLdConsts::RDF_FIRST][0]));
+        }
+
+        const Usage & head = *listConversion.head;
+        json & headValue = graphs[head.graph].nodes[head.node][head.property][head.value];
+        headValue.erase(JsonLdConsts::ID);
+        headValue[JsonLdConsts::LIST] = std::move(list);
+    }
+
+    // positions of the nodes of graph to output, ordered by identifier if ordered is true
+    std::vector<std::size_t> outputOrder(const GraphNodes & graph, bool ordered) {
+        std::vector<std::size_t> order;
+        order.reserve(graph.positions.size());
+        for (std::size_t i = 0; i < graph.nodes.size(); i++) {
+            if (!graph.nodes[i].is_null())
+                order.push_back(i);
+        }
+        if (ordered) {
+            std::sort(order.begin(), order.end(), [&graph](std::size_t lhs, std::size_t rhs) {
+                return graph.nodes[lhs].at(JsonLdConsts::ID).get_ref<const std::string &>() <
+                       graph.nodes[rhs].at(JsonLdConsts::ID).get_ref<const std::string &>();
+            });
+        }
+        return order;
+    }
+
+}
+
+json RDFDeserializationProcessor::fromRDF(const RDF::RDFDataset & dataset, const JsonLdOptions & options) {
+
+    // Comments in this function are labeled with numbers that correspond to sections
+    // from the description of the Serialize RDF as JSON-LD algorithm.
+    // See: https://www.w3.org/TR/json-ld11-api/#serialize-rdf-as-json-ld-algorithm
+
+    bool compoundLiterals = options.getRdfDirection() == "compound-literal";
+
+    // 1-2)
+    // Initialize default graph to an empty map, and graph map to a map consisting of a
+    // single entry @default whose value references default graph.
+    std::vector<GraphNodes> graphs(1);
+    std::unordered_map<std::string, std::size_t> graphPositions;
+    graphPositions.emplace(JsonLdConsts::DEFAULT, 0);
+
+    // 3)
+    // Initialize referenced once to an empty map.
+    std::unordered_map<std::string, Reference> referencedOnce;
+
+    // Values converted to native types are the only values that two different triples
+    // can share, so they are the only ones checked for duplicates, see 5.7.8.
+    std::unordered_set<std::string> nativeValues;
+
+    // 5)
+    // For each graph in dataset:
+    for (const auto & namedGraph : dataset) {
+
+        // 5.1)
+        // If graph is the default graph, set name to @default, otherwise to the graph name
+        // associated with graph.
+        const std::string & name = namedGraph.first;
+
+        // 5.2)
+        // If graph map has no name entry, create one and set its value to an empty map.
+        auto graphPosition = graphPositions.find(name);
+        if (graphPosition == graphPositions.end()) {
+            graphPosition = graphPositions.emplace(name, graphs.size()).first;
+            graphs.emplace_back();
+        }
+        std::size_t graphIndex = graphPosition->second;
+
+        // 5.4)
+        // If graph is not the default graph and default graph does not have a name entry,
+        // create such an entry and initialize its value to a new map with a single entry
+        // @id whose value is name.
+        if (name != JsonLdConsts::DEFAULT)
+            graphs[0].nodePosition(name);
+
+        // 5.5)
+        // Reference the value of the name entry in graph map using the variable node map.
+        GraphNodes & nodeMap = graphs[graphIndex];
+
+        // 5.7)
+        // For each triple in graph consisting of subject, predicate, and object:
+        for (const auto & triple : namedGraph.second) {
+            std::string subject = triple.getSubject()->getValue();
+            std::string predicate = triple.getPredicate()->getValue();
+            const Node & object = *triple.getObject();
+
+            // 5.7.1-2)
+            // If node map does not have a subject entry, create one and initialize its value
+            // to a new map consisting of a single entry @id whose value is set to subject.
+            // Reference the value of the subject entry in node map using the variable node.
+            std::size_t nodePosition = nodeMap.nodePosition(subject);
+
+            // 5.7.3)
+            // If the rdfDirection option is compound-literal and predicate is rdf:direction,
+            // add an entry in compound map for subject.
+            if (compoundLiterals && predicate == JsonLdConsts::RDF_DIRECTION &&
+                nodeMap.compoundLiteralSubjectSet.insert(subject).second)
+                nodeMap.compoundLiteralSubjects.push_back(subject);
+
+            // 5.7.4)
+            // If object is an IRI or blank node identifier, and node map does not have an
+            // object entry, create one and initialize its value to a new map consisting of a
+            // single entry @id whose value is set to object.
+            std::string objectValue;
+            if (!object.isLiteral()) {
+                objectValue = object.getValue();
+                nodeMap.nodePosition(objectValue);
+            }
+
+            json & node = nodeMap.nodes[nodePosition];
+
+            // 5.7.5)
+            // If predicate equals rdf:type, the useRdfType flag is not true, and object is an
+            // IRI or blank node identifier, append object to the value of the @type entry of
+            // node.
+            // Note: the triples of an RDFGraph are unique, so object is not already a value
+            // of @type.
+            if (predicate == JsonLdConsts::RDF_TYPE && !options.getUseRdfType() && !object.isLiteral()) {
+                if (!node.contains(JsonLdConsts::TYPE))
+                    node[JsonLdConsts::TYPE] = json::array();
+                node[JsonLdConsts::TYPE].push_back(objectValue);
+                continue;
+            }
+
+            // 5.7.6)
+            // Set value to the result of using the RDF to Object Conversion algorithm,
+            // passing object, rdfDirection, and useNativeTypes.
+            json value = rdfToObject(object, options);
+
+            // 5.7.7)
+            // If node does not have a predicate entry, create one and initialize its value to
+            // an empty array.
+            if (!node.contains(predicate))
+                node[predicate] = json::array();
+            json & values = node[predicate];
+
+            // 5.7.8)
+            // If there is no value in node[predicate] equivalent to value, append value.
+            // Note: the triples of an RDFGraph are unique, so value can only be equivalent to
+            // an earlier value if both were converted to the same native type value.
+            if (object.isLiteral() && value.at(JsonLdConsts::VALUE).is_primitive() &&
+                !value.at(JsonLdConsts::VALUE).is_string()) {
+                std::string key = std::to_string(graphIndex) + '\n' + subject + '\n' + predicate + '\n' + value.dump();
+                if (!nativeValues.insert(key).second)
+                    continue;
+            }
+            Usage usage{graphIndex, nodePosition, predicate, values.size()};
+            values.push_back(std::move(value));
+
+            // 5.7.9)
+            // If object is rdf:nil, append a reference to this usage to the @usages of the
+            // object entry of node map.
+            if (!object.isLiteral() && objectValue == JsonLdConsts::RDF_NIL)
+                nodeMap.nilUsages.push_back(std::move(usage));
+
+            // 5.7.10)
+            // Otherwise, if referenced once has an entry for object, set the object entry of
+            // referenced once to false.
+            // 5.7.11)
+            // Otherwise, if object is a blank node identifier, it might represent a list
+            // node, so set the object entry of referenced once to usage.
+            else if (object.isBlankNode()) {
+                auto it = referencedOnce.find(objectValue);
+                if (it != referencedOnce.end())
+                    it->second.once = false;
+                else
+                    referencedOnce.emplace(objectValue, Reference{true, std::move(usage)});
+            }
+        }
+    }
+
+    // 6)
+    // For each name and graph object in graph map:
+    for (std::size_t graphIndex = 0; graphIndex < graphs.size(); graphIndex++) {
+        GraphNodes & graphObject = graphs[graphIndex];
+
+        // 6.1)
+        // If compound literal subjects has an entry for name, for each cl in it, replace
+        // the single reference to the node cl with a value object built from cl's
+        // rdf:value, rdf:language and rdf:direction, and remove cl from graph object.
+        for (const auto & cl : graphObject.compoundLiteralSubjects) {
+            auto clEntry = referencedOnce.find(cl);
+            if (clEntry == referencedOnce.end() || !clEntry->second.once)
+                continue;
+            const Usage & usage = clEntry->second.usage;
+            json clNode = graphObject.remove(cl);
+            if (!clNode.is_object())
+                continue;
+
+            json & node = graphs[usage.graph].nodes[usage.node];
+            for (auto & clReference : node[usage.property]) {
+                if (!clReference.contains(JsonLdConsts::ID) || clReference.at(JsonLdConsts::ID) != cl)
+                    continue;
+                clReference.erase(JsonLdConsts::ID);
+                if (clNode.contains(JsonLdConsts::RDF_VALUE))
+                    clReference[JsonLdConsts::VALUE] = clNode.at(JsonLdConsts::RDF_VALUE).at(0).at(JsonLdConsts::VALUE);
+                if (clNode.contains(JsonLdConsts::RDF_LANGUAGE)) {
+                    const json & language = clNode.at(JsonLdConsts::RDF_LANGUAGE).at(0).at(JsonLdConsts::VALUE);
+                    if (!language.is_string() || !WellFormed::language(language.get<std::string>()))
+                        throw JsonLdError(JsonLdError::InvalidLanguageTaggedString, language);
+                    clReference[JsonLdConsts::LANGUAGE] = language;
+                }
+                if (clNode.contains(JsonLdConsts::RDF_DIRECTION)) {
+                    const json & direction = clNode.at(JsonLdConsts::RDF_DIRECTION).at(0).at(JsonLdConsts::VALUE);
+                    if (direction != "ltr" && direction != "rtl")
+                        throw JsonLdError(JsonLdError::InvalidBaseDirection, direction);
+                    clReference[JsonLdConsts::DIRECTION] = direction;
+                }
+            }
+        }
+
+        // 6.2-4)
+        // If graph object has an rdf:nil entry, for each usage of it:
+        // Note: lists are found first and converted afterwards, so that a list nested in
+        // the rdf:first value of a list node is converted before that value is moved into
+        // its enclosing list.
+        std::vector<ListConversion> lists;
+        std::unordered_map<std::size_t, std::vector<std::size_t>> listsByHeadNode;
+        for (const auto & nilUsage : graphObject.nilUsages) {
+
+            // 6.4.1)
+            // Initialize node to the value of the node entry of usage, property to the value
+            // of the property entry of usage, and head to the value of the value entry of
+            // usage.
+            const Usage * usage = &nilUsage;
+            const Usage * head = &nilUsage;
+
+            // 6.4.2)
+            // Initialize two empty arrays list and list nodes.
+            std::vector<std::size_t> listNodes;
+
+            // 6.4.3)
+            // While property equals rdf:rest, the value of the @id entry of node is a blank
+            // node identifier, the value of the entry of referenced once associated with the
+            // @id entry of node is a map, node is a well-formed list node:
+            // Note: only list nodes in graph object are followed.
+            while (usage->property == JsonLdConsts::RDF_REST && usage->graph == graphIndex) {
+                const json & node = graphObject.nodes[usage->node];
+                const std::string & id = node.at(JsonLdConsts::ID).get_ref<const std::string &>();
+                if (!isBlankNodeIdentifier(id) || !isWellFormedListNode(node))
+                    break;
+                auto reference = referencedOnce.find(id);
+                if (reference == referencedOnce.end() || !reference->second.once)
+                    break;
+
+                // 6.4.3.1-2)
+                // Append the only item of rdf:first entry in node to the list array, and
+                // the value of the @id entry in node to the list nodes array.
+                listNodes.push_back(usage->node);
+
+                // 6.4.3.3-4)
+                // Initialize node usage to the value of the @id entry of node in referenced
+                // once, and set node, property and head from node usage.
+                usage = &reference->second.usage;
+                head = usage;
+
+                // 6.4.3.5)
+                // If the @id entry of node is an IRI instead of a blank node identifier,
+                // exit the while loop.
+                const json & nextNode = graphs[usage->graph].nodes[usage->node];
+                if (!nextNode.is_object() ||
+                    !isBlankNodeIdentifier(nextNode.at(JsonLdConsts::ID).get_ref<const std::string &>()))
+                    break;
+            }
+
+            if (head->graph == graphIndex)
+                listsByHeadNode[head->node].push_back(lists.size());
+            lists.push_back(ListConversion{head, graphIndex, std::move(listNodes), false});
+        }
+
+        // 6.4.4-6)
+        // Remove the @id entry from head, reverse the order of the list array, and add an
+        // @list entry to head and initialize its value to the list array.
+        for (std::size_t i = 0; i < lists.size(); i++)
+            convertList(i, lists, listsByHeadNode, graphs);
+
+        // 6.4.7)
+        // For each item node id in list nodes, remove its entry from graph object.
+        for (const auto & listConversion : lists) {
+            for (std::size_t position : listConversion.nodes)
+                graphObject.remove(graphObject.nodes[position].at(JsonLdConsts::ID).get<std::string>());
+        }
+    }
+
+    // 7)
+    // Initialize an empty array result.
+    json result = json::array();
+
+    // 8)
+    // For each subject and node in default graph ordered by subject if ordered is true:
+    GraphNodes & defaultGraph = graphs[0];
+    for (std::size_t position : outputOrder(defaultGraph, options.isOrdered())) {
+        json & node = defaultGraph.nodes[position];
+        const std::string subject = node.at(JsonLdConsts::ID).get<std::string>();
+
+        // 8.1)
+        // If graph map has a subject entry, add an @graph entry to node holding the nodes
+        // of that graph, ordered by @id if ordered is true, except those whose only entry
+        // is @id.
+        auto graphPosition = graphPositions.find(subject);
+        if (subject != JsonLdConsts::DEFAULT && graphPosition != graphPositions.end()) {
+            GraphNodes & graph = graphs[graphPosition->second];
+            json graphNodes = json::array();
+            for (std::size_t graphNodePosition : outputOrder(graph, options.isOrdered())) {
+                json & graphNode = graph.nodes[graphNodePosition];
+                if (!hasOnlyId(graphNode))
+                    graphNodes.push_back(std::move(graphNode));
+            }
+            node[JsonLdConsts::GRAPH] = std::move(graphNodes);
+        }
+
+        // 8.2)
+        // Append node to result, unless the only entry of node is @id.
+        if (!hasOnlyId(node))
+            result.push_back(std::move(node));
+    }
+
+    // 9)
+    // Return result.
+    return result;
+}
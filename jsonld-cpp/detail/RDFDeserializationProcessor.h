@@ -0,0 +1,37 @@
+#ifndef LIBJSONLD_CPP_RDFDESERIALIZATIONPROCESSOR_H
+#define LIBJSONLD_CPP_RDFDESERIALIZATIONPROCESSOR_H
+
+#include "jsonld-cpp/jsoninc.h"
+
+
+class JsonLdOptions;
+
+namespace RDF {
+    class RDFDataset;
+}
+
+struct RDFDeserializationProcessor {
+
+    /**
+     * Serialize RDF as JSON-LD Algorithm
+     *
+     * This algorithm serializes an RDF dataset consisting of a default graph and zero or
+     * more named graphs into a JSON-LD document, in expanded form. Well-formed RDF lists
+     * are converted to list objects.
+     *
+     * The triples of each graph are read once. Nodes are indexed by identifier, and each
+     * use of a blank node or of rdf:nil as an object is recorded by position, so detecting
+     * lists takes time linear in the size of the dataset.
+     *
+     * The useNativeTypes, useRdfType, rdfDirection and processingMode options are used. If
+     * the ordered option is set, nodes are output in order of their identifiers, otherwise
+     * in the order they are first seen in dataset.
+     *
+     * https://www.w3.org/TR/json-ld11-api/#serialize-rdf-as-json-ld-algorithm
+     */
+    static nlohmann::ordered_json fromRDF(const RDF::RDFDataset & dataset, const JsonLdOptions & options);
+
+};
+
+
+#endif //LIBJSONLD_CPP_RDFDESERIALIZATIONPROCESSOR_H
@@ -3,17 +3,23 @@
 #include <vector>
 #include <cmath>
 #include <iostream>
-#include <sstream>
 #include <memory>
 #include <algorithm>
+#include <atomic>
+#include <exception>
+#include <thread>
 
 #include "jsonld-cpp/JsonLdOptions.h"
+#include "jsonld-cpp/ProcessingStats.h"
 #include "jsonld-cpp/RDFDataset.h"
+#include "jsonld-cpp/RDFQuad.h"
+#include "jsonld-cpp/QuadSink.h"
 #include "jsonld-cpp/BlankNodeNames.h"
 #include "jsonld-cpp/detail/JsonLdUtils.h"
 #include "jsonld-cpp/JsonLdError.h"
 #include "jsonld-cpp/detail/DoubleFormatter.h"
 #include "jsonld-cpp/detail/WellFormed.h"
+#include "jsonld-cpp/detail/NodeMap.h"
 
 using json = nlohmann::ordered_json;
 
@@ -22,325 +28,225 @@ namespace {
     using namespace RDF;
     using RDF::BlankNode;
 
-    void generateNodeMap(json & element, nlohmann::json &nodeMap, BlankNodeNames &blankNodeNames,
-                         std::string *activeGraph, json *activeSubject,
-                         std::string *activeProperty, json *list)
-    {
-        // Comments in this function are labeled with numbers that correspond to sections
-        // from the description of the node map generation algorithm.
-        // See: https://www.w3.org/TR/json-ld11-api/#node-map-generation
+    const std::size_t NOT_GENERATED = static_cast<std::size_t>(-1);
+
+    /**
+     * An RDF term as generated by the Object to RDF and List to RDF conversion algorithms.
+     * Terms are only turned into RDF::Node objects when they are collected into an RDFDataset.
+     *
+     * The blank nodes generated for lists and compound literals are identified by their
+     * number from BlankNodeNames, and have an empty value: their label is only built when
+     * the term is turned into a Node or a QuadTerm.
+     */
+    struct Term {
+        QuadTerm::Kind kind;
+        std::string value;
+        std::string datatype;
+        std::string language;
+        std::size_t blankNode = NOT_GENERATED;
+
+        std::string label(const BlankNodeNames & blankNodeNames) const {
+            return blankNode == NOT_GENERATED ? value : blankNodeNames.getName(blankNode);
+        }
 
-        // Also including some of the clarifications provided in the more recently published
-        // https://w3c.github.io/json-ld-api/#node-map-generation
+        QuadTerm view() const {
+            assert(blankNode == NOT_GENERATED);
+            return {kind, value, datatype, language};
+        }
 
-        // 1)
-        // If element is an array, process each item in element as follows and then return:
-        if (element.is_array()) {
-            // 1.1)
-            // Run this algorithm recursively by passing item for element, node map, active
-            // graph, active subject, active property, and list.
-            for (auto item : element) {
-                generateNodeMap(item, nodeMap, blankNodeNames, activeGraph, activeSubject, activeProperty, list);
-            }
-            return;
+        QuadTerm view(const BlankNodeNames & blankNodeNames, std::string & labelBuffer) const {
+            if (blankNode == NOT_GENERATED)
+                return view();
+            labelBuffer = blankNodeNames.getName(blankNode);
+            return {kind, labelBuffer, datatype, language};
         }
+    };
 
-        // 2)
-        // Otherwise element is a map. Reference the map which is the value of the active graph
-        // entry of node map using the variable graph. If the active subject is null or a
-        // map, set subject node to null otherwise reference the active subject entry of graph
-        // using the variable subject node.
-        if (!nodeMap.contains(*activeGraph)) {
-            nodeMap[*activeGraph] = json::object();
+    Term makeIRI(const std::string & value) {
+        return {QuadTerm::Kind::IRI, value, "", ""};
+    }
+
+    Term makeBlankNode(const std::string & value) {
+        return {QuadTerm::Kind::BLANK_NODE, value, "", ""};
+    }
+
+    Term makeBlankNode(std::size_t number) {
+        return {QuadTerm::Kind::BLANK_NODE, "", "", "", number};
+    }
+
+    Term makeLiteral(const std::string & value, const std::string & datatype, const std::string & language = "") {
+        return {QuadTerm::Kind::LITERAL, value, datatype, language};
+    }
+
+    Term makeIRIOrBlankNode(const std::string & value) {
+        if (BlankNodeNames::hasFormOfBlankNodeName(value))
+            return makeBlankNode(value);
+        else
+            return makeIRI(value);
+    }
+
+    std::shared_ptr<Node> toNode(QuadTerm::Kind kind, const std::string & value, std::string datatype, std::string language) {
+        switch (kind) {
+            case QuadTerm::Kind::IRI:
+                return std::make_shared<IRI>(value);
+            case QuadTerm::Kind::BLANK_NODE:
+                return std::make_shared<BlankNode>(value);
+            case QuadTerm::Kind::LITERAL:
+            default:
+                return std::make_shared<Literal>(value, &datatype, &language);
         }
-        nlohmann::json & graph = nodeMap[*activeGraph];
+    }
+
+    std::shared_ptr<Node> toNode(const Term & term, const BlankNodeNames & blankNodeNames) {
+        return toNode(term.kind, term.label(blankNodeNames), term.datatype, term.language);
+    }
+
+    std::shared_ptr<Node> toNode(const QuadTerm & term) {
+        return toNode(term.getKind(), term.getValue(), term.getDatatype(), term.getLanguage());
+    }
 
-        nlohmann::json *subjectNode = nullptr;
-        if(activeSubject == nullptr || activeSubject->is_object()) {
-            subjectNode = nullptr;
+    struct TermTriple {
+        Term subject;
+        Term predicate;
+        Term object;
+    };
+
+    /**
+     * Receives the triples generated by graphToRDF(), one graph at a time. The labels of
+     * generated blank nodes are built using the BlankNodeNames set by toRDF(), and the
+     * emitted triples are counted in the ProcessingStats it sets, if any.
+     */
+    class TripleEmitter {
+    protected:
+        const BlankNodeNames * blankNodeNames = nullptr;
+        ProcessingStats * stats = nullptr;
+
+    public:
+        virtual ~TripleEmitter() = default;
+        void setBlankNodeNames(const BlankNodeNames & names) {
+            blankNodeNames = &names;
         }
-        else if (activeSubject->is_string() &&
-                graph.contains(activeSubject->get<std::string>())) {
-            subjectNode = &graph[activeSubject->get<std::string>()];
+        void setStats(ProcessingStats * processingStats) {
+            stats = processingStats;
         }
-
-        // 3)
-        // For each item in the @type entry of element, if any, or for the value of
-        // @type, if the value of @type exists and is not an array:
-        if (element.contains(JsonLdConsts::TYPE)) {
-            // 3.1)
-            // If item is a blank node identifier, replace it with a newly generated blank
-            // node identifier passing item for identifier.
-            json oldTypes;
-            json newTypes;
-            oldTypes = element[JsonLdConsts::TYPE];
-            for (const auto& item : oldTypes) {
-                std::string s = item.get<std::string>();
-                if (BlankNodeNames::hasFormOfBlankNodeName(s)) {
-                    newTypes.push_back(blankNodeNames.get(s));
-                } else {
-                    newTypes.push_back(item);
-                }
-            }
-            if(!newTypes.empty()) {
-                if (element[JsonLdConsts::TYPE].is_array())
-                    element[JsonLdConsts::TYPE] = newTypes;
-                else
-                    element[JsonLdConsts::TYPE] = newTypes.front();
-            }
+        virtual void startGraph(const std::string & graphName) = 0;
+        virtual void emit(const Term & subject, const Term & predicate, const Term & object) = 0;
+        virtual void endGraph() = 0;
+    };
+
+    /**
+     * Collects emitted triples into the graphs of an RDFDataset. Without stats, each
+     * triple is added to its graph as it is emitted. With stats, the triples of a graph
+     * are held until the end of the graph and then added to it all at once, so that
+     * dataset insertion is timed once per graph rather than once per triple.
+     */
+    class DatasetEmitter : public TripleEmitter {
+    private:
+        RDF::RDFDataset & dataset;
+        RDFGraph * triples = nullptr;
+        std::vector<RDFTriple> pending;
+
+    public:
+        explicit DatasetEmitter(RDF::RDFDataset & dataset)
+                : dataset(dataset) {
         }
 
-        // 4)
-        // If element has an @value entry, perform the following steps:
-        if (element.contains(JsonLdConsts::VALUE)) {
-            // 4.1)
-            // If list is null:
-            if (list == nullptr) {
-                // 4.1.1)
-                // If subject node (which must necessarily be a map) does not have an active
-                // property entry, create one and initialize its value to an array containing element.
-                // 4.1.2)
-                // Otherwise, compare element against every item in the array associated with
-                // the active property entry of subject node. If there is no item equivalent
-                // to element, append element to the array. Two maps are considered equal if
-                // they have equivalent map entries.
-                JsonLdUtils::mergeValue(*subjectNode, *activeProperty, element);
-            }
-            // 4.2)
-            // Otherwise, append element to the @list entry of list.
-            else {
-                list->at(JsonLdConsts::LIST).push_back(element);
-            }
+        void startGraph(const std::string & name) override {
+            // triples are added directly to the graph stored in the dataset
+            triples = &dataset.getOrCreateGraph(name);
         }
 
-        // 5)
-        // Otherwise, if element has an @list entry, perform the following steps:
-        else if (element.contains(JsonLdConsts::LIST)) {
-            // 5.1)
-            // Initialize a new map result consisting of a single entry @list whose value
-            // is initialized to an empty array.
-            json result = { { JsonLdConsts::LIST, json::array() } };
-            // 5.2)
-            // Recursively call this algorithm passing the value of element's @list entry for
-            // element, node map, active graph, active subject, active property, and result for list.
-            generateNodeMap(element[JsonLdConsts::LIST], nodeMap, blankNodeNames, activeGraph, activeSubject,
-                            activeProperty, &result);
-            // 5.3)
-            // If list is null, append result to the value of the active property entry of subject
-            // node (which must necessarily be a map).
-            if (list == nullptr) {
-                JsonLdUtils::mergeValue(*subjectNode, *activeProperty, result);
-            }
-            // 5.4)
-            // Otherwise, append result to the @list entry of list.
-            else {
-                list->at(JsonLdConsts::LIST).push_back(result);
-            }
+        void emit(const Term & subject, const Term & predicate, const Term & object) override {
+            RDFTriple triple(toNode(subject, *blankNodeNames), toNode(predicate, *blankNodeNames),
+                             toNode(object, *blankNodeNames));
+            if (stats == nullptr)
+                triples->add(std::move(triple));
+            else
+                pending.push_back(std::move(triple));
         }
 
-        // 6)
-        // Otherwise element is a node object, perform the following steps:
-        else {
-            // 6.1)
-            // If element has an @id entry, set id to its value and remove the entry from
-            // element. If id is a blank node identifier, replace it with a newly generated
-            // blank node identifier passing id for identifier.
-            std::string id;
-            if(element.contains(JsonLdConsts::ID)) {
-                if(element[JsonLdConsts::ID].is_null()) // note: this can happen in some cases, see toRDF test e122. Ask on list?
-                    return;
-                id = element[JsonLdConsts::ID].get<std::string>();
-                element.erase(JsonLdConsts::ID);
-                if (BlankNodeNames::hasFormOfBlankNodeName(id)) {
-                    id = blankNodeNames.get(id);
-                }
-            }
-            // 6.2)
-            // Otherwise, set id to the result of the Generate Blank Node Identifier algorithm
-            // passing null for identifier.
-            else {
-                id = blankNodeNames.get();
-            }
-            // 6.3)
-            // If graph does not contain an entry id, create one and initialize its value to
-            // a map consisting of a single entry @id whose value is id.
-            if (!graph.contains(id)) {
-                json tmp = { { JsonLdConsts::ID, id } };
-                graph[id] = tmp;
-            }
-            // 6.4)
-            // Reference the value of the id entry of graph using the variable node.
-            nlohmann::json &node = graph[id];
-
-            // 6.5)
-            // If active subject is a map, a reverse property relationship is being
-            // processed. Perform the following steps:
-            if (activeSubject != nullptr && activeSubject->is_object()) {
-                // 6.5.1)
-                // If node does not have a active property entry, create one and initialize its
-                // value to an array containing active subject.
-                // 6.5.2
-                // Otherwise, compare active subject against every item in the array associated
-                // with the active property entry of node. If there is no item equivalent to
-                // active subject, append active subject to the array. Two maps are considered
-                // equal if they have equivalent map entries.
-                JsonLdUtils::mergeValue(node, *activeProperty, *activeSubject);
-            }
-            // 6.6)
-            // Otherwise, if active property is not null, perform the following steps:
-            else if (activeProperty != nullptr) {
-                // 6.6.1)
-                // Create a new map reference consisting of a single entry @id whose value is id.
-                json reference = { { JsonLdConsts::ID, id } };
-                // 6.6.2)
-                // If list is null:
-                if (list == nullptr) {
-                    // 6.6.2.1)
-                    // If subject node does not have an active property entry, create one and
-                    // initialize its value to an array containing reference.
-                    // 6.6.2.2)
-                    // Otherwise, compare reference against every item in the array associated
-                    // with the active property entry of subject node. If there is no item
-                    // equivalent to reference, append reference to the array. Two maps are
-                    // considered equal if they have equivalent map entries.
-                    if(activeSubject == nullptr || activeSubject->is_object()) {
-                        subjectNode = nullptr;
-                    }
-                    else if (activeSubject->is_string() &&
-                            graph.contains(activeSubject->get<std::string>())) {
-                        subjectNode = &graph[activeSubject->get<std::string>()];
+        void endGraph() override {
+            if (stats != nullptr) {
+                std::size_t dropped = 0;
+                {
+                    ProcessingStats::PhaseTimer timer(stats, ProcessingStats::Phase::DatasetInsertion);
+                    for (auto & triple : pending) {
+                        if (!triples->add(std::move(triple)))
+                            dropped++;
                     }
-
-                    JsonLdUtils::mergeValue(*subjectNode, *activeProperty, reference);
-                }
-                // 6.6.3)
-                // Otherwise, append reference to the @list entry of list.
-                else {
-                    list->at(JsonLdConsts::LIST).push_back(reference);
                 }
+                stats->add(ProcessingStats::Counter::TriplesEmitted, pending.size());
+                stats->add(ProcessingStats::Counter::DuplicateTriplesDropped, dropped);
+                pending.clear();
             }
-            // 6.7)
-            // If element has an @type entry, append each item of its associated array to the array
-            // associated with the @type entry of node unless it is already in that array. Finally
-            // remove the @type entry from element.
-            if (element.contains(JsonLdConsts::TYPE)) {
-                for (const auto& type : element[JsonLdConsts::TYPE]) {
-                    JsonLdUtils::mergeValue(node, JsonLdConsts::TYPE, type);
-                }
-                element.erase(JsonLdConsts::TYPE);
-            }
-            // 6.8)
-            // If element has an @index entry, set the @index entry of node to its value. If node
-            // already has an @index entry with a different value, a conflicting indexes error has
-            // been detected and processing is aborted. Otherwise, continue by removing the @index
-            // entry from element.
-            if (element.contains(JsonLdConsts::INDEX)) {
-                nlohmann::json elemIndex = element[JsonLdConsts::INDEX];
-                if (node.contains(JsonLdConsts::INDEX)) {
-                    if (node.at(JsonLdConsts::INDEX) != elemIndex) {
-                        throw JsonLdError(JsonLdError::ConflictingIndexes);
-                    }
-                }
-                node[JsonLdConsts::INDEX] = elemIndex;
-                element.erase(JsonLdConsts::INDEX);
-            }
-            // 6.9)
-            // If element has an @reverse entry:
-            if (element.contains(JsonLdConsts::REVERSE)) {
-                // 6.9.1)
-                // Create a map referenced node with a single entry @id whose value is id.
-                json referencedNode = { { JsonLdConsts::ID, id } };
-                // 6.9.2)
-                // Initialize reverse map to the value of the @reverse entry of element.
-                json reverseMap = element[JsonLdConsts::REVERSE];
-                // 6.9.3)
-                // For each key-value pair property-values in reverse map:
-                std::vector<std::string> reverseMap_keys;
-                for (json::iterator it = reverseMap.begin(); it != reverseMap.end(); ++it) {
-                    reverseMap_keys.push_back(it.key());
-                }
-                for (auto property : reverseMap_keys) {
-                    json values = reverseMap[property];
-                    // 6.9.3.1)
-                    // For each value of values:
-                    for (auto reverseMap_value : values) {
-                        // 6.9.3.1.1)
-                        // Recursively invoke this algorithm passing value for element, node
-                        // map, active graph, referenced node for active subject, and property
-                        // for active property. Passing a map for active subject indicates to
-                        // the algorithm that a reverse property relationship is being processed.
-                        generateNodeMap(reverseMap_value, nodeMap, blankNodeNames, activeGraph,
-                                        &referencedNode, &property, nullptr);
-                    }
-                }
-                // 6.9.4)
-                // Remove the @reverse entry from element.
-                element.erase(JsonLdConsts::REVERSE);
-            }
-            // 6.10)
-            // If element has an @graph entry, recursively invoke this algorithm passing the value
-            // of the @graph entry for element, node map, and id for active graph before removing
-            // the @graph entry from element.
-            if (element.contains(JsonLdConsts::GRAPH)) {
-                json elemGraph = element[JsonLdConsts::GRAPH];
-                generateNodeMap(elemGraph, nodeMap, blankNodeNames, &id, nullptr, nullptr, nullptr);
-                element.erase(JsonLdConsts::GRAPH);
-            }
-            // 6.11)
-            // If element has an @included entry, recursively invoke this algorithm passing
-            // the value of the @included entry for element, node map, and active graph before
-            // removing the @included entry from element.
-            if (element.contains(JsonLdConsts::INCLUDED)) {
-                json elemIncluded = element[JsonLdConsts::INCLUDED];
-                generateNodeMap(elemIncluded, nodeMap, blankNodeNames, activeGraph, nullptr, nullptr, nullptr);
-                element.erase(JsonLdConsts::INCLUDED);
-            }
-            // 6.12)
-            // Finally, for each key-value pair property-value in element ordered by property
-            // perform the following steps:
-            std::vector<std::string> keys;
-            for (json::iterator it = element.begin(); it != element.end(); ++it) {
-                keys.push_back(it.key());
-            }
+            triples = nullptr;
+        }
+    };
+
+    /**
+     * Passes emitted triples, along with the current graph name, to a QuadSink
+     */
+    class SinkEmitter : public TripleEmitter {
+    private:
+        QuadSink & sink;
+        Term graphName;
+        bool isDefaultGraph = true;
+        std::string subjectLabel;
+        std::string objectLabel;
+
+    public:
+        explicit SinkEmitter(QuadSink & sink)
+                : sink(sink) {
+        }
 
-            // Note: The above statement for step 6.12 states "...ordered by property..."
-            // but if we run this sort here, then toRDF test c019 will fail.
-            // See https://github.com/w3c/json-ld-api/issues/586
+        void startGraph(const std::string & name) override {
+            isDefaultGraph = (name == JsonLdConsts::DEFAULT);
+            if (!isDefaultGraph)
+                graphName = makeIRIOrBlankNode(name);
+        }
 
-            // std::sort(keys.begin(), keys.end());
+        void emit(const Term & subject, const Term & predicate, const Term & object) override {
+            if (stats != nullptr)
+                stats->add(ProcessingStats::Counter::TriplesEmitted);
 
-            for (auto property : keys) {
-                json & propertyValue = element[property];
-                // 6.12.1)
-                // If property is a blank node identifier, replace it with a newly generated
-                // blank node identifier passing property for identifier.
-                if (BlankNodeNames::hasFormOfBlankNodeName(property)) {
-                    property = blankNodeNames.get(property);
-                }
-                // 6.12.2)
-                // If node does not have a property entry, create one and initialize its value
-                // to an empty array.
-                if (!node.contains(property)) {
-                    node[property] = json::array();
-                }
-                // 6.12.3)
-                // Recursively invoke this algorithm passing value for element, node map, active
-                // graph, id for active subject, and property for active property.
-                json jid = id;
-                generateNodeMap(propertyValue, nodeMap, blankNodeNames, activeGraph, &jid, &property, nullptr);
+            // predicates and graph names are never generated blank nodes
+            QuadTerm subjectView = subject.view(*blankNodeNames, subjectLabel);
+            QuadTerm objectView = object.view(*blankNodeNames, objectLabel);
+            if (isDefaultGraph) {
+                sink.onQuad(subjectView, predicate.view(), objectView, nullptr);
+            }
+            else {
+                QuadTerm graph = graphName.view();
+                sink.onQuad(subjectView, predicate.view(), objectView, &graph);
             }
         }
-    }
 
-    void generateNodeMap(json & element, nlohmann::json & nodeMap, BlankNodeNames &blankNodeNames)
-    {
-        std::string defaultGraph(JsonLdConsts::DEFAULT);
-        generateNodeMap(element, nodeMap, blankNodeNames, &defaultGraph, nullptr, nullptr, nullptr);
-    }
+        void endGraph() override {
+        }
+    };
+
+    /**
+     * Adapts a QuadCallback to the QuadSink interface by building an RDFQuad for each quad
+     */
+    class QuadCallbackSink : public QuadSink {
+    private:
+        const RDFSerializationProcessor::QuadCallback & quadCallback;
+
+    public:
+        explicit QuadCallbackSink(const RDFSerializationProcessor::QuadCallback & quadCallback)
+                : quadCallback(quadCallback) {
+        }
+
+        void onQuad(const QuadTerm & subject, const QuadTerm & predicate,
+                    const QuadTerm & object, const QuadTerm * graph) override {
+            std::string graphName = graph ? graph->getValue() : JsonLdConsts::DEFAULT;
+            quadCallback(RDFQuad(toNode(subject), toNode(predicate), toNode(object), &graphName));
+        }
+    };
 
-    std::shared_ptr<RDF::Node> objectToRDF(const nlohmann::json & item, std::vector<RDFTriple> & listTriples, const JsonLdOptions &options, BlankNodeNames &blankNodeNames);
+    bool objectToRDF(const nlohmann::json & item, Term & result, std::vector<TermTriple> & listTriples, const JsonLdOptions &options, BlankNodeNames &blankNodeNames);
 
-    std::shared_ptr<RDF::Node> listToRDF(const nlohmann::json & list, std::vector<RDFTriple> & listTriples, const JsonLdOptions &options, BlankNodeNames &blankNodeNames) {
+    Term listToRDF(const nlohmann::json & list, std::vector<TermTriple> & listTriples, const JsonLdOptions &options, BlankNodeNames &blankNodeNames) {
 
         // Comments in this function are labeled with numbers that correspond to sections
         // from the description of the List to RDF conversion algorithm.
@@ -354,78 +260,68 @@ namespace {
         // 1)
         // If list is empty, return rdf:nil.
         if(list.empty())
-            return std::make_shared<IRI>(JsonLdConsts::RDF_NIL);
+            return makeIRI(JsonLdConsts::RDF_NIL);
 
         // 2)
         // Otherwise, create an array bnodes composed of a newly generated blank node
         // identifier for each entry in list.
-        std::vector<std::string> bnodes;
-        for(size_t i=list.size(); i--;)
-            bnodes.push_back(blankNodeNames.get());
+        // Note: the identifiers are consecutive, so only the first one is kept.
+        std::size_t bnodes = blankNodeNames.reserveBlock(list.size());
 
         // 3)
         // For each pair of subject from bnodes and item from list:
         for (json::size_type index=0; index < list.size(); index++) {
-            std::string subject = bnodes[index];
-            json item = list[index];
+            Term subject = makeBlankNode(bnodes + index);
+            const nlohmann::json & item = list[index];
 
             // 3.1)
             // Initialize embedded triples to a new empty array.
-            std::vector<RDFTriple> embeddedTriples;
+            std::vector<TermTriple> embeddedTriples;
 
             // 3.2)
             // Initialize object to the result of using the Object to RDF Conversion
             // algorithm passing item and embedded triples for list triples.
-            std::shared_ptr<RDF::Node> object = objectToRDF(item, embeddedTriples, options, blankNodeNames);
+            Term object;
+            bool hasObject = objectToRDF(item, object, embeddedTriples, options, blankNodeNames);
 
             // 3.3)
             // Unless object is null, append a triple composed of subject, rdf:first, and object
             // to list triples.
-            if(object) {
-                std::shared_ptr<Node> s = std::make_shared<BlankNode>(subject);
-                std::shared_ptr<Node> p = std::make_shared<IRI>(JsonLdConsts::RDF_FIRST);
-                listTriples.emplace_back(s, p, object);
+            if(hasObject) {
+                listTriples.push_back({subject, makeIRI(JsonLdConsts::RDF_FIRST), std::move(object)});
             }
 
             // 3.4)
             // Initialize rest as the next entry in bnodes, or if that does not
             // exist, rdf:nil. Append a triple composed of subject, rdf:rest, and rest
             // to list triples.
-            std::string rest;
             if(index+1 < list.size()) {
-                std::shared_ptr<Node> s = std::make_shared<BlankNode>(subject);
-                std::shared_ptr<Node> p = std::make_shared<IRI>(JsonLdConsts::RDF_REST);
-                std::shared_ptr<Node> o = std::make_shared<BlankNode>(bnodes[index+1]);
-                listTriples.emplace_back(s, p, o);
+                listTriples.push_back({subject, makeIRI(JsonLdConsts::RDF_REST), makeBlankNode(bnodes + index + 1)});
             }
             else {
-                std::shared_ptr<Node> s = std::make_shared<BlankNode>(subject);
-                std::shared_ptr<Node> p = std::make_shared<IRI>(JsonLdConsts::RDF_REST);
-                std::shared_ptr<Node> o = std::make_shared<IRI>(JsonLdConsts::RDF_NIL);
-                listTriples.emplace_back(s, p, o);
+                listTriples.push_back({subject, makeIRI(JsonLdConsts::RDF_REST), makeIRI(JsonLdConsts::RDF_NIL)});
             }
 
             // 3.5)
             // Append all values from embedded triples to list triples
-            for(const auto& t : embeddedTriples)
-                listTriples.push_back(t);
+            for(auto& t : embeddedTriples)
+                listTriples.push_back(std::move(t));
         }
 
         // 4)
         // Return the first blank node from bnodes or rdf:nil if bnodes is empty.
-        if(!bnodes.empty())
-            return std::make_shared<BlankNode>(bnodes.front());
-        else
-            return std::make_shared<IRI>(JsonLdConsts::RDF_NIL);
+        // Note: bnodes is not empty, list being empty was handled in step 1.
+        return makeBlankNode(bnodes);
     }
 
-    std::shared_ptr<RDF::Node> objectToRDF(const nlohmann::json & item, std::vector<RDFTriple> & listTriples, const JsonLdOptions &options, BlankNodeNames &blankNodeNames) {
+    bool objectToRDF(const nlohmann::json & item, Term & result, std::vector<TermTriple> & listTriples, const JsonLdOptions &options, BlankNodeNames &blankNodeNames) {
 
         // Comments in this function are labeled with numbers that correspond to sections
         // from the description of the Object to RDF conversion algorithm.
         // See: https://www.w3.org/TR/json-ld11-api/#object-to-rdf-conversion
 
-        json result;
+        // Note: where the algorithm returns null, this function returns false. Otherwise
+        // result is set to the converted term and true is returned.
 
         // pre) The algorithm takes as two arguments item which MUST be either a value
         // object, list object, or node object and list triples, which is an empty array.
@@ -441,22 +337,20 @@ namespace {
         if (JsonLdUtils::isObject(item) && !JsonLdUtils::isListObject(item) && !JsonLdUtils::isValueObject(item)) {
             std::string id = item[JsonLdConsts::ID].get<std::string>();
             if (!WellFormed::blankNodeIdentifier(id) && !WellFormed::iri(id)) {
-                return nullptr;
+                return false;
             }
             // 2)
             // If item is a node object, return the IRI or blank node identifier associated with its @id entry.
-            if (BlankNodeNames::hasFormOfBlankNodeName(id)) {
-                return std::make_shared<BlankNode>(id);
-            } else {
-                return std::make_shared<IRI>(id);
-            }
+            result = makeIRIOrBlankNode(id);
+            return true;
         }
 
         // 3)
         // If item is a list object return the result of the List Conversion algorithm, passing
         // the value associated with the @list entry from item and list triples.
         if (JsonLdUtils::isListObject(item)) {
-            return listToRDF(item[JsonLdConsts::LIST], listTriples, options, blankNodeNames);
+            result = listToRDF(item[JsonLdConsts::LIST], listTriples, options, blankNodeNames);
+            return true;
         }
 
         // 4)
@@ -479,13 +373,13 @@ namespace {
         // 6)
         // If datatype is not null and neither a well-formed IRI nor @json, return null.
         if(!datatype.is_null() && datatypeStr != JsonLdConsts::JSON && !WellFormed::iri(datatypeStr))
-            return nullptr;
+            return false;
 
         // 7)
         // If item has an @language entry which is not well-formed, return null.
         if(item.contains(JsonLdConsts::LANGUAGE) &&
                 (item[JsonLdConsts::LANGUAGE].empty() || !WellFormed::language(item[JsonLdConsts::LANGUAGE].get<std::string>())))
-            return nullptr;
+            return false;
 
         // 8)
         // If datatype is @json, convert value to the canonical lexical form using the result
@@ -504,12 +398,8 @@ namespace {
             if (datatype.is_null())
                 datatypeStr = JsonLdConsts::XSD_BOOLEAN;
             bool b = value.get<bool>();
-            std::stringstream ss;
-            ss << std::boolalpha << b;
-            return std::make_shared<Literal>(
-                    ss.str(),
-                    &datatypeStr,
-                    nullptr);
+            result = makeLiteral(b ? "true" : "false", datatypeStr);
+            return true;
         }
 
         // 10)
@@ -525,10 +415,8 @@ namespace {
                 if (datatype.is_null())
                     datatypeStr = JsonLdConsts::XSD_DOUBLE;
                 double d = value.get<double>();
-                return std::make_shared<Literal>(
-                        DoubleFormatter::format(d),
-                        &datatypeStr,
-                        nullptr);
+                result = makeLiteral(DoubleFormatter::format(d), datatypeStr);
+                return true;
             } else {
                 // 11)
                 // Otherwise, if value is a number, convert it to a string in canonical lexical form of
@@ -537,10 +425,8 @@ namespace {
                 if (datatype.is_null())
                     datatypeStr = JsonLdConsts::XSD_INTEGER;
                 int i = value.get<int>();
-                return std::make_shared<Literal>(
-                        std::to_string(i),
-                        &datatypeStr,
-                        nullptr);
+                result = makeLiteral(std::to_string(i), datatypeStr);
+                return true;
             }
         }
 
@@ -574,9 +460,8 @@ namespace {
             // and datatype.
             if(options.getRdfDirection() == "i18n-datatype") {
                 datatypeStr = "https://www.w3.org/ns/i18n#" + language + "_" + item[JsonLdConsts::DIRECTION].get<std::string>();
-                return std::make_shared<Literal>(
-                        value.get<std::string>(),
-                        &datatypeStr);
+                result = makeLiteral(value.get<std::string>(), datatypeStr);
+                return true;
             }
 
             // 13.3)
@@ -585,36 +470,33 @@ namespace {
 
                 // 13.3.1)
                 // Initialize literal as a new blank node.
-                std::string subject = blankNodeNames.get();
-                std::shared_ptr<Node> literal = std::make_shared<BlankNode>(subject);
+                Term literal = makeBlankNode(blankNodeNames.reserveBlock(1));
 
                 // 13.3.2)
                 // Create a new triple using literal as the subject, rdf:value as the
                 // predicate, and the value of @value in item as the object, and add it
                 // to list triples.
-                std::shared_ptr<Node> p = std::make_shared<IRI>(JsonLdConsts::RDF_VALUE);
-                std::shared_ptr<Node> o = std::make_shared<Literal>(value.get<std::string>());
-                listTriples.emplace_back(literal, p, o);
+                listTriples.push_back({literal, makeIRI(JsonLdConsts::RDF_VALUE),
+                                       makeLiteral(value.get<std::string>(), JsonLdConsts::XSD_STRING)});
 
                 // 13.3.3)
                 // If the item has an entry for @language, create a new triple using literal
                 // as the subject, rdf:language as the predicate, and language as the object,
                 // and add it to list triples.
                 if(item.contains(JsonLdConsts::LANGUAGE) && !item[JsonLdConsts::LANGUAGE].empty()) {
-                    p = std::make_shared<IRI>(JsonLdConsts::RDF_LANGUAGE);
-                    o = std::make_shared<Literal>(language);
-                    listTriples.emplace_back(literal, p, o);
+                    listTriples.push_back({literal, makeIRI(JsonLdConsts::RDF_LANGUAGE),
+                                           makeLiteral(language, JsonLdConsts::XSD_STRING)});
                 }
 
                 // 13.3.4)
                 // Create a new triple using literal as the subject, rdf:direction as the
                 // predicate, and the value of @direction in item as the object, and add
                 // it to list triples.
-                p = std::make_shared<IRI>(JsonLdConsts::RDF_DIRECTION);
-                o = std::make_shared<Literal>(item[JsonLdConsts::DIRECTION].get<std::string>());
-                listTriples.emplace_back(literal, p, o);
+                listTriples.push_back({literal, makeIRI(JsonLdConsts::RDF_DIRECTION),
+                                       makeLiteral(item[JsonLdConsts::DIRECTION].get<std::string>(), JsonLdConsts::XSD_STRING)});
 
-                return literal;
+                result = std::move(literal);
+                return true;
             }
         }
 
@@ -625,22 +507,111 @@ namespace {
         // 15)
         // Return literal.
         if(item.contains(JsonLdConsts::LANGUAGE)) {
-            std::string languageStr = item[JsonLdConsts::LANGUAGE].get<std::string>();
-            return std::make_shared<Literal>(
-                    value.get<std::string>(),
-                    &datatypeStr,
-                    &languageStr);
+            result = makeLiteral(value.get<std::string>(), datatypeStr, item[JsonLdConsts::LANGUAGE].get<std::string>());
         }
         else {
-            return std::make_shared<Literal>(
-                    value.get<std::string>(),
-                    &datatypeStr,
-                    nullptr);
+            result = makeLiteral(value.get<std::string>(), datatypeStr);
+        }
+        return true;
+
+    }
+
+    void subjectToRDF(const std::string &subject, const nlohmann::json & node, TripleEmitter &emitter, BlankNodeNames & blankNodeNames, const JsonLdOptions &options) {
+
+        // Comments in this function are labeled with numbers that correspond to sections
+        // from the description of the Deserialize JSON-LD to RDF algorithm.
+        // See: https://www.w3.org/TR/json-ld11-api/#deserialize-json-ld-to-rdf-algorithm
+
+        // 1.3.1)
+        // If subject is not well-formed, continue with the next subject-node pair.
+        if (!WellFormed::rdf_subject(subject)) {
+            return;
         }
 
+        // 1.3.2)
+        // For each property and values in node ordered by property:
+        for (auto propertyIt = node.begin(); propertyIt != node.end(); ++propertyIt) {
+            const std::string &property = propertyIt.key();
+
+            const nlohmann::json * values;
+
+            // 1.3.2.1)
+            // If property is @type, then for each type in values, create a new RdfTriple
+            // composed of subject, rdf:type for predicate, and type for object and add to
+            // triples using its add method, unless type is not well-formed.
+            if (property == JsonLdConsts::TYPE) {
+                values = &propertyIt.value();
+
+                for(const auto& type : *values) {
+                    if(!type.is_string() ||
+                       (!WellFormed::blankNodeIdentifier(type.get<std::string>()) &&
+                        !WellFormed::iri(type.get<std::string>())))
+                        continue;
+
+                    if (!::BlankNodeNames::hasFormOfBlankNodeName(subject) &&
+                        !JsonLdUtils::isAbsoluteIri(subject))
+                        continue;
+
+                    const auto & typeStr = type.get_ref<const std::string &>();
+                    if (!::BlankNodeNames::hasFormOfBlankNodeName(typeStr) &&
+                        !JsonLdUtils::isAbsoluteIri(typeStr))
+                        continue;
+
+                    emitter.emit(makeIRIOrBlankNode(subject),
+                                 makeIRI(JsonLdConsts::RDF_TYPE),
+                                 makeIRIOrBlankNode(typeStr));
+                }
+            }
+
+            // 1.3.2.2)
+            // Otherwise, if property is a keyword continue with the next property-values pair.
+            else if (JsonLdUtils::isKeyword(property)) {
+                continue;
+            }
+
+            // 1.3.2.3)
+            // Otherwise, if property is a blank node identifier and the produceGeneralizedRdf
+            // option is not true, continue with the next property-values pair.
+            else if (::BlankNodeNames::hasFormOfBlankNodeName(property) && !options.getProduceGeneralizedRdf()) {
+                continue;
+            }
+
+            // 1.3.2.4)
+            // Otherwise, if property is not well-formed, continue with the next property-values pair.
+            else if (!WellFormed::iri(property)) {
+                continue;
+            }
+
+            // 1.3.2.5)
+            // Otherwise, property is an IRI or blank node identifier. For each item in values:
+            else {
+                values = &propertyIt.value();
+                for (const auto& item : *values) {
+
+                    // 1.3.2.5.1)
+                    // Initialize list triples as an empty array.
+                    std::vector<TermTriple> listTriples;
+
+                    // 1.3.2.5.2)
+                    // Add a triple composed of subject, property, and the result of using the
+                    // Object to RDF Conversion algorithm passing item and list triples to triples
+                    // using its add method, unless the result is null, indicating a non-well-formed
+                    // resource that has to be ignored.
+                    Term result;
+                    if (objectToRDF(item, result, listTriples, options, blankNodeNames)) {
+                        emitter.emit(makeIRIOrBlankNode(subject), makeIRIOrBlankNode(property), result);
+                    }
+
+                    // 1.3.2.5.3)
+                    // Add all RdfTriple instances from list triples to triples using its add method.
+                    for (const auto &t : listTriples)
+                        emitter.emit(t.subject, t.predicate, t.object);
+                }
+            }
+        }
     }
 
-    void graphToRDF(const std::string &graphName, const json & graph, RDF::RDFDataset &dataset, BlankNodeNames & blankNodeNames, const JsonLdOptions &options) {
+    void graphToRDF(const std::string &graphName, const nlohmann::json & graph, TripleEmitter &emitter, BlankNodeNames & blankNodeNames, const JsonLdOptions &options) {
 
         // Comments in this function are labeled with numbers that correspond to sections
         // from the description of the Deserialize JSON-LD to RDF algorithm.
@@ -655,163 +626,171 @@ namespace {
         // If graph name is @default, initialize triples to the value of the defaultGraph
         // attribute of dataset. Otherwise, initialize triples as an empty RdfGraph and add
         // to dataset using its add method along with graph name for graphName.
-        RDFGraph triples = dataset.getGraph(graphName); // will add to dataset using setGraph() at end of function
+        // Note: the emitter takes care of collecting the triples into the right graph.
+        emitter.startGraph(graphName);
 
         // 1.3)
         // For each subject and node in graph ordered by subject:
-        std::vector<std::string> subjects;
-        for (auto& el : graph.items()) {
-            subjects.push_back(el.key());
+        // Note: graph is a nlohmann::json, which keeps its entries ordered by key, so the
+        // subjects, and the properties of each node below, are iterated in order without
+        // being copied and sorted.
+        for (auto it = graph.begin(); it != graph.end(); ++it) {
+            subjectToRDF(it.key(), it.value(), emitter, blankNodeNames, options);
         }
-        std::sort(subjects.begin(), subjects.end());
 
-        for (const auto& subject : subjects) {
-            const json &node = graph[subject];
+        emitter.endGraph();
 
-            // 1.3.1)
-            // If subject is not well-formed, continue with the next subject-node pair.
-            if (!WellFormed::rdf_subject(subject)) {
-                continue;
-            }
+    }
 
-            // 1.3.2)
-            // For each property and values in node ordered by property:
-            std::vector<std::string> properties;
-            for (json::const_iterator it = node.begin(); it != node.end(); ++it) {
-                properties.push_back(it.key());
-            }
-            std::sort(properties.begin(), properties.end());
-
-            for (const auto& property : properties) {
-
-                const json * values;
-
-                // 1.3.2.1)
-                // If property is @type, then for each type in values, create a new RdfTriple
-                // composed of subject, rdf:type for predicate, and type for object and add to
-                // triples using its add method, unless type is not well-formed.
-                if (property == JsonLdConsts::TYPE) {
-                    values = &node[JsonLdConsts::TYPE];
-
-                    for(const auto& type : *values) {
-                        if(!type.is_string() ||
-                           (!WellFormed::blankNodeIdentifier(type.get<std::string>()) &&
-                            !WellFormed::iri(type.get<std::string>())))
-                            continue;
-
-                        std::shared_ptr<Node> s;
-                        if (::BlankNodeNames::hasFormOfBlankNodeName(subject))
-                            s = std::make_shared<BlankNode>(subject);
-                        else if(JsonLdUtils::isAbsoluteIri(subject))
-                            s = std::make_shared<IRI>(subject);
-                        else
-                            continue;
-
-                        std::shared_ptr<Node> p;
-                        p = std::make_shared<IRI>(JsonLdConsts::RDF_TYPE);
-
-                        std::shared_ptr<Node> o;
-                        std::string typeStr = type.get<std::string>();
-                        if (::BlankNodeNames::hasFormOfBlankNodeName(typeStr))
-                            o = std::make_shared<BlankNode>(typeStr);
-                        else if(JsonLdUtils::isAbsoluteIri(typeStr))
-                            o = std::make_shared<IRI>(typeStr);
-                        else
-                            continue;
-
-                        triples.add(RDFTriple(s, p, o));
-                    }
-                }
 
-                // 1.3.2.2)
-                // Otherwise, if property is a keyword continue with the next property-values pair.
-                else if (JsonLdUtils::isKeyword(property)) {
-                    continue;
-                }
+    /**
+     * Collects emitted triples, so that the triples generated on a worker thread can be
+     * passed on to the real emitter later, in order.
+     */
+    class CollectingEmitter : public TripleEmitter {
+    public:
+        std::vector<TermTriple> triples;
 
-                // 1.3.2.3)
-                // Otherwise, if property is a blank node identifier and the produceGeneralizedRdf
-                // option is not true, continue with the next property-values pair.
-                else if (::BlankNodeNames::hasFormOfBlankNodeName(property) && !options.getProduceGeneralizedRdf()) {
-                    continue;
-                }
-
-                // 1.3.2.4)
-                // Otherwise, if property is not well-formed, continue with the next property-values pair.
-                else if (!WellFormed::iri(property)) {
-                    continue;
-                }
+        void startGraph(const std::string &) override {
+        }
 
-                // 1.3.2.5)
-                // Otherwise, property is an IRI or blank node identifier. For each item in values:
-                else {
-                    values = &node[property];
-                    for (const auto& item : *values) {
-
-                        // 1.3.2.5.1)
-                        // Initialize list triples as an empty array.
-                        std::vector<RDFTriple> listTriples;
-
-                        // 1.3.2.5.2)
-                        // Add a triple composed of subject, property, and the result of using the
-                        // Object to RDF Conversion algorithm passing item and list triples to triples
-                        // using its add method, unless the result is null, indicating a non-well-formed
-                        // resource that has to be ignored.
-                        auto result = objectToRDF(item, listTriples, options, blankNodeNames);
-                        if (result) {
-                            std::shared_ptr<Node> s;
-                            if (::BlankNodeNames::hasFormOfBlankNodeName(subject))
-                                s = std::make_shared<BlankNode>(subject);
-                            else
-                                s = std::make_shared<IRI>(subject);
-
-                            std::shared_ptr<Node> p;
-                            if (::BlankNodeNames::hasFormOfBlankNodeName(property))
-                                p = std::make_shared<BlankNode>(property);
-                            else
-                                p = std::make_shared<IRI>(property);
-
-                            triples.add(RDFTriple(s, p, result));
-                        }
-
-                        // 1.3.2.5.3)
-                        // Add all RdfTriple instances from list triples to triples using its add method.
-                        for (const auto &t : listTriples)
-                            triples.add(t);
-                    }
-                }
-            }
+        void emit(const Term & subject, const Term & predicate, const Term & object) override {
+            triples.push_back({subject, predicate, object});
         }
 
-        // write triples back to the dataset
-        dataset.setGraph(triples, graphName);
+        void endGraph() override {
+        }
+    };
+
+    /**
+     * A range of consecutive subjects of one graph, converted to triples by a single worker
+     * thread. The blank nodes generated for lists and compound literals while converting
+     * the range are numbered from zero by localNames, and are renumbered once all
+     * partitions have been converted.
+     */
+    struct SubjectPartition {
+        const std::string * graphName;
+        nlohmann::json::const_iterator begin;
+        nlohmann::json::const_iterator end;
+        CollectingEmitter emitter;
+        BlankNodeNames localNames;
+        std::exception_ptr error;
+
+        SubjectPartition(const std::string * graphName, nlohmann::json::const_iterator begin, nlohmann::json::const_iterator end)
+                : graphName(graphName), begin(begin), end(end) {
+        }
+    };
 
+    void renumberLocalBlankNode(Term & term, std::size_t first) {
+        if (term.blankNode != NOT_GENERATED)
+            term.blankNode += first;
     }
 
+    void
+    parallelToRDF(const nlohmann::json & nodeMap, TripleEmitter & emitter, BlankNodeNames & blankNodeNames, const JsonLdOptions &options) {
+
+        // Same as toRDF() below, but the subjects of all graphs are split into partitions
+        // that are converted to triples on a pool of threads. The partitions are then merged
+        // in graph name and subject order, and their local blank node numbers are replaced
+        // by ones from blankNodeNames, so the result is exactly what a sequential conversion
+        // generates.
+
+        std::size_t numSubjects = 0;
+        for (auto it = nodeMap.begin(); it != nodeMap.end(); ++it)
+            numSubjects += it.value().size();
 
-    RDF::RDFDataset
-    toRDF(json nodeMap, BlankNodeNames & blankNodeNames, const JsonLdOptions &options) {
+        std::size_t numThreads = options.getRdfThreads();
+        std::size_t partitionSize = std::max<std::size_t>(numSubjects / (numThreads * 4), 1);
+
+        // Every graph with a well-formed name gets at least one, maybe empty, partition so
+        // that the emitter sees the same graphs as in a sequential conversion
+        std::vector<SubjectPartition> partitions;
+        for (auto it = nodeMap.begin(); it != nodeMap.end(); ++it) {
+            const std::string & graphName = it.key();
+            if(graphName != JsonLdConsts::DEFAULT && !WellFormed::rdf_graph_name(graphName))
+                continue;
+
+            const nlohmann::json & graph = it.value();
+            auto begin = graph.begin();
+            do {
+                auto end = begin;
+                for (std::size_t i = 0; i < partitionSize && end != graph.end(); i++)
+                    ++end;
+                partitions.emplace_back(&graphName, begin, end);
+                begin = end;
+            } while (begin != graph.end());
+        }
+
+        std::atomic<std::size_t> nextPartition(0);
+        auto work = [&]() {
+            for (std::size_t i = nextPartition++; i < partitions.size(); i = nextPartition++) {
+                SubjectPartition & partition = partitions[i];
+                try {
+                    for (auto it = partition.begin; it != partition.end; ++it)
+                        subjectToRDF(it.key(), it.value(), partition.emitter, partition.localNames, options);
+                }
+                catch (...) {
+                    partition.error = std::current_exception();
+                }
+            }
+        };
+
+        std::vector<std::thread> workers;
+        for (std::size_t i = 1; i < std::min(numThreads, partitions.size()); i++)
+            workers.emplace_back(work);
+        work();
+        for (auto & worker : workers)
+            worker.join();
+
+        const std::string * currentGraphName = nullptr;
+        for (auto & partition : partitions) {
+            if (partition.error)
+                std::rethrow_exception(partition.error);
+
+            if (partition.graphName != currentGraphName) {
+                if (currentGraphName)
+                    emitter.endGraph();
+                currentGraphName = partition.graphName;
+                emitter.startGraph(*currentGraphName);
+            }
+
+            // Local numbers were generated in the same order as a sequential conversion
+            // would generate them, so offsetting them by the next block of numbers from
+            // blankNodeNames, in partition order, gives the same labels.
+            std::size_t first = blankNodeNames.reserveBlock(partition.localNames.getCount());
+            for (auto & triple : partition.emitter.triples) {
+                renumberLocalBlankNode(triple.subject, first);
+                renumberLocalBlankNode(triple.object, first);
+                emitter.emit(triple.subject, triple.predicate, triple.object);
+            }
+            partition.emitter.triples = std::vector<TermTriple>();
+        }
+        if (currentGraphName)
+            emitter.endGraph();
+    }
+
+    void
+    toRDF(const nlohmann::json & nodeMap, TripleEmitter & emitter, BlankNodeNames & blankNodeNames, const JsonLdOptions &options) {
 
         // Comments in this function are labeled with numbers that correspond to sections
         // from the description of the Deserialize JSON-LD to RDF algorithm.
         // See: https://www.w3.org/TR/json-ld11-api/#deserialize-json-ld-to-rdf-algorithm
 
-        RDF::RDFDataset dataset(options);
+        emitter.setBlankNodeNames(blankNodeNames);
+        emitter.setStats(options.getProcessingStats());
+        ProcessingStats::PhaseTimer timer(options.getProcessingStats(), ProcessingStats::Phase::TripleGeneration);
 
-        // 1)
-        // For each graph name and graph in node map ordered by graph name:
-        std::vector<std::string> graphNames;
-        for (json::iterator it = nodeMap.begin(); it != nodeMap.end(); ++it) {
-            graphNames.push_back(static_cast<const std::string &>(it.key()));
+        if (options.getRdfThreads() > 1) {
+            parallelToRDF(nodeMap, emitter, blankNodeNames, options);
+            return;
         }
-        std::sort(graphNames.begin(), graphNames.end());
 
-        for(const auto& graphName : graphNames) {
-            json & graph = nodeMap[graphName];
-            graphToRDF(graphName, graph, dataset, blankNodeNames, options);
+        // 1)
+        // For each graph name and graph in node map ordered by graph name:
+        // Note: nodeMap keeps its entries ordered by key.
+        for (auto it = nodeMap.begin(); it != nodeMap.end(); ++it) {
+            graphToRDF(it.key(), it.value(), emitter, blankNodeNames, options);
         }
-
-        return dataset;
     }
 
 }
@@ -831,21 +810,72 @@ RDF::RDFDataset RDFSerializationProcessor::toRDF(json expandedInput, const JsonL
 
     // 4)
     // Create a new map node map.
-    auto nodeMap = nlohmann::json::object();
-    nodeMap[JsonLdConsts::DEFAULT] = nlohmann::json::object();
+    NodeMap nodeMap;
 
     // 5)
     // Invoke the Node Map Generation algorithm, passing expanded input as element and node map.
-    BlankNodeNames blankNodeNames;
-    generateNodeMap(expandedInput, nodeMap, blankNodeNames);
+    {
+        ProcessingStats::PhaseTimer timer(options.getProcessingStats(), ProcessingStats::Phase::NodeMapGeneration);
+        nodeMap.add(expandedInput);
+    }
 
-    // 6)
+    // 6-7)
     // Invoke the Deserialize JSON-LD to RDF Algorithm passing node map, dataset, and the
-    // produceGeneralizedRdf flag from options.
-    RDF::RDFDataset dataset = ::toRDF(nodeMap, blankNodeNames, options);
+    // produceGeneralizedRdf flag from options. Resolve the promise with dataset.
+    return toRDF(nodeMap, options);
+}
 
-    // 7)
-    // Resolve the promise with dataset.
+RDF::RDFDataset RDFSerializationProcessor::toRDF(NodeMap & nodeMap, const JsonLdOptions& options) {
+    RDF::RDFDataset dataset(options);
+    DatasetEmitter emitter(dataset);
+    ::toRDF(nodeMap.getGraphs(), emitter, nodeMap.getBlankNodeNames(), options);
     return dataset;
 }
 
+void RDFSerializationProcessor::toRDF(NodeMap & nodeMap, const JsonLdOptions& options, RDF::QuadSink & sink) {
+    SinkEmitter emitter(sink);
+    ::toRDF(nodeMap.getGraphs(), emitter, nodeMap.getBlankNodeNames(), options);
+}
+
+void RDFSerializationProcessor::toRDF(json expandedInput, const JsonLdOptions& options, const QuadCallback & quadCallback) {
+    QuadCallbackSink sink(quadCallback);
+    toRDF(std::move(expandedInput), options, sink);
+}
+
+void RDFSerializationProcessor::toRDF(json expandedInput, const JsonLdOptions& options, RDF::QuadSink & sink) {
+
+    // Same as RDFSerializationProcessor::toRDF() above, but quads are handed to sink as
+    // they are generated. If the rdfChunkSize option is set, the node map generation and
+    // deserialization steps are run once per chunk of top-level nodes.
+
+    if(!expandedInput.is_array()) {
+        json tmp = json::array();
+        tmp.push_back(std::move(expandedInput));
+        expandedInput = std::move(tmp);
+    }
+
+    std::size_t chunkSize = options.getRdfChunkSize();
+    if(chunkSize == 0)
+        chunkSize = std::max<std::size_t>(expandedInput.size(), 1);
+
+    // Blank node identifiers are shared by all chunks
+    BlankNodeNames blankNodeNames;
+    SinkEmitter emitter(sink);
+
+    for(std::size_t begin = 0; begin < expandedInput.size(); begin += chunkSize) {
+        std::size_t end = std::min(begin + chunkSize, expandedInput.size());
+
+        json chunk = json::array();
+        for(std::size_t i = begin; i < end; i++)
+            chunk.push_back(std::move(expandedInput[i]));
+
+        NodeMap nodeMap(std::move(blankNodeNames));
+        {
+            ProcessingStats::PhaseTimer timer(options.getProcessingStats(), ProcessingStats::Phase::NodeMapGeneration);
+            nodeMap.add(chunk);
+        }
+
+        ::toRDF(nodeMap.getGraphs(), emitter, nodeMap.getBlankNodeNames(), options);
+        blankNodeNames = std::move(nodeMap.getBlankNodeNames());
+    }
+}
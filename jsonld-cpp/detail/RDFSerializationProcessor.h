@@ -1,13 +1,18 @@
 #ifndef LIBJSONLD_CPP_RDFSERIALIZATIONPROCESSOR_H
 #define LIBJSONLD_CPP_RDFSERIALIZATIONPROCESSOR_H
 
+#include <functional>
+
 #include "jsonld-cpp/jsoninc.h"
 
 
 class JsonLdOptions;
+class NodeMap;
 
 namespace RDF {
     class RDFDataset;
+    class RDFQuad;
+    class QuadSink;
 }
 
 struct RDFSerializationProcessor {
@@ -24,6 +29,42 @@ struct RDFSerializationProcessor {
      */
     static RDF::RDFDataset toRDF(nlohmann::ordered_json expandedInput, const JsonLdOptions& options);
 
+    /**
+     * Deserialize JSON-LD to RDF Algorithm, passing each generated quad to sink instead of
+     * collecting them into an RDFDataset. No RDFTriple or Node objects are created.
+     *
+     * If the rdfChunkSize option is set, the top-level node objects of expandedInput
+     * (for example, the contents of a top-level @graph) are processed in chunks of that
+     * many nodes. A node map is generated for each chunk and its quads are emitted before
+     * the next chunk is started. Blank node identifiers are shared across chunks, so labels
+     * stay consistent for the whole document. Because each chunk has its own node map,
+     * chunking is meant for documents whose top-level nodes are independent: if the same
+     * node is described in more than one chunk, its quads are emitted once per chunk, and
+     * conflicting @index values across chunks are not detected.
+     */
+    static void toRDF(nlohmann::ordered_json expandedInput, const JsonLdOptions& options, RDF::QuadSink & sink);
+
+    typedef std::function<void(const RDF::RDFQuad &)> QuadCallback;
+
+    /**
+     * Same as toRDF() with a QuadSink, but builds an RDFQuad for each generated quad
+     * and passes it to quadCallback.
+     */
+    static void toRDF(nlohmann::ordered_json expandedInput, const JsonLdOptions& options, const QuadCallback & quadCallback);
+
+    /**
+     * Deserialize JSON-LD to RDF Algorithm, starting from an already generated node map,
+     * so a document that is also flattened only has its node map generated once. Blank
+     * nodes created for lists are labeled with the blank node identifiers of nodeMap.
+     *
+     * https://www.w3.org/TR/json-ld11-api/#deserialize-json-ld-to-rdf-algorithm
+     */
+    static RDF::RDFDataset toRDF(NodeMap & nodeMap, const JsonLdOptions& options);
+
+    /**
+     * Same as toRDF() with a NodeMap, but passes each generated quad to sink.
+     */
+    static void toRDF(NodeMap & nodeMap, const JsonLdOptions& options, RDF::QuadSink & sink);
 
 };
 
@@ -0,0 +1,392 @@
+#include "jsonld-cpp/detail/Sha2.h"
+
+#include <algorithm>
+#include <cstring>
+
+#include "jsonld-cpp/JsonLdError.h"
+
+#if defined(__x86_64__) || defined(__i386__) || defined(_M_X64) || defined(_M_IX86)
+#define JSONLDCPP_SHA2_X86
+#include <immintrin.h>
+#if defined(_MSC_VER)
+#include <intrin.h>
+// MSVC allows intrinsics in any function
+#define JSONLDCPP_TARGET_SHA
+#else
+#include <cpuid.h>
+// the intrinsics are only compiled for the functions that use them, so the rest of the
+// library keeps running on processors without these instructions
+#define JSONLDCPP_TARGET_SHA __attribute__((target("sha,sse4.1,ssse3")))
+#endif
+#endif
+
+namespace {
+
+    const std::uint32_t K256[64] = {
+            0x428a2f98, 0x71374491, 0xb5c0fbcf, 0xe9b5dba5, 0x3956c25b, 0x59f111f1, 0x923f82a4, 0xab1c5ed5,
+            0xd807aa98, 0x12835b01, 0x243185be, 0x550c7dc3, 0x72be5d74, 0x80deb1fe, 0x9bdc06a7, 0xc19bf174,
+            0xe49b69c1, 0xefbe4786, 0x0fc19dc6, 0x240ca1cc, 0x2de92c6f, 0x4a7484aa, 0x5cb0a9dc, 0x76f988da,
+            0x983e5152, 0xa831c66d, 0xb00327c8, 0xbf597fc7, 0xc6e00bf3, 0xd5a79147, 0x06ca6351, 0x14292967,
+            0x27b70a85, 0x2e1b2138, 0x4d2c6dfc, 0x53380d13, 0x650a7354, 0x766a0abb, 0x81c2c92e, 0x92722c85,
+            0xa2bfe8a1, 0xa81a664b, 0xc24b8b70, 0xc76c51a3, 0xd192e819, 0xd6990624, 0xf40e3585, 0x106aa070,
+            0x19a4c116, 0x1e376c08, 0x2748774c, 0x34b0bcb5, 0x391c0cb3, 0x4ed8aa4a, 0x5b9cca4f, 0x682e6ff3,
+            0x748f82ee, 0x78a5636f, 0x84c87814, 0x8cc70208, 0x90befffa, 0xa4506ceb, 0xbef9a3f7, 0xc67178f2
+    };
+
+    const std::uint64_t K512[80] = {
+            0x428a2f98d728ae22ULL, 0x7137449123ef65cdULL, 0xb5c0fbcfec4d3b2fULL, 0xe9b5dba58189dbbcULL,
+            0x3956c25bf348b538ULL, 0x59f111f1b605d019ULL, 0x923f82a4af194f9bULL, 0xab1c5ed5da6d8118ULL,
+            0xd807aa98a3030242ULL, 0x12835b0145706fbeULL, 0x243185be4ee4b28cULL, 0x550c7dc3d5ffb4e2ULL,
+            0x72be5d74f27b896fULL, 0x80deb1fe3b1696b1ULL, 0x9bdc06a725c71235ULL, 0xc19bf174cf692694ULL,
+            0xe49b69c19ef14ad2ULL, 0xefbe4786384f25e3ULL, 0x0fc19dc68b8cd5b5ULL, 0x240ca1cc77ac9c65ULL,
+            0x2de92c6f592b0275ULL, 0x4a7484aa6ea6e483ULL, 0x5cb0a9dcbd41fbd4ULL, 0x76f988da831153b5ULL,
+            0x983e5152ee66dfabULL, 0xa831c66d2db43210ULL, 0xb00327c898fb213fULL, 0xbf597fc7beef0ee4ULL,
+            0xc6e00bf33da88fc2ULL, 0xd5a79147930aa725ULL, 0x06ca6351e003826fULL, 0x142929670a0e6e70ULL,
+            0x27b70a8546d22ffcULL, 0x2e1b21385c26c926ULL, 0x4d2c6dfc5ac42aedULL, 0x53380d139d95b3dfULL,
+            0x650a73548baf63deULL, 0x766a0abb3c77b2a8ULL, 0x81c2c92e47edaee6ULL, 0x92722c851482353bULL,
+            0xa2bfe8a14cf10364ULL, 0xa81a664bbc423001ULL, 0xc24b8b70d0f89791ULL, 0xc76c51a30654be30ULL,
+            0xd192e819d6ef5218ULL, 0xd69906245565a910ULL, 0xf40e35855771202aULL, 0x106aa07032bbd1b8ULL,
+            0x19a4c116b8d2d0c8ULL, 0x1e376c085141ab53ULL, 0x2748774cdf8eeb99ULL, 0x34b0bcb5e19b48a8ULL,
+            0x391c0cb3c5c95a63ULL, 0x4ed8aa4ae3418acbULL, 0x5b9cca4f7763e373ULL, 0x682e6ff3d6b2b8a3ULL,
+            0x748f82ee5defb2fcULL, 0x78a5636f43172f60ULL, 0x84c87814a1f0ab72ULL, 0x8cc702081a6439ecULL,
+            0x90befffa23631e28ULL, 0xa4506cebde82bde9ULL, 0xbef9a3f7b2c67915ULL, 0xc67178f2e372532bULL,
+            0xca273eceea26619cULL, 0xd186b8c721c0c207ULL, 0xeada7dd6cde0eb1eULL, 0xf57d4f7fee6ed178ULL,
+            0x06f067aa72176fbaULL, 0x0a637dc5a2c898a6ULL, 0x113f9804bef90daeULL, 0x1b710b35131c471bULL,
+            0x28db77f523047d84ULL, 0x32caab7b40c72493ULL, 0x3c9ebe0a15c9bebcULL, 0x431d67c49c100d4cULL,
+            0x4cc5d4becb3e42b6ULL, 0x597f299cfc657e2aULL, 0x5fcb6fab3ad6faecULL, 0x6c44198c4a475817ULL
+    };
+
+    const std::uint32_t INITIAL_STATE_256[8] = {
+            0x6a09e667, 0xbb67ae85, 0x3c6ef372, 0xa54ff53a, 0x510e527f, 0x9b05688c, 0x1f83d9ab, 0x5be0cd19
+    };
+
+    const std::uint64_t INITIAL_STATE_384[8] = {
+            0xcbbb9d5dc1059ed8ULL, 0x629a292a367cd507ULL, 0x9159015a3070dd17ULL, 0x152fecd8f70e5939ULL,
+            0x67332667ffc00b31ULL, 0x8eb44a8768581511ULL, 0xdb0c2e0d64f98fa7ULL, 0x47b5481dbefa4fa4ULL
+    };
+
+    inline std::uint32_t rotr32(std::uint32_t x, unsigned n) {
+        return (x >> n) | (x << (32 - n));
+    }
+
+    inline std::uint64_t rotr64(std::uint64_t x, unsigned n) {
+        return (x >> n) | (x << (64 - n));
+    }
+
+    inline std::uint32_t load32(const unsigned char * p) {
+        return (std::uint32_t(p[0]) << 24) | (std::uint32_t(p[1]) << 16) |
+               (std::uint32_t(p[2]) << 8) | std::uint32_t(p[3]);
+    }
+
+    inline std::uint64_t load64(const unsigned char * p) {
+        return (std::uint64_t(load32(p)) << 32) | load32(p + 4);
+    }
+
+#ifdef JSONLDCPP_SHA2_X86
+
+    void cpuid(unsigned leaf, unsigned registers[4]) {
+#if defined(_MSC_VER)
+        int values[4];
+        __cpuidex(values, static_cast<int>(leaf), 0);
+        for (int i = 0; i < 4; i++)
+            registers[i] = static_cast<unsigned>(values[i]);
+#else
+        registers[0] = registers[1] = registers[2] = registers[3] = 0;
+        __cpuid_count(leaf, 0, registers[0], registers[1], registers[2], registers[3]);
+#endif
+    }
+
+    bool detectShaExtensions() {
+        unsigned registers[4];
+        cpuid(0, registers);
+        if (registers[0] < 7)
+            return false;
+
+        cpuid(1, registers);
+        bool ssse3 = (registers[2] & (1u << 9)) != 0;
+        bool sse41 = (registers[2] & (1u << 19)) != 0;
+
+        cpuid(7, registers);
+        bool sha = (registers[1] & (1u << 29)) != 0;
+
+        return ssse3 && sse41 && sha;
+    }
+
+    bool hasShaExtensions() {
+        static const bool supported = detectShaExtensions();
+        return supported;
+    }
+
+    /**
+     * Compresses count 64 byte blocks into state with the SHA-NI instructions. Each group of
+     * four rounds takes four words of the message schedule, which is extended four words at
+     * a time by sha256msg1 and sha256msg2.
+     * See: https://www.intel.com/content/www/us/en/developer/articles/technical/intel-sha-extensions.html
+     */
+    JSONLDCPP_TARGET_SHA
+    void processBlocksShaExtensions(std::uint32_t state[8], const unsigned char * blocks, std::size_t count) {
+        const __m128i byteSwap = _mm_set_epi64x(0x0c0d0e0f08090a0bLL, 0x0405060700010203LL);
+
+        // the instructions keep the state as ABEF and CDGH
+        __m128i tmp = _mm_shuffle_epi32(_mm_loadu_si128(reinterpret_cast<const __m128i *>(state)), 0xB1);
+        __m128i state1 = _mm_shuffle_epi32(_mm_loadu_si128(reinterpret_cast<const __m128i *>(state + 4)), 0x1B);
+        __m128i state0 = _mm_alignr_epi8(tmp, state1, 8);
+        state1 = _mm_blend_epi16(state1, tmp, 0xF0);
+
+        for (; count > 0; count--, blocks += 64) {
+            const __m128i abefSave = state0;
+            const __m128i cdghSave = state1;
+
+            __m128i w[4];
+            for (unsigned i = 0; i < 16; i++) {
+                __m128i & words = w[i % 4];
+                if (i < 4)
+                    words = _mm_shuffle_epi8(
+                            _mm_loadu_si128(reinterpret_cast<const __m128i *>(blocks + i * 16)), byteSwap);
+                else {
+                    // W[t] = W[t-16] + s0(W[t-15]) + W[t-7] + s1(W[t-2])
+                    __m128i partial = _mm_sha256msg1_epu32(words, w[(i + 1) % 4]);
+                    partial = _mm_add_epi32(partial, _mm_alignr_epi8(w[(i + 3) % 4], w[(i + 2) % 4], 4));
+                    words = _mm_sha256msg2_epu32(partial, w[(i + 3) % 4]);
+                }
+
+                __m128i message = _mm_add_epi32(words, _mm_loadu_si128(reinterpret_cast<const __m128i *>(K256 + i * 4)));
+                state1 = _mm_sha256rnds2_epu32(state1, state0, message);
+                state0 = _mm_sha256rnds2_epu32(state0, state1, _mm_shuffle_epi32(message, 0x0E));
+            }
+
+            state0 = _mm_add_epi32(state0, abefSave);
+            state1 = _mm_add_epi32(state1, cdghSave);
+        }
+
+        // back to ABCD and EFGH
+        tmp = _mm_shuffle_epi32(state0, 0x1B);
+        state1 = _mm_shuffle_epi32(state1, 0xB1);
+        state0 = _mm_blend_epi16(tmp, state1, 0xF0);
+        state1 = _mm_alignr_epi8(state1, tmp, 8);
+        _mm_storeu_si128(reinterpret_cast<__m128i *>(state), state0);
+        _mm_storeu_si128(reinterpret_cast<__m128i *>(state + 4), state1);
+    }
+
+#endif
+
+    const char HEX_DIGITS[] = "0123456789abcdef";
+
+    void appendHex(std::string & out, std::uint64_t word, unsigned bytes) {
+        for (unsigned i = bytes; i-- > 0;) {
+            auto b = static_cast<unsigned>((word >> (i * 8)) & 0xff);
+            out.push_back(HEX_DIGITS[b >> 4]);
+            out.push_back(HEX_DIGITS[b & 0xf]);
+        }
+    }
+
+}
+
+Sha2::Sha2(Algorithm algorithm, Implementation implementation)
+        : algorithm(algorithm),
+          implementation(implementation) {
+    if (implementation == Implementation::Automatic)
+        this->implementation = isSupported(algorithm, Implementation::ShaExtensions) ?
+                               Implementation::ShaExtensions : Implementation::Portable;
+    else if (!isSupported(algorithm, implementation))
+        throw JsonLdError(JsonLdError::IllegalArgument, "Unsupported SHA-2 implementation for this processor");
+    reset();
+}
+
+void Sha2::reset() {
+    std::memcpy(state32, INITIAL_STATE_256, sizeof(state32));
+    std::memcpy(state64, INITIAL_STATE_384, sizeof(state64));
+    bufferLength = 0;
+    messageLength = 0;
+}
+
+Sha2::Algorithm Sha2::getAlgorithm() const {
+    return algorithm;
+}
+
+Sha2::Implementation Sha2::getImplementation() const {
+    return implementation;
+}
+
+bool Sha2::isSupported(Algorithm algorithm, Implementation implementation) {
+    if (implementation != Implementation::ShaExtensions)
+        return true;
+#ifdef JSONLDCPP_SHA2_X86
+    return algorithm == Algorithm::SHA256 && hasShaExtensions();
+#else
+    (void)algorithm;
+    return false;
+#endif
+}
+
+std::size_t Sha2::blockSize() const {
+    return algorithm == Algorithm::SHA256 ? 64 : 128;
+}
+
+void Sha2::update(const std::string & data) {
+    update(data.data(), data.size());
+}
+
+void Sha2::update(const char * data, std::size_t length) {
+    auto input = reinterpret_cast<const unsigned char *>(data);
+    const std::size_t size = blockSize();
+    messageLength += length;
+
+    // top up a partially filled buffer first
+    if (bufferLength > 0) {
+        std::size_t n = std::min(length, size - bufferLength);
+        std::memcpy(buffer + bufferLength, input, n);
+        bufferLength += n;
+        input += n;
+        length -= n;
+        if (bufferLength < size)
+            return;
+        processBlocks(buffer, 1);
+        bufferLength = 0;
+    }
+
+    // whole blocks are hashed directly from the input
+    std::size_t count = length / size;
+    if (count > 0) {
+        processBlocks(input, count);
+        input += count * size;
+        length -= count * size;
+    }
+
+    if (length > 0) {
+        std::memcpy(buffer, input, length);
+        bufferLength = length;
+    }
+}
+
+std::string Sha2::hexDigest() {
+    const std::size_t size = blockSize();
+    const std::size_t lengthFieldSize = algorithm == Algorithm::SHA256 ? 8 : 16;
+    const std::uint64_t bitLength = messageLength * 8;
+
+    // padding: a single 1 bit, zeros, then the message length in bits
+    buffer[bufferLength++] = 0x80;
+    if (bufferLength > size - lengthFieldSize) {
+        std::memset(buffer + bufferLength, 0, size - bufferLength);
+        processBlocks(buffer, 1);
+        bufferLength = 0;
+    }
+    std::memset(buffer + bufferLength, 0, size - bufferLength);
+    for (unsigned i = 0; i < 8; i++)
+        buffer[size - 1 - i] = static_cast<unsigned char>(bitLength >> (i * 8));
+    processBlocks(buffer, 1);
+
+    std::string result;
+    if (algorithm == Algorithm::SHA256) {
+        result.reserve(64);
+        for (auto word : state32)
+            appendHex(result, word, 4);
+    }
+    else {
+        // SHA-384 is SHA-512 with different initial values, truncated to six words
+        result.reserve(96);
+        for (unsigned i = 0; i < 6; i++)
+            appendHex(result, state64[i], 8);
+    }
+
+    reset();
+    return result;
+}
+
+std::string Sha2::hexDigest(Algorithm algorithm, const std::string & data) {
+    Sha2 sha(algorithm);
+    sha.update(data);
+    return sha.hexDigest();
+}
+
+Sha2::Algorithm Sha2::algorithmFromName(const std::string & name) {
+    if (name.empty() || name == "SHA256" || name == "SHA-256")
+        return Algorithm::SHA256;
+    if (name == "SHA384" || name == "SHA-384")
+        return Algorithm::SHA384;
+    throw JsonLdError(JsonLdError::IllegalArgument, "Unsupported hash algorithm: " + name);
+}
+
+void Sha2::processBlocks(const unsigned char * blocks, std::size_t count) {
+#ifdef JSONLDCPP_SHA2_X86
+    if (implementation == Implementation::ShaExtensions) {
+        processBlocksShaExtensions(state32, blocks, count);
+        return;
+    }
+#endif
+    const std::size_t size = blockSize();
+    for (std::size_t i = 0; i < count; i++) {
+        if (algorithm == Algorithm::SHA256)
+            processBlock256(blocks + i * size);
+        else
+            processBlock512(blocks + i * size);
+    }
+}
+
+void Sha2::processBlock256(const unsigned char * block) {
+    std::uint32_t w[64];
+    for (unsigned i = 0; i < 16; i++)
+        w[i] = load32(block + i * 4);
+    for (unsigned i = 16; i < 64; i++) {
+        std::uint32_t s0 = rotr32(w[i - 15], 7) ^ rotr32(w[i - 15], 18) ^ (w[i - 15] >> 3);
+        std::uint32_t s1 = rotr32(w[i - 2], 17) ^ rotr32(w[i - 2], 19) ^ (w[i - 2] >> 10);
+        w[i] = w[i - 16] + s0 + w[i - 7] + s1;
+    }
+
+    std::uint32_t a = state32[0], b = state32[1], c = state32[2], d = state32[3];
+    std::uint32_t e = state32[4], f = state32[5], g = state32[6], h = state32[7];
+
+    for (unsigned i = 0; i < 64; i++) {
+        std::uint32_t S1 = rotr32(e, 6) ^ rotr32(e, 11) ^ rotr32(e, 25);
+        std::uint32_t ch = g ^ (e & (f ^ g));
+        std::uint32_t t1 = h + S1 + ch + K256[i] + w[i];
+        std::uint32_t S0 = rotr32(a, 2) ^ rotr32(a, 13) ^ rotr32(a, 22);
+        std::uint32_t maj = (a & b) | (c & (a | b));
+        std::uint32_t t2 = S0 + maj;
+        h = g;
+        g = f;
+        f = e;
+        e = d + t1;
+        d = c;
+        c = b;
+        b = a;
+        a = t1 + t2;
+    }
+
+    state32[0] += a; state32[1] += b; state32[2] += c; state32[3] += d;
+    state32[4] += e; state32[5] += f; state32[6] += g; state32[7] += h;
+}
+
+void Sha2::processBlock512(const unsigned char * block) {
+    std::uint64_t w[80];
+    for (unsigned i = 0; i < 16; i++)
+        w[i] = load64(block + i * 8);
+    for (unsigned i = 16; i < 80; i++) {
+        std::uint64_t s0 = rotr64(w[i - 15], 1) ^ rotr64(w[i - 15], 8) ^ (w[i - 15] >> 7);
+        std::uint64_t s1 = rotr64(w[i - 2], 19) ^ rotr64(w[i - 2], 61) ^ (w[i - 2] >> 6);
+        w[i] = w[i - 16] + s0 + w[i - 7] + s1;
+    }
+
+    std::uint64_t a = state64[0], b = state64[1], c = state64[2], d = state64[3];
+    std::uint64_t e = state64[4], f = state64[5], g = state64[6], h = state64[7];
+
+    for (unsigned i = 0; i < 80; i++) {
+        std::uint64_t S1 = rotr64(e, 14) ^ rotr64(e, 18) ^ rotr64(e, 41);
+        std::uint64_t ch = g ^ (e & (f ^ g));
+        std::uint64_t t1 = h + S1 + ch + K512[i] + w[i];
+        std::uint64_t S0 = rotr64(a, 28) ^ rotr64(a, 34) ^ rotr64(a, 39);
+        std::uint64_t maj = (a & b) | (c & (a | b));
+        std::uint64_t t2 = S0 + maj;
+        h = g;
+        g = f;
+        f = e;
+        e = d + t1;
+        d = c;
+        c = b;
+        b = a;
+        a = t1 + t2;
+    }
+
+    state64[0] += a; state64[1] += b; state64[2] += c; state64[3] += d;
+    state64[4] += e; state64[5] += f; state64[6] += g; state64[7] += h;
+}
@@ -0,0 +1,102 @@
+#ifndef LIBJSONLD_CPP_SHA2_H
+#define LIBJSONLD_CPP_SHA2_H
+
+#include <cstdint>
+#include <cstddef>
+#include <string>
+
+/**
+ * Sha2 is a small, dependency-free implementation of the SHA-256 and SHA-384 hash
+ * functions, as needed by RDF Dataset Canonicalization.
+ *
+ * Input can be given all at once or incrementally, by calling update() as many times as
+ * needed before calling hexDigest().
+ *
+ * On x86 processors with the SHA extensions, SHA-256 blocks are compressed with the
+ * SHA-NI instructions. The instructions are detected at run time, so the library is built
+ * without any target-specific compiler flag, and the portable implementation is used on
+ * other processors. There are no such instructions for SHA-384 on common processors, so it
+ * always uses the portable implementation.
+ *
+ * See: https://csrc.nist.gov/publications/detail/fips/180/4/final
+ */
+class Sha2 {
+public:
+    enum class Algorithm { SHA256, SHA384 };
+
+    /**
+     * How blocks are compressed. Automatic selects the fastest implementation supported
+     * by the processor; the others are mostly useful for testing and benchmarking.
+     */
+    enum class Implementation { Automatic, Portable, ShaExtensions };
+
+    /**
+     * Throws a JsonLdError if implementation is not supported for algorithm on this
+     * processor.
+     */
+    explicit Sha2(Algorithm algorithm = Algorithm::SHA256, Implementation implementation = Implementation::Automatic);
+
+    /**
+     * Adds length bytes of data to the message being hashed
+     */
+    void update(const char * data, std::size_t length);
+
+    /**
+     * Adds data to the message being hashed
+     */
+    void update(const std::string & data);
+
+    /**
+     * Finishes hashing and returns the digest as a lowercase hexadecimal string. The
+     * object is reset afterwards, so it can be used to hash another message.
+     */
+    std::string hexDigest();
+
+    /**
+     * Clears any input given so far
+     */
+    void reset();
+
+    Algorithm getAlgorithm() const;
+
+    /**
+     * Returns the implementation used, which is never Automatic
+     */
+    Implementation getImplementation() const;
+
+    /**
+     * Returns true if implementation can be used for algorithm on this processor
+     */
+    static bool isSupported(Algorithm algorithm, Implementation implementation);
+
+    /**
+     * Returns the hexadecimal digest of data using algorithm
+     */
+    static std::string hexDigest(Algorithm algorithm, const std::string & data);
+
+    /**
+     * Returns the Algorithm for a hash algorithm name as used in JsonLdOptions. Accepts
+     * "SHA256" and "SHA384" (and the hyphenated forms); an empty name means SHA256.
+     * Throws a JsonLdError for any other name.
+     */
+    static Algorithm algorithmFromName(const std::string & name);
+
+private:
+    Algorithm algorithm;
+    Implementation implementation;
+
+    // SHA-256 uses 32-bit words and 64 byte blocks, SHA-384 uses 64-bit
+    // words and 128 byte blocks.
+    std::uint32_t state32[8];
+    std::uint64_t state64[8];
+    unsigned char buffer[128];
+    std::size_t bufferLength;
+    std::uint64_t messageLength;
+
+    std::size_t blockSize() const;
+    void processBlocks(const unsigned char * blocks, std::size_t count);
+    void processBlock256(const unsigned char * block);
+    void processBlock512(const unsigned char * block);
+};
+
+#endif //LIBJSONLD_CPP_SHA2_H
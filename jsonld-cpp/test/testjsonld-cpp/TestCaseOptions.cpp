@@ -9,8 +9,8 @@ namespace {
                manifestEntry[entryKey].get<std::string>() : defaultEntry;
     }
 
-    bool getBool(const nlohmann::json &manifestEntry, const std::string & entryKey) {
-        return manifestEntry.contains(entryKey) && manifestEntry[entryKey].get<bool>();
+    bool getBool(const nlohmann::json &manifestEntry, const std::string & entryKey, bool defaultValue = false) {
+        return manifestEntry.contains(entryKey) ? manifestEntry[entryKey].get<bool>() : defaultValue;
     }
 
 }
@@ -31,9 +31,9 @@ TestCaseOptions TestCaseOptions::create(nlohmann::json manifestEntryOptions, con
         result.expandContext = JsonLdUrl::resolve(&baseUri, &context);
     }
 
-    result.compactArrays = getBool(manifestEntryOptions, "compactArrays");
+    result.compactArrays = getBool(manifestEntryOptions, "compactArrays", true);
 
-    result.compactToRelative = getBool(manifestEntryOptions, "compactToRelative");
+    result.compactToRelative = getBool(manifestEntryOptions, "compactToRelative", true);
 
     result.rdfDirection = getEntryOr(manifestEntryOptions, "rdfDirection", "");
 
@@ -45,6 +45,16 @@ TestCaseOptions TestCaseOptions::create(nlohmann::json manifestEntryOptions, con
 
     result.hashAlgorithm = getEntryOr(manifestEntryOptions, "hashAlgorithm", "");
 
+    result.embed = getEntryOr(manifestEntryOptions, "embed", "@once");
+
+    result.explicitInclusion = getBool(manifestEntryOptions, "explicit");
+
+    result.omitDefault = getBool(manifestEntryOptions, "omitDefault");
+
+    result.omitGraph = getBool(manifestEntryOptions, "omitGraph");
+
+    result.requireAll = getBool(manifestEntryOptions, "requireAll");
+
     return result;
 }
 
@@ -60,4 +70,9 @@ void TestCaseOptions::copyTo(JsonLdOptions & jsonLdOptions) {
     jsonLdOptions.setProduceGeneralizedRdf(produceGeneralizedRdf);
     jsonLdOptions.setUseNativeTypes(useNativeTypes);
     jsonLdOptions.setUseRdfType(useRdfType);
+    jsonLdOptions.setEmbed(embed);
+    jsonLdOptions.setExplicit(explicitInclusion);
+    jsonLdOptions.setOmitDefault(omitDefault);
+    jsonLdOptions.setOmitGraph(omitGraph);
+    jsonLdOptions.setRequireAll(requireAll);
 }
@@ -13,13 +13,18 @@ struct TestCaseOptions {
     std::string processingMode;
     bool normative = false;
     std::string expandContext;
-    bool compactArrays = false;
-    bool compactToRelative = false;
+    bool compactArrays = true;
+    bool compactToRelative = true;
     std::string rdfDirection;
     bool produceGeneralizedRdf = false;
     bool useNativeTypes = false;
     bool useRdfType = false;
     std::string hashAlgorithm;
+    std::string embed = "@once";
+    bool explicitInclusion = false;
+    bool omitDefault = false;
+    bool omitGraph = false;
+    bool requireAll = false;
 
 };
 
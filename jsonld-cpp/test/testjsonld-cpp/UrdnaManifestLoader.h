@@ -1,5 +1,5 @@
-#ifndef LIBJSONLD_CPP_MANIFESTLOADER_H
-#define LIBJSONLD_CPP_MANIFESTLOADER_H
+#ifndef LIBJSONLD_CPP_URDNAMANIFESTLOADER_H
+#define LIBJSONLD_CPP_URDNAMANIFESTLOADER_H
 
 #include <string>
 #include <map>
@@ -29,4 +29,4 @@ private:
 };
 
 
-#endif //LIBJSONLD_CPP_MANIFESTLOADER_H
+#endif //LIBJSONLD_CPP_URDNAMANIFESTLOADER_H
@@ -1,6 +1,8 @@
 #pragma ide diagnostic ignored "cert-err58-cpp"
 #include "jsonld-cpp/BlankNodeNames.h"
 #include <algorithm>
+#include <set>
+#include <thread>
 
 #include <gtest/gtest.h>
 #pragma clang diagnostic push
@@ -90,3 +92,37 @@ TEST(BlankNodeNamesGenTest, differentPrefix) {
     EXPECT_EQ(result, "foo0");
 }
 
+
+TEST(BlankNodeNamesGenTest, reserveBlock_continuesCounter) {
+    BlankNodeNames gen;
+    EXPECT_EQ(gen.get(), "_:b0");
+
+    std::size_t first = gen.reserveBlock(10);
+    EXPECT_EQ(first, 1u);
+    EXPECT_EQ(gen.getName(first + 9), "_:b10");
+    EXPECT_EQ(gen.getCount(), 11u);
+    EXPECT_EQ(gen.get(), "_:b11");
+}
+
+TEST(BlankNodeNamesGenTest, concurrentGenerations_areUnique) {
+    BlankNodeNames gen;
+    const std::size_t numThreads = 4;
+    const std::size_t namesPerThread = 1000;
+
+    std::vector<std::vector<std::string>> names(numThreads);
+    std::vector<std::thread> threads;
+    for(std::size_t t = 0; t < numThreads; t++) {
+        threads.emplace_back([&gen, &names, t]() {
+            for(std::size_t i = 0; i < namesPerThread; i++)
+                names[t].push_back(gen.get());
+        });
+    }
+    for(auto & thread : threads)
+        thread.join();
+
+    std::set<std::string> unique;
+    for(const auto & threadNames : names)
+        unique.insert(threadNames.begin(), threadNames.end());
+    EXPECT_EQ(unique.size(), numThreads * namesPerThread);
+    EXPECT_EQ(gen.getCount(), numThreads * namesPerThread);
+}
@@ -0,0 +1,151 @@
+#pragma ide diagnostic ignored "cert-err58-cpp"
+#include <jsonld-cpp/detail/CompactionProcessor.h>
+
+#include <jsonld-cpp/FileLoader.h>
+#include <jsonld-cpp/JsonLdError.h>
+#include <jsonld-cpp/JsonLdOptions.h>
+#include <jsonld-cpp/JsonLdProcessor.h>
+#include <jsonld-cpp/detail/ContextProcessor.h>
+
+#include <gtest/gtest.h>
+#pragma clang diagnostic push
+#pragma GCC diagnostic push
+#pragma clang diagnostic ignored "-Weverything"
+#pragma GCC diagnostic ignored "-Wall"
+#pragma GCC diagnostic ignored "-Wextra"
+#include <rapidcheck/gtest.h>
+#pragma clang diagnostic pop
+#pragma GCC diagnostic pop
+
+using json = nlohmann::ordered_json;
+
+namespace {
+
+    std::string peopleLocation() {
+        return "file://" + std::string(TEST_RESOURCE_DIR) + "test_data/compact/people.jsonld";
+    }
+
+    json peopleContext() {
+        return json::parse(R"({
+          "@context": {
+            "@vocab": "http://example.com/vocab#",
+            "friend": {"@id": "http://example.com/vocab#knows", "@type": "@id"},
+            "keywords": {"@id": "http://example.com/vocab#tags", "@container": "@list"},
+            "labels": {"@id": "http://example.com/vocab#label", "@container": "@language"},
+            "children": {"@id": "http://example.com/vocab#child", "@type": "@id", "@container": "@set"}
+          }
+        })");
+    }
+
+    Context processContext(const std::string & localContext, const std::string & base = "") {
+        JsonLdOptions options(base);
+        return ContextProcessor::process(Context(options), json::parse(localContext), base);
+    }
+
+}
+
+TEST(CompactionProcessorTest, compact_selectsTermsAndContainers) {
+    JsonLdOptions options(std::unique_ptr<DocumentLoader>(new FileLoader()));
+    json result = JsonLdProcessor::compact(peopleLocation(), peopleContext(), options);
+
+    json expected = json::parse(R"({
+      "@graph": [
+        {
+          "@id": "http://example.com/people/dave",
+          "@type": "Person",
+          "name": "Dave",
+          "friend": "http://example.com/people/markus",
+          "keywords": ["a", "b"],
+          "labels": {"en": "Dave", "de": "David"},
+          "age": 42
+        },
+        {
+          "@id": "http://example.com/people/markus",
+          "name": "Markus",
+          "@reverse": {"children": ["http://example.com/people/dave"]}
+        }
+      ]
+    })");
+    EXPECT_EQ(result.at("@context"), peopleContext().at("@context"));
+    EXPECT_EQ(result.at("@graph"), expected.at("@graph"));
+}
+
+TEST(CompactionProcessorTest, compact_sameContextGivesSameResultForEachDocument) {
+    JsonLdOptions options1(std::unique_ptr<DocumentLoader>(new FileLoader()));
+    JsonLdOptions options2(std::unique_ptr<DocumentLoader>(new FileLoader()));
+    json result1 = JsonLdProcessor::compact(peopleLocation(), peopleContext(), options1);
+    json result2 = JsonLdProcessor::compact(peopleLocation(), peopleContext(), options2);
+    EXPECT_EQ(result1, result2);
+}
+
+TEST(CompactionProcessorTest, compact_withoutCompactArraysKeepsArrays) {
+    JsonLdOptions options(std::unique_ptr<DocumentLoader>(new FileLoader()));
+    options.setCompactArrays(false);
+    json result = JsonLdProcessor::compact(peopleLocation(), peopleContext(), options);
+
+    const json & dave = result.at("@graph").at(0);
+    EXPECT_EQ(dave.at("@type"), json::array({"Person"}));
+    EXPECT_EQ(dave.at("name"), json::array({"Dave"}));
+    EXPECT_EQ(dave.at("friend"), json::array({"http://example.com/people/markus"}));
+}
+
+TEST(CompactionProcessorTest, compact_reversePropertyTerm) {
+    JsonLdOptions options(std::unique_ptr<DocumentLoader>(new FileLoader()));
+    json context = json::parse(R"({
+      "name": "http://example.com/vocab#name",
+      "parent": {"@reverse": "http://example.com/vocab#child", "@type": "@id"}
+    })");
+    json result = JsonLdProcessor::compact(peopleLocation(), context, options);
+
+    const json & markus = result.at("@graph").at(1);
+    EXPECT_EQ(markus.at("parent"), "http://example.com/people/dave");
+    EXPECT_FALSE(markus.contains("@reverse"));
+}
+
+TEST(CompactionProcessorTest, compactIri_prefersTermThenVocabThenCompactIri) {
+    Context context = processContext(R"({
+      "@vocab": "http://example.com/vocab#",
+      "ex": "http://example.org/",
+      "name": "http://xmlns.com/foaf/0.1/name",
+      "type": "@type"
+    })");
+
+    EXPECT_EQ(CompactionProcessor::compactIri(context, "http://xmlns.com/foaf/0.1/name"), "name");
+    EXPECT_EQ(CompactionProcessor::compactIri(context, "http://example.com/vocab#age"), "age");
+    EXPECT_EQ(CompactionProcessor::compactIri(context, "http://example.org/thing"), "ex:thing");
+    EXPECT_EQ(CompactionProcessor::compactIri(context, "@type"), "type");
+    EXPECT_EQ(CompactionProcessor::compactIri(context, "http://other.example/"), "http://other.example/");
+}
+
+TEST(CompactionProcessorTest, compactIri_relativeToBaseWhenNotVocab) {
+    Context context = processContext("{}", "http://example.com/dir/doc");
+
+    EXPECT_EQ(CompactionProcessor::compactIri(context, "http://example.com/dir/other", nullptr, false), "other");
+    EXPECT_EQ(CompactionProcessor::compactIri(context, "http://example.com/dir/other", nullptr, true),
+              "http://example.com/dir/other");
+}
+
+TEST(CompactionProcessorTest, compactIri_iriConfusedWithPrefix) {
+    Context context = processContext(R"({"ex": "http://example.org/"})");
+
+    try {
+        CompactionProcessor::compactIri(context, "ex:thing");
+        FAIL() << "Expected JsonLdError";
+    }
+    catch (JsonLdError &e) {
+        EXPECT_EQ(std::string(e.what()).find(JsonLdError::IriConfusedWithPrefix), 0);
+    }
+}
+
+TEST(CompactionProcessorTest, inverseContext_sharedByCopiesUntilChanged) {
+    Context context = processContext(R"({"name": "http://xmlns.com/foaf/0.1/name"})");
+    const InverseContext * inverseContext = &context.getInverseContext();
+    Context copy = context;
+
+    EXPECT_EQ(&copy.getInverseContext(), inverseContext);
+    EXPECT_TRUE(inverseContext->contains("http://xmlns.com/foaf/0.1/name"));
+
+    copy.getTermDefinitions().erase("name");
+    EXPECT_FALSE(copy.getInverseContext().contains("http://xmlns.com/foaf/0.1/name"));
+    EXPECT_EQ(&context.getInverseContext(), inverseContext);
+}
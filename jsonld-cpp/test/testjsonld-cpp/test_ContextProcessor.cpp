@@ -0,0 +1,52 @@
+#pragma ide diagnostic ignored "cert-err58-cpp"
+#include <jsonld-cpp/detail/ContextProcessor.h>
+
+#include <jsonld-cpp/JsonLdOptions.h>
+
+#include <gtest/gtest.h>
+#pragma clang diagnostic push
+#pragma GCC diagnostic push
+#pragma clang diagnostic ignored "-Weverything"
+#pragma GCC diagnostic ignored "-Wall"
+#pragma GCC diagnostic ignored "-Wextra"
+#include <rapidcheck/gtest.h>
+#pragma clang diagnostic pop
+#pragma GCC diagnostic pop
+
+using json = nlohmann::ordered_json;
+
+TEST(ContextProcessorTest, expandIri_withTermDefinitions) {
+    JsonLdOptions options("http://example.com/base/");
+    Context context = ContextProcessor::process(Context(options), json::parse(R"({
+        "@vocab": "http://example.com/vocab#",
+        "schema": "http://schema.org/",
+        "name": "schema:name",
+        "type": "@type"
+    })"), options.getBase());
+
+    for (int i = 0; i < 2; i++) {
+        EXPECT_EQ(ContextProcessor::expandIri(context, "name", false, true), "http://schema.org/name");
+        EXPECT_EQ(ContextProcessor::expandIri(context, "schema:price", false, true), "http://schema.org/price");
+        EXPECT_EQ(ContextProcessor::expandIri(context, "type", false, true), "@type");
+        EXPECT_EQ(ContextProcessor::expandIri(context, "other", false, true), "http://example.com/vocab#other");
+        EXPECT_EQ(ContextProcessor::expandIri(context, "other", true, false), "http://example.com/base/other");
+    }
+}
+
+TEST(ContextProcessorTest, expandIri_cachedResultsDoNotOutliveChanges) {
+    JsonLdOptions options("http://example.com/base/");
+    Context context(options);
+    EXPECT_EQ(ContextProcessor::expandIri(context, "name", false, true), "name");
+
+    Context copy = context;
+    copy.setVocabularyMapping("http://example.com/vocab#");
+    EXPECT_EQ(ContextProcessor::expandIri(copy, "name", false, true), "http://example.com/vocab#name");
+    EXPECT_EQ(ContextProcessor::expandIri(context, "name", false, true), "name");
+
+    copy.getTermDefinitions()["name"] = {{"@id", "http://schema.org/name"}};
+    EXPECT_EQ(ContextProcessor::expandIri(copy, "name", false, true), "http://schema.org/name");
+
+    EXPECT_EQ(ContextProcessor::expandIri(context, "name", true, false), "http://example.com/base/name");
+    context.setBaseIri("http://example.org/");
+    EXPECT_EQ(ContextProcessor::expandIri(context, "name", true, false), "http://example.org/name");
+}
@@ -0,0 +1,88 @@
+#pragma ide diagnostic ignored "cert-err58-cpp"
+#include <jsonld-cpp/DiagnosticsSink.h>
+
+#include <jsonld-cpp/JsonLdOptions.h>
+#include <jsonld-cpp/detail/ContextProcessor.h>
+
+#include <sstream>
+
+#include <gtest/gtest.h>
+#pragma clang diagnostic push
+#pragma GCC diagnostic push
+#pragma clang diagnostic ignored "-Weverything"
+#pragma GCC diagnostic ignored "-Wall"
+#pragma GCC diagnostic ignored "-Wextra"
+#include <rapidcheck/gtest.h>
+#pragma clang diagnostic pop
+#pragma GCC diagnostic pop
+
+using json = nlohmann::ordered_json;
+
+TEST(DiagnosticsSinkTest, collector_countsAllAndRetainsUpToCap) {
+    DiagnosticsCollector collector(2);
+    collector.warning(DiagnosticsSink::Code::MalformedLanguageTag, "one");
+    collector.warning(DiagnosticsSink::Code::IriHasKeywordForm, "two");
+    collector.warning(DiagnosticsSink::Code::MalformedLanguageTag, "three");
+
+    EXPECT_EQ(collector.getTotalCount(), 3);
+    EXPECT_EQ(collector.getCount(DiagnosticsSink::Code::MalformedLanguageTag), 2);
+    EXPECT_EQ(collector.getCount(DiagnosticsSink::Code::IriHasKeywordForm), 1);
+    EXPECT_EQ(collector.getCount(DiagnosticsSink::Code::TermHasKeywordForm), 0);
+
+    auto messages = collector.getMessages();
+    ASSERT_EQ(messages.size(), 2);
+    EXPECT_EQ(messages[0].code, DiagnosticsSink::Code::MalformedLanguageTag);
+    EXPECT_EQ(messages[0].message, "one");
+    EXPECT_EQ(messages[1].message, "two");
+
+    collector.clear();
+    EXPECT_EQ(collector.getTotalCount(), 0);
+    EXPECT_TRUE(collector.getMessages().empty());
+}
+
+TEST(DiagnosticsSinkTest, collector_zeroCapKeepsCountsOnly) {
+    DiagnosticsCollector collector(0);
+    collector.warning(DiagnosticsSink::Code::IdHasKeywordForm, "one");
+    EXPECT_EQ(collector.getCount(DiagnosticsSink::Code::IdHasKeywordForm), 1);
+    EXPECT_TRUE(collector.getMessages().empty());
+}
+
+TEST(DiagnosticsSinkTest, streamSink_limitsMessagesPerCode) {
+    std::stringstream out;
+    StreamDiagnosticsSink sink(out, 1);
+    sink.warning(DiagnosticsSink::Code::MalformedLanguageTag, "language tag a is not well-formed.");
+    sink.warning(DiagnosticsSink::Code::MalformedLanguageTag, "language tag b is not well-formed.");
+    sink.warning(DiagnosticsSink::Code::TermHasKeywordForm, "term @x should not have the form of a keyword.");
+
+    EXPECT_EQ(out.str(), "Warning: language tag a is not well-formed.\n"
+                         "Warning: term @x should not have the form of a keyword.\n");
+    EXPECT_EQ(sink.getSuppressedCount(), 1);
+}
+
+TEST(DiagnosticsSinkTest, contextProcessing_reportsWarningsToSharedSink) {
+    auto collector = std::make_shared<DiagnosticsCollector>();
+    JsonLdOptions options("http://example.com/base/");
+    options.setDiagnosticsSink(collector);
+
+    // the context holds a copy of the options, which must share the sink
+    Context context = ContextProcessor::process(Context(options), json::parse(R"({
+        "@language": "not a tag",
+        "@ignoreMe": "http://example.com/ignored"
+    })"), options.getBase());
+
+    EXPECT_EQ(collector->getCount(DiagnosticsSink::Code::MalformedLanguageTag), 1);
+    EXPECT_EQ(collector->getCount(DiagnosticsSink::Code::TermHasKeywordForm), 1);
+
+    for (int i = 0; i < 2; i++)
+        EXPECT_EQ(ContextProcessor::expandIri(context, "@ignoreMe", false, true), "");
+    EXPECT_EQ(collector->getCount(DiagnosticsSink::Code::IriHasKeywordForm), 2);
+}
+
+TEST(DiagnosticsSinkTest, contextProcessing_withoutSinkDiscardsWarnings) {
+    JsonLdOptions options;
+    EXPECT_EQ(options.getDiagnosticsSink(), nullptr);
+    Context context = ContextProcessor::process(Context(options), json::parse(R"({
+        "@ignoreMe": "http://example.com/ignored"
+    })"), options.getBase());
+    EXPECT_EQ(ContextProcessor::expandIri(context, "@ignoreMe", false, true), "");
+}
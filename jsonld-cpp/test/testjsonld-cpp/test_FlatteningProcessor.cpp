@@ -0,0 +1,103 @@
+#pragma ide diagnostic ignored "cert-err58-cpp"
+#include <jsonld-cpp/detail/FlatteningProcessor.h>
+
+#include <jsonld-cpp/FileLoader.h>
+#include <jsonld-cpp/JsonLdOptions.h>
+#include <jsonld-cpp/JsonLdProcessor.h>
+#include <jsonld-cpp/NQuadsSerialization.h>
+#include <jsonld-cpp/RDFDataset.h>
+#include <jsonld-cpp/detail/NodeMap.h>
+
+#include <gtest/gtest.h>
+#pragma clang diagnostic push
+#pragma GCC diagnostic push
+#pragma clang diagnostic ignored "-Weverything"
+#pragma GCC diagnostic ignored "-Wall"
+#pragma GCC diagnostic ignored "-Wextra"
+#include <rapidcheck/gtest.h>
+#pragma clang diagnostic pop
+#pragma GCC diagnostic pop
+
+using json = nlohmann::ordered_json;
+
+namespace {
+
+    std::string resourceLocation(const std::string & name) {
+        return "file://" + std::string(TEST_RESOURCE_DIR) + "test_data/" + name;
+    }
+
+}
+
+TEST(FlatteningProcessorTest, flatten_collectsNodesOfDefaultAndNamedGraphs) {
+    JsonLdOptions options(std::unique_ptr<DocumentLoader>(new FileLoader()));
+    json flattened = JsonLdProcessor::flatten(resourceLocation("chunked-graph.jsonld"), json(), options);
+
+    ASSERT_TRUE(flattened.is_array());
+    std::vector<std::string> ids;
+    for (const auto & node : flattened)
+        ids.push_back(node.at("@id").get<std::string>());
+    std::vector<std::string> expectedIds = {
+            "_:b0", "_:b1", "_:b2", "_:b3",
+            "http://example.com/graphs/g1",
+            "http://example.com/people/dave",
+            "http://example.com/people/gregg"};
+    EXPECT_EQ(ids, expectedIds);
+
+    // properties of _:markus from the default graph are merged into one node
+    const json & markus = flattened.at(0);
+    EXPECT_EQ(markus.at("http://example.com/vocab#name"), json::parse(R"([{"@value": "Markus"}])"));
+    EXPECT_TRUE(markus.contains("http://example.com/vocab#tags"));
+    EXPECT_FALSE(markus.contains("http://example.com/vocab#age"));
+
+    // nested node is replaced by a reference
+    EXPECT_EQ(flattened.at(1).at("http://example.com/vocab#address"), json::parse(R"([{"@id": "_:b2"}])"));
+
+    // named graph node holds the nodes of that graph
+    EXPECT_EQ(flattened.at(4).at("@graph"), json::parse(R"([
+        {"@id": "_:b0", "http://example.com/vocab#age": [{"@value": 42}]}
+    ])"));
+}
+
+TEST(FlatteningProcessorTest, flatten_withContextCompactsUnderGraph) {
+    JsonLdOptions options(std::unique_ptr<DocumentLoader>(new FileLoader()));
+    json context = json::parse(R"({"@vocab": "http://example.com/vocab#"})");
+    json flattened = JsonLdProcessor::flatten(resourceLocation("flatten-single-node.jsonld"), context, options);
+
+    json expected = json::parse(R"({
+      "@context": {"@vocab": "http://example.com/vocab#"},
+      "@graph": [
+        {"@id": "_:b0", "city": "Springfield"},
+        {"@id": "http://example.com/people/dave", "address": {"@id": "_:b0"}, "name": "Dave"}
+      ]
+    })");
+    EXPECT_EQ(flattened, expected);
+}
+
+TEST(FlatteningProcessorTest, flatten_withDatasetMatchesToRDF) {
+    JsonLdOptions options(std::unique_ptr<DocumentLoader>(new FileLoader()));
+    RDF::RDFDataset dataset(options);
+    json flattened = JsonLdProcessor::flatten(resourceLocation("chunked-graph.jsonld"), json(), options, dataset);
+
+    JsonLdOptions toRdfOptions(std::unique_ptr<DocumentLoader>(new FileLoader()));
+    RDF::RDFDataset expected = JsonLdProcessor::toRDF(resourceLocation("chunked-graph.jsonld"), toRdfOptions);
+    EXPECT_EQ(NQuadsSerialization::toNQuads(dataset), NQuadsSerialization::toNQuads(expected));
+
+    // blank nodes are labeled the same in both outputs
+    EXPECT_EQ(flattened.at(0).at("@id"), "_:b0");
+    EXPECT_NE(NQuadsSerialization::toNQuads(dataset).find("_:b0 <http://example.com/vocab#name> \"Markus\" ."),
+              std::string::npos);
+}
+
+TEST(FlatteningProcessorTest, nodeMap_sharesBlankNodeNamesAcrossAdds) {
+    NodeMap nodeMap;
+    json first = json::parse(R"([{"@id": "_:x", "http://example.com/p": [{"@value": 1}]}])");
+    json second = json::parse(R"([{"@id": "_:x", "http://example.com/q": [{"@value": 2}]}])");
+    nodeMap.add(first);
+    nodeMap.add(second);
+
+    json flattened = FlatteningProcessor::flatten(nodeMap);
+    ASSERT_EQ(flattened.size(), 1);
+    EXPECT_EQ(flattened.at(0).at("@id"), "_:b0");
+    EXPECT_TRUE(flattened.at(0).contains("http://example.com/p"));
+    EXPECT_TRUE(flattened.at(0).contains("http://example.com/q"));
+}
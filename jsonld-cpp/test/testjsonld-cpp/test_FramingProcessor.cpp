@@ -0,0 +1,207 @@
+#pragma ide diagnostic ignored "cert-err58-cpp"
+#include <jsonld-cpp/detail/FramingProcessor.h>
+#include <jsonld-cpp/detail/Context.h>
+#include <jsonld-cpp/detail/ExpansionProcessor.h>
+#include <jsonld-cpp/detail/NodeMap.h>
+
+#include <jsonld-cpp/FileLoader.h>
+#include <jsonld-cpp/JsonLdError.h>
+#include <jsonld-cpp/JsonLdOptions.h>
+#include <jsonld-cpp/JsonLdProcessor.h>
+
+#include <gtest/gtest.h>
+#pragma clang diagnostic push
+#pragma GCC diagnostic push
+#pragma clang diagnostic ignored "-Weverything"
+#pragma GCC diagnostic ignored "-Wall"
+#pragma GCC diagnostic ignored "-Wextra"
+#include <rapidcheck/gtest.h>
+#pragma clang diagnostic pop
+#pragma GCC diagnostic pop
+
+using json = nlohmann::ordered_json;
+
+namespace {
+
+    std::string resourceLocation(const std::string & name) {
+        return "file://" + std::string(TEST_RESOURCE_DIR) + "test_data/frame/" + name;
+    }
+
+    const char LIBRARY_CONTEXT[] = R"({
+        "dc11": "http://purl.org/dc/elements/1.1/",
+        "@vocab": "http://example.org/vocab#"
+    })";
+
+    json frameLibrary(const std::string & frame, JsonLdOptions & options) {
+        json frameDocument = json::parse(frame);
+        frameDocument["@context"] = json::parse(LIBRARY_CONTEXT);
+        return JsonLdProcessor::frame(resourceLocation("library.jsonld"), frameDocument, options);
+    }
+
+    // an expanded document of count nodes with a few types and properties. Every fourth
+    // node links to a node without links, so embedding stays shallow.
+    json generateGraph(int count) {
+        const std::string ex = "http://example.org/";
+        auto nodeId = [&](int i) {
+            return i % 9 == 0 ? "_:b" + std::to_string(i) : ex + "node/" + std::to_string(i);
+        };
+        json graph = json::array();
+        for (int i = 0; i < count; i++) {
+            json node = json::object();
+            node["@id"] = nodeId(i);
+            if (i % 7 != 0) {
+                node["@type"] = json::array({ex + "T" + std::to_string(i % 5)});
+                if (i % 11 == 0)
+                    node["@type"].push_back(ex + "T5");
+            }
+            for (int k = 1; k <= 4; k++) {
+                if (i % (k + 1) == 0)
+                    node[ex + "p" + std::to_string(k)] = json::array({{{"@value", "v" + std::to_string(i % 3)}}});
+            }
+            if (i % 4 == 0)
+                node[ex + "link"] = json::array({{{"@id", nodeId(((i * 31 + 7) % (count / 4)) * 4 + 1)}}});
+            graph.push_back(node);
+        }
+        return graph;
+    }
+
+    json expandFrame(const std::string & frame) {
+        JsonLdOptions options;
+        options.setFrameExpansion(true);
+        json frameDocument = json::parse(frame);
+        frameDocument["@context"] = json::parse(R"({"@vocab": "http://example.org/"})");
+        json expandedFrame = ExpansionProcessor::expand(Context(options), nullptr, frameDocument, "");
+        return expandedFrame.is_null() ? json::array() : expandedFrame;
+    }
+
+}
+
+TEST(FramingProcessorTest, frame_embedsMatchingNodes) {
+    JsonLdOptions options(std::unique_ptr<DocumentLoader>(new FileLoader()));
+    json framed = frameLibrary(R"({
+        "@type": "Library",
+        "contains": {"@type": "Book", "contains": {"@type": "Chapter"}}
+    })", options);
+
+    json expected = json::parse(R"({
+      "@graph": [{
+        "@id": "http://example.org/library",
+        "@type": "Library",
+        "contains": {
+          "@id": "http://example.org/library/the-republic",
+          "@type": "Book",
+          "contains": {
+            "@id": "http://example.org/library/the-republic#introduction",
+            "@type": "Chapter",
+            "publisher": {"name": "Academy Press"},
+            "dc11:description": "An introductory chapter on The Republic.",
+            "dc11:title": "The Introduction"
+          },
+          "dc11:creator": "Plato",
+          "dc11:title": "The Republic"
+        }
+      }]
+    })");
+    expected["@context"] = json::parse(LIBRARY_CONTEXT);
+    EXPECT_EQ(framed.at("@graph"), expected.at("@graph"));
+    EXPECT_EQ(framed.at("@context"), expected.at("@context"));
+}
+
+TEST(FramingProcessorTest, frame_explicitWithDefaults) {
+    JsonLdOptions options(std::unique_ptr<DocumentLoader>(new FileLoader()));
+    options.setOmitGraph(true);
+    json framed = frameLibrary(R"({
+        "@type": "Book",
+        "@explicit": true,
+        "dc11:title": {},
+        "isbn": {"@default": "unknown"},
+        "price": {},
+        "contains": {"@embed": "@never"}
+    })", options);
+
+    EXPECT_FALSE(framed.contains("@graph"));
+    EXPECT_EQ(framed.at("@id"), "http://example.org/library/the-republic");
+    EXPECT_EQ(framed.at("dc11:title"), "The Republic");
+    EXPECT_EQ(framed.at("isbn"), "unknown");
+    EXPECT_TRUE(framed.at("price").is_null());
+    EXPECT_EQ(framed.at("contains"), json::parse(R"({"@id": "http://example.org/library/the-republic#introduction"})"));
+    EXPECT_FALSE(framed.contains("dc11:creator"));
+}
+
+TEST(FramingProcessorTest, frame_matchesOnIdAndProperties) {
+    JsonLdOptions options(std::unique_ptr<DocumentLoader>(new FileLoader()));
+    options.setOmitGraph(true);
+
+    json byId = frameLibrary(R"({"@id": "http://example.org/library/the-republic#introduction"})", options);
+    EXPECT_EQ(byId.at("@type"), "Chapter");
+
+    // only the book has a creator
+    json byProperty = frameLibrary(R"({"dc11:creator": {}})", options);
+    EXPECT_EQ(byProperty.at("@id"), "http://example.org/library/the-republic");
+
+    // both the book and the chapter have a title, but only the chapter is a Chapter
+    json allProperties = frameLibrary(R"({"@requireAll": true, "@type": "Chapter", "dc11:title": {}})", options);
+    EXPECT_EQ(allProperties.at("@id"), "http://example.org/library/the-republic#introduction");
+
+    // nodes without a title
+    json matchNone = frameLibrary(R"({"dc11:title": [], "@embed": "@never"})", options);
+    ASSERT_TRUE(matchNone.contains("@graph"));
+    EXPECT_EQ(matchNone.at("@graph").size(), 2u);
+}
+
+TEST(FramingProcessorTest, frame_prunesBlankNodeIdentifiersUsedOnce) {
+    JsonLdOptions options(std::unique_ptr<DocumentLoader>(new FileLoader()));
+    options.setOmitGraph(true);
+    json framed = frameLibrary(R"({"@type": "Chapter"})", options);
+
+    EXPECT_EQ(framed.at("publisher"), json::parse(R"({"name": "Academy Press"})"));
+}
+
+TEST(FramingProcessorTest, frame_rejectsInvalidEmbedValue) {
+    JsonLdOptions options(std::unique_ptr<DocumentLoader>(new FileLoader()));
+    try {
+        frameLibrary(R"({"@type": "Library", "@embed": "@sometimes"})", options);
+        FAIL() << "expected an invalid @embed value error";
+    }
+    catch (const JsonLdError & e) {
+        EXPECT_EQ(std::string(e.what()).find(JsonLdError::InvalidEmbedValue), 0u);
+    }
+}
+
+TEST(FramingProcessorTest, frame_indexedSelectionMatchesFullScan) {
+    json graph = generateGraph(2000);
+    NodeMap nodeMap;
+    nodeMap.add(graph);
+
+    const char * frames[] = {
+            R"({})",
+            R"({"@type": "T1"})",
+            R"({"@type": ["T1", "T5"]})",
+            R"({"@type": {}})",
+            R"({"@type": []})",
+            R"({"@id": ["http://example.org/node/5", "http://example.org/node/17", "_:b27", "http://example.org/none"]})",
+            R"({"p1": {}})",
+            R"({"p1": {}, "p4": {}})",
+            R"({"p3": {"@value": "v1"}})",
+            R"({"p3": []})",
+            R"({"p1": {"@default": "x"}})",
+            R"({"@requireAll": true, "@type": "T2", "p1": {}, "p2": {}})",
+            R"({"@requireAll": true, "@id": ["http://example.org/node/6", "http://example.org/node/8"], "p1": {}})",
+            R"({"@type": "T1", "link": {"@type": "T1"}})",
+            R"({"@type": "T4", "@embed": "@never"})",
+            R"({"@type": "T1", "@reverse": {"link": {}}})"
+    };
+
+    JsonLdOptions options;
+    for (const char * frame : frames) {
+        json expandedFrame = expandFrame(frame);
+        for (bool merged : {false, true}) {
+            json indexed = FramingProcessor::frame(nodeMap, expandedFrame, options, merged,
+                                                   FramingProcessor::NodeSelection::Indexed);
+            json fullScan = FramingProcessor::frame(nodeMap, expandedFrame, options, merged,
+                                                    FramingProcessor::NodeSelection::FullScan);
+            EXPECT_EQ(indexed, fullScan) << frame << (merged ? " (merged)" : "");
+            EXPECT_FALSE(indexed.empty()) << frame;
+        }
+    }
+}
@@ -0,0 +1,246 @@
+#pragma ide diagnostic ignored "cert-err58-cpp"
+#include <jsonld-cpp/JsonLdProcessor.h>
+
+#include <jsonld-cpp/JsonLdError.h>
+#include <jsonld-cpp/RemoteDocument.h>
+
+#include "ManifestLoader.h"
+
+#include <gtest/gtest.h>
+#pragma clang diagnostic push
+#pragma GCC diagnostic push
+#pragma clang diagnostic ignored "-Weverything"
+#pragma GCC diagnostic ignored "-Wall"
+#pragma GCC diagnostic ignored "-Wextra"
+#include <rapidcheck/gtest.h>
+#pragma clang diagnostic pop
+#pragma GCC diagnostic pop
+
+
+// test suite fixture class
+class JsonLdProcessorCompactTest : public ::testing::Test {
+public:
+    static void SetUpTestCase() {
+        std::string resource_dir = TEST_RESOURCE_DIR;
+        ManifestLoader manifestLoader(
+                resource_dir + "test_data/",
+                mainManifestName);
+        testCases = manifestLoader.load();
+    }
+
+    // resources shared by all tests.
+    static std::string mainManifestName;
+    static std::map<std::string, TestCase> testCases;
+
+    static void performCompactTest(TestCase &testCase) {
+        JsonLdOptions options = testCase.getOptions();
+
+        // set ordered so results are easier to compare
+        options.setOrdered(true);
+
+        std::cout << "Id: " << testCase.id << std::endl;
+        std::cout << "Name: " << testCase.name << std::endl;
+        if(!testCase.options.specVersion.empty())
+            std::cout << "SpecVersion: " << testCase.options.specVersion;
+        if(testCase.options.specVersion == "json-ld-1.1") {
+            std::cout << std::endl << std::endl;
+        }
+        else if(testCase.options.specVersion == "json-ld-1.0") {
+            std::cout << " ...skipping for now." << std::endl;
+            GTEST_SKIP();
+        }
+        else
+            std::cout << std::endl;
+
+        nlohmann::ordered_json compacted;
+        try {
+            std::unique_ptr<RemoteDocument> contextDocument =
+                    options.getDocumentLoader()->loadDocument(testCase.context);
+            compacted = JsonLdProcessor::compact(testCase.input, contextDocument->getJSONContent(), options);
+        }
+        catch (JsonLdError &e) {
+            std::cout << "JsonLdError: " << e.what() << std::endl;
+            if(testCase.type.count("jld:NegativeEvaluationTest")) {
+                std::string error = e.what();
+                if(error.find(testCase.expectErrorCode) != std::string::npos) {
+                    SUCCEED();
+                    return;
+                }
+            }
+            FAIL() << e.what();
+        }
+        catch (std::runtime_error &e) {
+            FAIL() << e.what();
+        }
+
+        if(testCase.type.count("jld:NegativeEvaluationTest")) {
+            FAIL() << "We should have failed with the following error: " + testCase.expectErrorCode;
+        }
+
+        std::unique_ptr<RemoteDocument> expectedDocument =
+                options.getDocumentLoader()->loadDocument(testCase.expect);
+
+        const nlohmann::ordered_json& expected = expectedDocument->getJSONContent();
+
+        // Note: The ordered_json object that JsonLdProcessor::compact() returns will not be easily comparable
+        // unless we convert it to a regular json object so the elements are sorted lexicographically.
+        const nlohmann::json compactedSorted = compacted;
+        const nlohmann::json expectedSorted = expected;
+
+        EXPECT_TRUE(compactedSorted == expectedSorted);
+        std::cout << "  Actual basic JSON: " << compactedSorted.dump() << std::endl;
+        std::cout << "Expected basic JSON: " << expectedSorted.dump() << std::endl;
+    }
+
+    static void performCompactTestFromManifest(const std::string& testName) {
+
+        auto testCase = testCases.at(testName);
+
+        performCompactTest(testCase);
+    }
+
+};
+
+std::string JsonLdProcessorCompactTest::mainManifestName = "compact-manifest.jsonld";
+std::map<std::string, TestCase> JsonLdProcessorCompactTest::testCases;
+
+
+TEST_F(JsonLdProcessorCompactTest, compact_t0001) {
+    performCompactTestFromManifest("#t0001");
+}
+
+TEST_F(JsonLdProcessorCompactTest, compact_t0002) {
+    performCompactTestFromManifest("#t0002");
+}
+
+TEST_F(JsonLdProcessorCompactTest, compact_t0003) {
+    performCompactTestFromManifest("#t0003");
+}
+
+TEST_F(JsonLdProcessorCompactTest, compact_t0004) {
+    performCompactTestFromManifest("#t0004");
+}
+
+TEST_F(JsonLdProcessorCompactTest, compact_t0005) {
+    performCompactTestFromManifest("#t0005");
+}
+
+TEST_F(JsonLdProcessorCompactTest, compact_t0006) {
+    performCompactTestFromManifest("#t0006");
+}
+
+TEST_F(JsonLdProcessorCompactTest, compact_t0007) {
+    performCompactTestFromManifest("#t0007");
+}
+
+TEST_F(JsonLdProcessorCompactTest, compact_t0008) {
+    performCompactTestFromManifest("#t0008");
+}
+
+TEST_F(JsonLdProcessorCompactTest, compact_t0009) {
+    performCompactTestFromManifest("#t0009");
+}
+
+TEST_F(JsonLdProcessorCompactTest, compact_t0010) {
+    performCompactTestFromManifest("#t0010");
+}
+
+TEST_F(JsonLdProcessorCompactTest, compact_t0011) {
+    performCompactTestFromManifest("#t0011");
+}
+
+TEST_F(JsonLdProcessorCompactTest, compact_t0012) {
+    performCompactTestFromManifest("#t0012");
+}
+
+TEST_F(JsonLdProcessorCompactTest, compact_t0013) {
+    performCompactTestFromManifest("#t0013");
+}
+
+TEST_F(JsonLdProcessorCompactTest, compact_t0014) {
+    performCompactTestFromManifest("#t0014");
+}
+
+TEST_F(JsonLdProcessorCompactTest, compact_t0015) {
+    performCompactTestFromManifest("#t0015");
+}
+
+TEST_F(JsonLdProcessorCompactTest, compact_t0016) {
+    performCompactTestFromManifest("#t0016");
+}
+
+TEST_F(JsonLdProcessorCompactTest, compact_t0017) {
+    performCompactTestFromManifest("#t0017");
+}
+
+TEST_F(JsonLdProcessorCompactTest, compact_t0018) {
+    performCompactTestFromManifest("#t0018");
+}
+
+TEST_F(JsonLdProcessorCompactTest, compact_t0019) {
+    performCompactTestFromManifest("#t0019");
+}
+
+TEST_F(JsonLdProcessorCompactTest, compact_t0020) {
+    performCompactTestFromManifest("#t0020");
+}
+
+TEST_F(JsonLdProcessorCompactTest, compact_t0021) {
+    performCompactTestFromManifest("#t0021");
+}
+
+TEST_F(JsonLdProcessorCompactTest, compact_t0022) {
+    performCompactTestFromManifest("#t0022");
+}
+
+TEST_F(JsonLdProcessorCompactTest, compact_t0023) {
+    performCompactTestFromManifest("#t0023");
+}
+
+TEST_F(JsonLdProcessorCompactTest, compact_t0024) {
+    performCompactTestFromManifest("#t0024");
+}
+
+TEST_F(JsonLdProcessorCompactTest, compact_t0025) {
+    performCompactTestFromManifest("#t0025");
+}
+
+TEST_F(JsonLdProcessorCompactTest, compact_t0026) {
+    performCompactTestFromManifest("#t0026");
+}
+
+TEST_F(JsonLdProcessorCompactTest, compact_t0027) {
+    performCompactTestFromManifest("#t0027");
+}
+
+TEST_F(JsonLdProcessorCompactTest, compact_t0028) {
+    performCompactTestFromManifest("#t0028");
+}
+
+TEST_F(JsonLdProcessorCompactTest, compact_t0029) {
+    performCompactTestFromManifest("#t0029");
+}
+
+TEST_F(JsonLdProcessorCompactTest, compact_t0030) {
+    performCompactTestFromManifest("#t0030");
+}
+
+TEST_F(JsonLdProcessorCompactTest, compact_t0031) {
+    performCompactTestFromManifest("#t0031");
+}
+
+TEST_F(JsonLdProcessorCompactTest, compact_t0032) {
+    performCompactTestFromManifest("#t0032");
+}
+
+TEST_F(JsonLdProcessorCompactTest, compact_t0033) {
+    performCompactTestFromManifest("#t0033");
+}
+
+TEST_F(JsonLdProcessorCompactTest, compact_t0034) {
+    performCompactTestFromManifest("#t0034");
+}
+
+TEST_F(JsonLdProcessorCompactTest, compact_t0035) {
+    performCompactTestFromManifest("#t0035");
+}
@@ -0,0 +1,238 @@
+#pragma ide diagnostic ignored "cert-err58-cpp"
+#include <jsonld-cpp/JsonLdProcessor.h>
+
+#include <jsonld-cpp/JsonLdError.h>
+#include <jsonld-cpp/RemoteDocument.h>
+
+#include "ManifestLoader.h"
+
+#include <gtest/gtest.h>
+#pragma clang diagnostic push
+#pragma GCC diagnostic push
+#pragma clang diagnostic ignored "-Weverything"
+#pragma GCC diagnostic ignored "-Wall"
+#pragma GCC diagnostic ignored "-Wextra"
+#include <rapidcheck/gtest.h>
+#pragma clang diagnostic pop
+#pragma GCC diagnostic pop
+
+
+// test suite fixture class
+class JsonLdProcessorFrameTest : public ::testing::Test {
+public:
+    static void SetUpTestCase() {
+        std::string resource_dir = TEST_RESOURCE_DIR;
+        ManifestLoader manifestLoader(
+                resource_dir + "test_data/",
+                mainManifestName);
+        testCases = manifestLoader.load();
+    }
+
+    // resources shared by all tests.
+    static std::string mainManifestName;
+    static std::map<std::string, TestCase> testCases;
+
+    static void performFrameTest(TestCase &testCase) {
+        JsonLdOptions options = testCase.getOptions();
+
+        // set ordered so results are easier to compare
+        options.setOrdered(true);
+
+        std::cout << "Id: " << testCase.id << std::endl;
+        std::cout << "Name: " << testCase.name << std::endl;
+        if(!testCase.options.specVersion.empty())
+            std::cout << "SpecVersion: " << testCase.options.specVersion;
+        if(testCase.options.specVersion == "json-ld-1.1") {
+            std::cout << std::endl << std::endl;
+        }
+        else if(testCase.options.specVersion == "json-ld-1.0") {
+            std::cout << " ...skipping for now." << std::endl;
+            GTEST_SKIP();
+        }
+        else
+            std::cout << std::endl;
+
+        nlohmann::ordered_json framed;
+        try {
+            std::unique_ptr<RemoteDocument> frameDocument =
+                    options.getDocumentLoader()->loadDocument(testCase.frame);
+            framed = JsonLdProcessor::frame(testCase.input, frameDocument->getJSONContent(), options);
+        }
+        catch (JsonLdError &e) {
+            std::cout << "JsonLdError: " << e.what() << std::endl;
+            if(testCase.type.count("jld:NegativeEvaluationTest")) {
+                std::string error = e.what();
+                if(error.find(testCase.expectErrorCode) != std::string::npos) {
+                    SUCCEED();
+                    return;
+                }
+            }
+            FAIL() << e.what();
+        }
+        catch (std::runtime_error &e) {
+            FAIL() << e.what();
+        }
+
+        if(testCase.type.count("jld:NegativeEvaluationTest")) {
+            FAIL() << "We should have failed with the following error: " + testCase.expectErrorCode;
+        }
+
+        std::unique_ptr<RemoteDocument> expectedDocument =
+                options.getDocumentLoader()->loadDocument(testCase.expect);
+
+        const nlohmann::ordered_json& expected = expectedDocument->getJSONContent();
+
+        // Note: The ordered_json object that JsonLdProcessor::frame() returns will not be easily comparable
+        // unless we convert it to a regular json object so the elements are sorted lexicographically.
+        const nlohmann::json framedSorted = framed;
+        const nlohmann::json expectedSorted = expected;
+
+        EXPECT_TRUE(framedSorted == expectedSorted);
+        std::cout << "  Actual basic JSON: " << framedSorted.dump() << std::endl;
+        std::cout << "Expected basic JSON: " << expectedSorted.dump() << std::endl;
+    }
+
+    static void performFrameTestFromManifest(const std::string& testName) {
+
+        auto testCase = testCases.at(testName);
+
+        performFrameTest(testCase);
+    }
+
+};
+
+std::string JsonLdProcessorFrameTest::mainManifestName = "frame-manifest.jsonld";
+std::map<std::string, TestCase> JsonLdProcessorFrameTest::testCases;
+
+
+TEST_F(JsonLdProcessorFrameTest, frame_t0001) {
+    performFrameTestFromManifest("#t0001");
+}
+
+TEST_F(JsonLdProcessorFrameTest, frame_t0002) {
+    performFrameTestFromManifest("#t0002");
+}
+
+TEST_F(JsonLdProcessorFrameTest, frame_t0003) {
+    performFrameTestFromManifest("#t0003");
+}
+
+TEST_F(JsonLdProcessorFrameTest, frame_t0004) {
+    performFrameTestFromManifest("#t0004");
+}
+
+TEST_F(JsonLdProcessorFrameTest, frame_t0005) {
+    performFrameTestFromManifest("#t0005");
+}
+
+TEST_F(JsonLdProcessorFrameTest, frame_t0006) {
+    performFrameTestFromManifest("#t0006");
+}
+
+TEST_F(JsonLdProcessorFrameTest, frame_t0007) {
+    performFrameTestFromManifest("#t0007");
+}
+
+TEST_F(JsonLdProcessorFrameTest, frame_t0008) {
+    performFrameTestFromManifest("#t0008");
+}
+
+TEST_F(JsonLdProcessorFrameTest, frame_t0009) {
+    performFrameTestFromManifest("#t0009");
+}
+
+TEST_F(JsonLdProcessorFrameTest, frame_t0010) {
+    performFrameTestFromManifest("#t0010");
+}
+
+TEST_F(JsonLdProcessorFrameTest, frame_t0011) {
+    performFrameTestFromManifest("#t0011");
+}
+
+TEST_F(JsonLdProcessorFrameTest, frame_t0012) {
+    performFrameTestFromManifest("#t0012");
+}
+
+TEST_F(JsonLdProcessorFrameTest, frame_t0013) {
+    performFrameTestFromManifest("#t0013");
+}
+
+TEST_F(JsonLdProcessorFrameTest, frame_t0014) {
+    performFrameTestFromManifest("#t0014");
+}
+
+TEST_F(JsonLdProcessorFrameTest, frame_t0015) {
+    performFrameTestFromManifest("#t0015");
+}
+
+TEST_F(JsonLdProcessorFrameTest, frame_t0016) {
+    performFrameTestFromManifest("#t0016");
+}
+
+TEST_F(JsonLdProcessorFrameTest, frame_t0017) {
+    performFrameTestFromManifest("#t0017");
+}
+
+TEST_F(JsonLdProcessorFrameTest, frame_t0018) {
+    performFrameTestFromManifest("#t0018");
+}
+
+TEST_F(JsonLdProcessorFrameTest, frame_t0019) {
+    performFrameTestFromManifest("#t0019");
+}
+
+TEST_F(JsonLdProcessorFrameTest, frame_t0020) {
+    performFrameTestFromManifest("#t0020");
+}
+
+TEST_F(JsonLdProcessorFrameTest, frame_t0021) {
+    performFrameTestFromManifest("#t0021");
+}
+
+TEST_F(JsonLdProcessorFrameTest, frame_t0022) {
+    performFrameTestFromManifest("#t0022");
+}
+
+TEST_F(JsonLdProcessorFrameTest, frame_t0023) {
+    performFrameTestFromManifest("#t0023");
+}
+
+TEST_F(JsonLdProcessorFrameTest, frame_t0024) {
+    performFrameTestFromManifest("#t0024");
+}
+
+TEST_F(JsonLdProcessorFrameTest, frame_t0025) {
+    performFrameTestFromManifest("#t0025");
+}
+
+TEST_F(JsonLdProcessorFrameTest, frame_t0026) {
+    performFrameTestFromManifest("#t0026");
+}
+
+TEST_F(JsonLdProcessorFrameTest, frame_t0027) {
+    performFrameTestFromManifest("#t0027");
+}
+
+TEST_F(JsonLdProcessorFrameTest, frame_t0028) {
+    performFrameTestFromManifest("#t0028");
+}
+
+TEST_F(JsonLdProcessorFrameTest, frame_t0029) {
+    performFrameTestFromManifest("#t0029");
+}
+
+TEST_F(JsonLdProcessorFrameTest, frame_t0030) {
+    performFrameTestFromManifest("#t0030");
+}
+
+TEST_F(JsonLdProcessorFrameTest, frame_t0031) {
+    performFrameTestFromManifest("#t0031");
+}
+
+TEST_F(JsonLdProcessorFrameTest, frame_t0032) {
+    performFrameTestFromManifest("#t0032");
+}
+
+TEST_F(JsonLdProcessorFrameTest, frame_t0033) {
+    performFrameTestFromManifest("#t0033");
+}
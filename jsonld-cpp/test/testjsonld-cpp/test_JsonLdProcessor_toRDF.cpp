@@ -3,8 +3,14 @@
 
 #include <jsonld-cpp/JsonLdError.h>
 #include <jsonld-cpp/RemoteDocument.h>
+#include <jsonld-cpp/FileLoader.h>
+#include <jsonld-cpp/RDFDataset.h>
+#include <jsonld-cpp/RDFQuad.h>
+#include <jsonld-cpp/QuadSink.h>
+#include <jsonld-cpp/NQuadsSerialization.h>
+#include <jsonld-cpp/RDFDatasetComparison.h>
+#include <jsonld-cpp/detail/RDFSerializationProcessor.h>
 
-#include "RDFDatasetComparison.h"
 #include "ManifestLoader.h"
 
 #include <gtest/gtest.h>
@@ -2000,3 +2006,132 @@ TEST_F(JsonLdProcessorToRDFTest, DISABLED_toRdf_with_manifest) {
     }
 
 }
+
+TEST_F(JsonLdProcessorToRDFTest, toRdf_chunked_matches_dataset) {
+    // converting in chunks and collecting the emitted quads must produce the same
+    // dataset as the normal, fully materialized, conversion
+
+    std::string resource_dir = TEST_RESOURCE_DIR;
+    std::string documentLocation = "file://" + resource_dir + "test_data/chunked-graph.jsonld";
+
+    JsonLdOptions options(std::unique_ptr<DocumentLoader>(new FileLoader()));
+    RDF::RDFDataset expected = JsonLdProcessor::toRDF(documentLocation, options);
+
+    for(std::size_t chunkSize : {0, 1, 2, 4, 100}) {
+        JsonLdOptions chunkedOptions(std::unique_ptr<DocumentLoader>(new FileLoader()));
+        chunkedOptions.setRdfChunkSize(chunkSize);
+
+        RDF::RDFDataset actual(chunkedOptions);
+        std::size_t numQuads = 0;
+        JsonLdProcessor::toRDF(documentLocation, chunkedOptions, [&](const RDF::RDFQuad & quad) {
+            std::string graphName = quad.getGraph() ? quad.getGraph()->getValue() : JsonLdConsts::DEFAULT;
+            actual.addTripleToGraph(graphName, RDF::RDFTriple(quad.getSubject(), quad.getPredicate(), quad.getObject()));
+            numQuads++;
+        });
+
+        EXPECT_EQ(expected.numTriples(), numQuads) << "chunk size " << chunkSize;
+        EXPECT_TRUE(areIsomorphic(actual, expected)) << "chunk size " << chunkSize;
+    }
+}
+
+namespace {
+
+    // QuadSink that writes each quad it receives as an N-Quad line
+    class NQuadsCollectingSink : public RDF::QuadSink {
+    public:
+        std::vector<std::string> lines;
+
+        void onQuad(const RDF::QuadTerm & subject, const RDF::QuadTerm & predicate,
+                    const RDF::QuadTerm & object, const RDF::QuadTerm * graph) override {
+            std::string graphName = graph ? graph->getValue() : JsonLdConsts::DEFAULT;
+            RDF::RDFQuad quad(toNode(subject), toNode(predicate), toNode(object), &graphName);
+            lines.push_back(NQuadsSerialization::toNQuad(quad));
+        }
+
+    private:
+        static std::shared_ptr<RDF::Node> toNode(const RDF::QuadTerm & term) {
+            if(term.isIRI())
+                return std::make_shared<RDF::IRI>(term.getValue());
+            if(term.isBlankNode())
+                return std::make_shared<RDF::BlankNode>(term.getValue());
+            std::string datatype = term.getDatatype();
+            std::string language = term.getLanguage();
+            return std::make_shared<RDF::Literal>(term.getValue(), &datatype, &language);
+        }
+    };
+
+}
+
+TEST_F(JsonLdProcessorToRDFTest, toRdf_quadSink_matches_dataset) {
+    // the quads passed to a QuadSink must be exactly the quads of the materialized dataset,
+    // including blank node labels
+
+    std::string resource_dir = TEST_RESOURCE_DIR;
+    std::string documentLocation = "file://" + resource_dir + "test_data/chunked-graph.jsonld";
+
+    JsonLdOptions options(std::unique_ptr<DocumentLoader>(new FileLoader()));
+    RDF::RDFDataset expected = JsonLdProcessor::toRDF(documentLocation, options);
+
+    JsonLdOptions sinkOptions(std::unique_ptr<DocumentLoader>(new FileLoader()));
+    NQuadsCollectingSink sink;
+    JsonLdProcessor::toRDF(documentLocation, sinkOptions, sink);
+
+    std::sort(sink.lines.begin(), sink.lines.end());
+    std::string actual;
+    for(const auto & line : sink.lines)
+        actual += line;
+
+    EXPECT_EQ(NQuadsSerialization::toNQuads(expected), actual);
+}
+
+TEST_F(JsonLdProcessorToRDFTest, toRdf_threads_matches_dataset) {
+    // generating triples on several threads must produce exactly the quads, including
+    // blank node labels, and the order of a conversion on a single thread
+
+    std::string resource_dir = TEST_RESOURCE_DIR;
+    std::string documentLocation = "file://" + resource_dir + "test_data/chunked-graph.jsonld";
+
+    JsonLdOptions options(std::unique_ptr<DocumentLoader>(new FileLoader()));
+    RDF::RDFDataset expected = JsonLdProcessor::toRDF(documentLocation, options);
+    NQuadsCollectingSink expectedSink;
+    JsonLdProcessor::toRDF(documentLocation, options, expectedSink);
+
+    for(std::size_t numThreads : {2, 3, 8}) {
+        JsonLdOptions threadedOptions(std::unique_ptr<DocumentLoader>(new FileLoader()));
+        threadedOptions.setRdfThreads(numThreads);
+
+        RDF::RDFDataset actual = JsonLdProcessor::toRDF(documentLocation, threadedOptions);
+        EXPECT_EQ(NQuadsSerialization::toNQuads(expected), NQuadsSerialization::toNQuads(actual))
+                            << numThreads << " threads";
+
+        NQuadsCollectingSink sink;
+        JsonLdProcessor::toRDF(documentLocation, threadedOptions, sink);
+        EXPECT_EQ(expectedSink.lines, sink.lines) << numThreads << " threads";
+    }
+}
+
+TEST_F(JsonLdProcessorToRDFTest, toRdf_generatedBlankNodes_followNodeMapLabels) {
+    // blank nodes generated for (nested) lists are numbered after the ones issued while
+    // generating the node map, in the order the List to RDF algorithm creates them
+
+    nlohmann::ordered_json expanded = nlohmann::ordered_json::parse(R"([{
+        "@id": "_:x",
+        "http://example.com/p": [{"@list": [{"@value": "a"}, {"@list": [{"@value": "b"}]}]}]
+    }])");
+
+    std::string expected =
+            "_:b0 <http://example.com/p> _:b1 .\n"
+            "_:b1 <http://www.w3.org/1999/02/22-rdf-syntax-ns#first> \"a\" .\n"
+            "_:b1 <http://www.w3.org/1999/02/22-rdf-syntax-ns#rest> _:b2 .\n"
+            "_:b2 <http://www.w3.org/1999/02/22-rdf-syntax-ns#first> _:b3 .\n"
+            "_:b2 <http://www.w3.org/1999/02/22-rdf-syntax-ns#rest> <http://www.w3.org/1999/02/22-rdf-syntax-ns#nil> .\n"
+            "_:b3 <http://www.w3.org/1999/02/22-rdf-syntax-ns#first> \"b\" .\n"
+            "_:b3 <http://www.w3.org/1999/02/22-rdf-syntax-ns#rest> <http://www.w3.org/1999/02/22-rdf-syntax-ns#nil> .\n";
+
+    for(std::size_t numThreads : {1, 2}) {
+        JsonLdOptions options;
+        options.setRdfThreads(numThreads);
+        RDF::RDFDataset dataset = RDFSerializationProcessor::toRDF(expanded, options);
+        EXPECT_EQ(NQuadsSerialization::toNQuads(dataset), expected) << numThreads << " threads";
+    }
+}
@@ -34,3 +34,34 @@ TEST(JsonLdUrlTest, resolve_null_args) {
 
     EXPECT_TRUE(result.empty());
 }
+
+TEST(JsonLdUrlTest, removeBase) {
+
+    std::string base = "http://a/b/c/d;p?q";
+
+    EXPECT_EQ(JsonLdUrl::removeBase(base, "http://a/b/c/g"), "g");
+    EXPECT_EQ(JsonLdUrl::removeBase(base, "http://a/b/c/g/"), "g/");
+    EXPECT_EQ(JsonLdUrl::removeBase(base, "http://a/b/g"), "../g");
+    EXPECT_EQ(JsonLdUrl::removeBase(base, "http://a/g"), "../../g");
+    EXPECT_EQ(JsonLdUrl::removeBase(base, "http://a/b/c/"), "./");
+    EXPECT_EQ(JsonLdUrl::removeBase(base, "http://a/b/c/d;p?y"), "?y");
+    EXPECT_EQ(JsonLdUrl::removeBase(base, "http://a/b/c/d;p?q#s"), "#s");
+    EXPECT_EQ(JsonLdUrl::removeBase(base, "http://a/b/c/d;p"), "d;p");
+    EXPECT_EQ(JsonLdUrl::removeBase(base, "http://a/b/c/g:h"), "./g:h");
+    EXPECT_EQ(JsonLdUrl::removeBase(base, "https://a/b/c/g"), "https://a/b/c/g");
+    EXPECT_EQ(JsonLdUrl::removeBase(base, "http://x/b/c/g"), "http://x/b/c/g");
+    EXPECT_EQ(JsonLdUrl::removeBase(base, "_:b0"), "_:b0");
+    EXPECT_EQ(JsonLdUrl::removeBase("", "http://a/b"), "http://a/b");
+}
+
+TEST(JsonLdUrlTest, removeBase_resolvesBackToIri) {
+
+    std::string base = "http://a/b/c/d;p?q";
+
+    for (const std::string iri : {"http://a/b/c/g", "http://a/b/c/g?y#s", "http://a/b/g", "http://a/",
+                                  "http://a/b/c/d;p?q", "http://a/b/c/d;p", "http://a/b/c/d;p#s",
+                                  "http://a/b/c/", "http://a/b/c/g:h", "http://a/x/y/z"}) {
+        std::string relative = JsonLdUrl::removeBase(base, iri);
+        EXPECT_EQ(JsonLdUrl::resolve(&base, &relative), iri) << relative;
+    }
+}
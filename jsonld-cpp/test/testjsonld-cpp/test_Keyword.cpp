@@ -0,0 +1,39 @@
+#pragma ide diagnostic ignored "cert-err58-cpp"
+#include <jsonld-cpp/detail/Keyword.h>
+
+#include <jsonld-cpp/JsonLdConsts.h>
+
+#include <gtest/gtest.h>
+#pragma clang diagnostic push
+#pragma GCC diagnostic push
+#pragma clang diagnostic ignored "-Weverything"
+#pragma GCC diagnostic ignored "-Wall"
+#pragma GCC diagnostic ignored "-Wextra"
+#include <rapidcheck/gtest.h>
+#pragma clang diagnostic pop
+#pragma GCC diagnostic pop
+
+TEST(KeywordTest, classify_everyKeywordRoundTrips) {
+    for (int i = static_cast<int>(Keyword::Any); i <= static_cast<int>(Keyword::Vocab); i++) {
+        auto keyword = static_cast<Keyword>(i);
+        EXPECT_EQ(Keywords::classify(Keywords::name(keyword)), keyword) << Keywords::name(keyword);
+    }
+}
+
+TEST(KeywordTest, classify_knownKeywords) {
+    EXPECT_EQ(Keywords::classify(JsonLdConsts::ID), Keyword::Id);
+    EXPECT_EQ(Keywords::classify(JsonLdConsts::TYPE), Keyword::Type);
+    EXPECT_EQ(Keywords::classify(JsonLdConsts::OMIT_DEFAULT), Keyword::OmitDefault);
+    EXPECT_EQ(Keywords::classify("@once"), Keyword::Once);
+}
+
+TEST(KeywordTest, classify_nonKeywords) {
+    EXPECT_EQ(Keywords::classify(""), Keyword::NotAKeyword);
+    EXPECT_EQ(Keywords::classify("@"), Keyword::NotAKeyword);
+    EXPECT_EQ(Keywords::classify("id"), Keyword::NotAKeyword);
+    EXPECT_EQ(Keywords::classify("@ID"), Keyword::NotAKeyword);
+    EXPECT_EQ(Keywords::classify("@idx"), Keyword::NotAKeyword);
+    EXPECT_EQ(Keywords::classify("@ignoreMe"), Keyword::NotAKeyword);
+    EXPECT_EQ(Keywords::classify("http://example.com/@id"), Keyword::NotAKeyword);
+    EXPECT_EQ(Keywords::name(Keyword::NotAKeyword), std::string());
+}
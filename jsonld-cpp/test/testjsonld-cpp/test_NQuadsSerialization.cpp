@@ -1,5 +1,7 @@
 #pragma ide diagnostic ignored "cert-err58-cpp"
 #include "jsonld-cpp/NQuadsSerialization.h"
+#include "jsonld-cpp/JsonLdOptions.h"
+#include "jsonld-cpp/RDFDataset.h"
 
 #include <gtest/gtest.h>
 #pragma clang diagnostic push
@@ -131,3 +133,25 @@ TEST(RegexTest, unescape_slashes_lots) {
     std::string result = NQuadsSerialization::unescape(str);
     EXPECT_EQ("B\"\\\\\"/\"", result);
 }
+
+TEST(NQuadsSerializationTest, toNQuads_quadOrdering) {
+    std::string input =
+            "_:x <http://example.com/p> \"b\" .\n"
+            "<http://example.com/s> <http://example.com/p> _:x .\n";
+    RDFDataset dataset = NQuadsSerialization::parse(input);
+
+    JsonLdOptions options;
+    options.setQuadOrdering(QuadOrdering::Insertion);
+    EXPECT_EQ(NQuadsSerialization::toNQuads(dataset, options), input);
+
+    options.setQuadOrdering(QuadOrdering::Sorted);
+    EXPECT_EQ(NQuadsSerialization::toNQuads(dataset, options),
+              "<http://example.com/s> <http://example.com/p> _:x .\n"
+              "_:x <http://example.com/p> \"b\" .\n");
+    EXPECT_EQ(NQuadsSerialization::toNQuads(dataset, options), NQuadsSerialization::toNQuads(dataset));
+
+    options.setQuadOrdering(QuadOrdering::Canonical);
+    EXPECT_EQ(NQuadsSerialization::toNQuads(dataset, options),
+              "<http://example.com/s> <http://example.com/p> _:c14n0 .\n"
+              "_:c14n0 <http://example.com/p> \"b\" .\n");
+}
@@ -0,0 +1,209 @@
+#pragma ide diagnostic ignored "cert-err58-cpp"
+#include <jsonld-cpp/ProcessingStats.h>
+
+#include <chrono>
+#include <map>
+#include <sstream>
+#include <thread>
+
+#include <jsonld-cpp/DocumentLoader.h>
+#include <jsonld-cpp/JSONDocument.h>
+#include <jsonld-cpp/JsonLdOptions.h>
+#include <jsonld-cpp/JsonLdProcessor.h>
+#include <jsonld-cpp/MediaType.h>
+#include <jsonld-cpp/RDFDataset.h>
+#include <jsonld-cpp/ResultCache.h>
+
+#include <gtest/gtest.h>
+#pragma clang diagnostic push
+#pragma GCC diagnostic push
+#pragma clang diagnostic ignored "-Weverything"
+#pragma GCC diagnostic ignored "-Wall"
+#pragma GCC diagnostic ignored "-Wextra"
+#include <rapidcheck/gtest.h>
+#pragma clang diagnostic pop
+#pragma GCC diagnostic pop
+
+using json = nlohmann::ordered_json;
+
+namespace {
+
+    // Loads documents from a map shared by its copies
+    class MemoryLoader : public DocumentLoader {
+    public:
+        std::shared_ptr<std::map<std::string, json>> documents;
+
+        MemoryLoader()
+                : documents(std::make_shared<std::map<std::string, json>>()) {
+        }
+
+        MemoryLoader * clone() const override {
+            return new MemoryLoader(*this);
+        }
+
+        std::unique_ptr<RemoteDocument> loadDocument(const std::string &url) override {
+            std::stringstream in(documents->at(url).dump());
+            return std::unique_ptr<RemoteDocument>(
+                    new JSONDocument(JSONDocument::of(MediaType::json_ld(), in, url)));
+        }
+    };
+
+    const char DOCUMENT[] = "http://example.com/doc.jsonld";
+    const char CONTEXT[] = "http://example.com/context.jsonld";
+
+    JsonLdOptions makeOptions(const MemoryLoader & loader, const std::shared_ptr<ProcessingStats> & stats) {
+        JsonLdOptions options(std::unique_ptr<DocumentLoader>(loader.clone()));
+        options.setProcessingStats(stats);
+        return options;
+    }
+
+}
+
+TEST(ProcessingStatsTest, phaseTimer_nestedTimerPausesOuterTimer) {
+    ProcessingStats stats;
+    {
+        ProcessingStats::PhaseTimer outer(&stats, ProcessingStats::Phase::ContextProcessing);
+        ProcessingStats::PhaseTimer inner(&stats, ProcessingStats::Phase::DocumentLoading);
+        std::this_thread::sleep_for(std::chrono::milliseconds(20));
+    }
+
+    EXPECT_GE(stats.getTime(ProcessingStats::Phase::DocumentLoading), std::chrono::milliseconds(20));
+    EXPECT_LT(stats.getTime(ProcessingStats::Phase::ContextProcessing), std::chrono::milliseconds(20));
+    EXPECT_EQ(stats.getTotalTime(), stats.getTime(ProcessingStats::Phase::DocumentLoading) +
+                                    stats.getTime(ProcessingStats::Phase::ContextProcessing));
+
+    // a timer without stats measures nothing
+    {
+        ProcessingStats::PhaseTimer timer(nullptr, ProcessingStats::Phase::Expansion);
+    }
+    EXPECT_EQ(stats.getTime(ProcessingStats::Phase::Expansion).count(), 0);
+
+    stats.clear();
+    EXPECT_EQ(stats.getTotalTime().count(), 0);
+}
+
+TEST(ProcessingStatsTest, toRDF_countsWorkOfEachPhase) {
+    MemoryLoader loader;
+    (*loader.documents)[CONTEXT] = json::parse(R"({"@context": {
+        "ex": "http://example.com/vocab#",
+        "name": "ex:name",
+        "knows": {"@id": "ex:knows", "@type": "@id"}
+    }})");
+    // the two values of name are different in JSON-LD, but give the same RDF literal
+    (*loader.documents)[DOCUMENT] = json::parse(R"({
+        "@context": "http://example.com/context.jsonld",
+        "@id": "http://example.com/alice",
+        "name": ["Alice", {"@value": "Alice", "@type": "http://www.w3.org/2001/XMLSchema#string"}],
+        "knows": {"@id": "http://example.com/bob", "name": "Bob"}
+    })");
+
+    auto stats = std::make_shared<ProcessingStats>();
+    JsonLdOptions options = makeOptions(loader, stats);
+    RDF::RDFDataset dataset = JsonLdProcessor::toRDF(DOCUMENT, options);
+
+    EXPECT_EQ(dataset.numTriples(), 3u);
+    EXPECT_EQ(stats->getCount(ProcessingStats::Counter::RemoteContextLoads), 1u);
+    EXPECT_EQ(stats->getCount(ProcessingStats::Counter::TermsDefined), 3u);
+    EXPECT_EQ(stats->getCount(ProcessingStats::Counter::NodesExpanded), 2u);
+    EXPECT_EQ(stats->getCount(ProcessingStats::Counter::TriplesEmitted), 4u);
+    EXPECT_EQ(stats->getCount(ProcessingStats::Counter::DuplicateTriplesDropped), 1u);
+    EXPECT_EQ(stats->getCount(ProcessingStats::Counter::CacheHits), 0u);
+    EXPECT_GT(stats->getTotalTime().count(), 0);
+}
+
+TEST(ProcessingStatsTest, toRDF_countsTheSameWorkWithWorkerThreads) {
+    MemoryLoader loader;
+    json graph = json::array();
+    for (int i = 0; i < 100; i++)
+        graph.push_back({{"@id", "http://example.com/n" + std::to_string(i)},
+                         {"http://example.com/vocab#value", json::array({i, {{"@list", json::array({"a", "b"})}}})}});
+    // a copy of the first node is put in a named graph, and the first node gets another
+    // value that is different in JSON-LD, but gives the same RDF literal as its number
+    graph.push_back({{"@id", "http://example.com/g"}, {"@graph", json::array({graph.at(0)})}});
+    graph.push_back({{"@id", "http://example.com/n0"}, {"http://example.com/vocab#value",
+                     {{"@value", "0"}, {"@type", "http://www.w3.org/2001/XMLSchema#integer"}}}});
+    (*loader.documents)[DOCUMENT] = {{"@graph", graph}};
+
+    std::size_t triples[2];
+    for (std::size_t threads : {1, 4}) {
+        auto stats = std::make_shared<ProcessingStats>();
+        JsonLdOptions options = makeOptions(loader, stats);
+        options.setRdfThreads(threads);
+        triples[threads == 1 ? 0 : 1] = JsonLdProcessor::toRDF(DOCUMENT, options).numTriples();
+
+        // each node gives six triples: its number, the link to its list, and the first and
+        // rest of two list nodes
+        EXPECT_EQ(stats->getCount(ProcessingStats::Counter::TriplesEmitted), 100u * 6 + 6 + 1);
+        EXPECT_EQ(stats->getCount(ProcessingStats::Counter::DuplicateTriplesDropped), 1u);
+        EXPECT_GT(stats->getTime(ProcessingStats::Phase::TripleGeneration).count(), 0);
+    }
+    EXPECT_EQ(triples[0], triples[1]);
+}
+
+TEST(ProcessingStatsTest, toRDF_withoutStatsGivesTheSameDataset) {
+    MemoryLoader loader;
+    // the two values of name give the same RDF literal, so one of them is dropped
+    (*loader.documents)[DOCUMENT] = json::parse(R"({"@graph": [
+        {"@id": "http://example.com/alice", "http://example.com/name": ["Alice",
+            {"@value": "Alice", "@type": "http://www.w3.org/2001/XMLSchema#string"}],
+         "http://example.com/tags": {"@list": ["a", "b"]}},
+        {"@id": "http://example.com/g", "@graph": {"@id": "http://example.com/bob", "http://example.com/name": "Bob"}}
+    ]})");
+
+    for (std::size_t threads : {1, 4}) {
+        auto stats = std::make_shared<ProcessingStats>();
+        JsonLdOptions statsOptions = makeOptions(loader, stats);
+        statsOptions.setRdfThreads(threads);
+        RDF::RDFDataset withStats = JsonLdProcessor::toRDF(DOCUMENT, statsOptions);
+
+        JsonLdOptions options = makeOptions(loader, nullptr);
+        options.setRdfThreads(threads);
+        RDF::RDFDataset withoutStats = JsonLdProcessor::toRDF(DOCUMENT, options);
+
+        // the same triples, in the same order, in the same graphs
+        EXPECT_EQ(withoutStats.numTriples(), 7u);
+        ASSERT_EQ(withoutStats.numGraphs(), withStats.numGraphs());
+        for (const auto & graph : withStats)
+            EXPECT_EQ(withoutStats.getGraph(graph.first).toString(), graph.second.toString());
+        EXPECT_EQ(stats->getCount(ProcessingStats::Counter::DuplicateTriplesDropped), 1u);
+    }
+}
+
+TEST(ProcessingStatsTest, expand_countsResultCacheHits) {
+    MemoryLoader loader;
+    (*loader.documents)[DOCUMENT] = json::parse(R"({"@context": {"name": "http://schema.org/name"}, "name": "Alice"})");
+
+    auto stats = std::make_shared<ProcessingStats>();
+    JsonLdOptions options = makeOptions(loader, stats);
+    options.setResultCache(std::make_shared<ResultCache>());
+
+    for (int i = 0; i < 3; i++) {
+        JsonLdOptions callOptions = options;
+        JsonLdProcessor::expand(DOCUMENT, callOptions);
+    }
+
+    // the document is expanded, and its terms defined, once
+    EXPECT_EQ(stats->getCount(ProcessingStats::Counter::CacheHits), 2u);
+    EXPECT_EQ(stats->getCount(ProcessingStats::Counter::TermsDefined), 1u);
+    EXPECT_EQ(stats->getCount(ProcessingStats::Counter::NodesExpanded), 1u);
+}
+
+TEST(ProcessingStatsTest, compact_loadsRemoteContextEachTime) {
+    MemoryLoader loader;
+    (*loader.documents)[DOCUMENT] = json::parse(R"({"http://schema.org/name": "Alice"})");
+    (*loader.documents)[CONTEXT] = json::parse(R"({"@context": {"name": "http://schema.org/name"}})");
+
+    auto stats = std::make_shared<ProcessingStats>();
+    JsonLdOptions options = makeOptions(loader, stats);
+    json context = CONTEXT;
+    json result = JsonLdProcessor::compact(DOCUMENT, context, options);
+    EXPECT_EQ(result.at("name"), "Alice");
+
+    // a context that loads a remote context is not cached, so the change is seen
+    (*loader.documents)[CONTEXT] = json::parse(R"({"@context": {"fullName": "http://schema.org/name"}})");
+    result = JsonLdProcessor::compact(DOCUMENT, context, options);
+    EXPECT_EQ(result.at("fullName"), "Alice");
+    EXPECT_FALSE(result.contains("name"));
+    EXPECT_EQ(stats->getCount(ProcessingStats::Counter::RemoteContextLoads), 2u);
+    EXPECT_EQ(stats->getCount(ProcessingStats::Counter::CacheHits), 0u);
+}
@@ -0,0 +1,104 @@
+#pragma ide diagnostic ignored "cert-err58-cpp"
+#include <jsonld-cpp/RDFBinarySerialization.h>
+
+#include <algorithm>
+
+#include <jsonld-cpp/JsonLdError.h>
+#include <jsonld-cpp/NQuadsSerialization.h>
+#include <jsonld-cpp/RDFDataset.h>
+
+#include <gtest/gtest.h>
+#pragma clang diagnostic push
+#pragma GCC diagnostic push
+#pragma clang diagnostic ignored "-Weverything"
+#pragma GCC diagnostic ignored "-Wall"
+#pragma GCC diagnostic ignored "-Wextra"
+#include <rapidcheck/gtest.h>
+#pragma clang diagnostic pop
+#pragma GCC diagnostic pop
+
+using namespace RDF;
+
+namespace {
+
+    const char NQUADS[] =
+            "<http://example.com/alice> <http://example.com/knows> <http://example.com/bob> .\n"
+            "<http://example.com/alice> <http://example.com/knows> _:b0 .\n"
+            "<http://example.com/alice> <http://example.com/name> \"Alice\" .\n"
+            "<http://example.com/bob> <http://example.com/name> \"Bob\"@en .\n"
+            "<http://example.com/bob> <http://example.com/age> \"42\"^^<http://www.w3.org/2001/XMLSchema#integer> .\n"
+            "_:b0 <http://example.com/knows> <http://example.com/alice> <http://example.com/g1> .\n"
+            "<http://example.com/carol> <http://example.com/name> \"Carol\" _:g2 .\n";
+
+}
+
+TEST(RDFBinarySerializationTest, roundTrip) {
+    RDFDataset dataset = NQuadsSerialization::parse(NQUADS);
+    std::string expected = NQuadsSerialization::toNQuads(dataset);
+
+    for (bool compress : {false, true}) {
+        std::string data = RDFBinarySerialization::write(dataset, compress);
+        RDFDataset result = RDFBinarySerialization::read(data);
+        EXPECT_EQ(result.numGraphs(), 3u);
+        EXPECT_EQ(result.numTriples(), 7u);
+        EXPECT_EQ(NQuadsSerialization::toNQuads(result), expected);
+    }
+
+    // an empty dataset
+    RDFDataset empty = RDFBinarySerialization::read(RDFBinarySerialization::write(RDFDataset(JsonLdOptions())));
+    EXPECT_TRUE(empty.empty());
+}
+
+TEST(RDFBinarySerializationTest, datasetView_readsInPlace) {
+    RDFDataset dataset = NQuadsSerialization::parse(NQUADS);
+    std::string data = RDFBinarySerialization::write(dataset, true);
+    RDFBinarySerialization::DatasetView view(data.data(), data.size());
+
+    // each distinct term, including the graph names, is stored once
+    EXPECT_EQ(view.numTerms(), 13u);
+    ASSERT_EQ(view.numGraphs(), 3u);
+
+    // graphs are stored in order of graph name
+    EXPECT_EQ(view.getGraphName(0), RDFBinarySerialization::DatasetView::DEFAULT_GRAPH);
+    EXPECT_EQ(view.getTerm(view.getGraphName(1)).kind, QuadTerm::Kind::BLANK_NODE);
+    EXPECT_EQ(view.getTerm(view.getGraphName(1)).value.str(), "_:g2");
+    EXPECT_EQ(view.getTerm(view.getGraphName(2)).kind, QuadTerm::Kind::IRI);
+    EXPECT_EQ(view.getTerm(view.getGraphName(2)).value.str(), "http://example.com/g1");
+    EXPECT_EQ(view.numTriples(0), 5u);
+
+    std::vector<std::string> literals;
+    view.forEachTriple(0, [&](RDFBinarySerialization::DatasetView::TermId,
+                              RDFBinarySerialization::DatasetView::TermId,
+                              RDFBinarySerialization::DatasetView::TermId o) {
+        RDFBinarySerialization::DatasetView::Term term = view.getTerm(o);
+        if (term.kind == QuadTerm::Kind::LITERAL)
+            literals.push_back(term.value.str() + "|" + term.datatype.str() + "|" + term.language.str());
+    });
+    std::sort(literals.begin(), literals.end());
+    EXPECT_EQ(literals, std::vector<std::string>({
+        "42|http://www.w3.org/2001/XMLSchema#integer|",
+        "Alice|http://www.w3.org/2001/XMLSchema#string|",
+        "Bob|http://www.w3.org/1999/02/22-rdf-syntax-ns#langString|en"}));
+
+    EXPECT_THROW(view.getTerm(static_cast<RDFBinarySerialization::DatasetView::TermId>(view.numTerms())), JsonLdError);
+}
+
+TEST(RDFBinarySerializationTest, read_invalidData) {
+    RDFDataset dataset = NQuadsSerialization::parse(NQUADS);
+
+    EXPECT_THROW(RDFBinarySerialization::read("<http://example.com/a> <http://example.com/b> <http://example.com/c> .\n"),
+                 JsonLdError);
+
+    for (bool compress : {false, true}) {
+        std::string data = RDFBinarySerialization::write(dataset, compress);
+        for (std::size_t size : {std::size_t(4), std::size_t(30), data.size() / 2, data.size() - 1}) {
+            try {
+                RDFBinarySerialization::read(data.substr(0, size));
+                FAIL() << "expected a JsonLdError for " << size << " bytes";
+            }
+            catch (JsonLdError &e) {
+                EXPECT_EQ(std::string(e.what()).find(JsonLdError::SyntaxError), 0);
+            }
+        }
+    }
+}
@@ -0,0 +1,165 @@
+#pragma ide diagnostic ignored "cert-err58-cpp"
+#include <jsonld-cpp/RDFCanonicalization.h>
+
+#include <jsonld-cpp/JsonLdError.h>
+#include <jsonld-cpp/JsonLdOptions.h>
+#include <jsonld-cpp/NQuadsSerialization.h>
+#include <jsonld-cpp/RDFDataset.h>
+#include <jsonld-cpp/RDFDatasetComparison.h>
+
+#include <gtest/gtest.h>
+#pragma clang diagnostic push
+#pragma GCC diagnostic push
+#pragma clang diagnostic ignored "-Weverything"
+#pragma GCC diagnostic ignored "-Wall"
+#pragma GCC diagnostic ignored "-Wextra"
+#include <rapidcheck/gtest.h>
+#pragma clang diagnostic pop
+#pragma GCC diagnostic pop
+
+using namespace RDF;
+
+namespace {
+
+    // a cycle of blank nodes that all have the same first degree hash
+    std::string cycle(const std::string & prefix, int length) {
+        std::string nquads;
+        for (int i = 0; i < length; i++)
+            nquads += "_:" + prefix + std::to_string(i) + " <http://example.com/#p> _:" +
+                    prefix + std::to_string((i + 1) % length) + " .\n";
+        return nquads;
+    }
+
+}
+
+TEST(RDFCanonicalizationTest, unique_first_degree_hashes) {
+    // Example from https://www.w3.org/TR/rdf-canon/#example-unique-hashes
+    std::string input =
+            "<http://example.com/#p> <http://example.com/#q> _:e0 .\n"
+            "<http://example.com/#p> <http://example.com/#r> _:e1 .\n"
+            "_:e0 <http://example.com/#s> <http://example.com/#u> .\n"
+            "_:e1 <http://example.com/#t> <http://example.com/#u> .\n";
+    std::string expected =
+            "<http://example.com/#p> <http://example.com/#q> _:c14n0 .\n"
+            "<http://example.com/#p> <http://example.com/#r> _:c14n1 .\n"
+            "_:c14n0 <http://example.com/#s> <http://example.com/#u> .\n"
+            "_:c14n1 <http://example.com/#t> <http://example.com/#u> .\n";
+
+    JsonLdOptions options;
+    RDFDataset dataset = NQuadsSerialization::parse(input);
+
+    EXPECT_EQ(RDFCanonicalization::toCanonicalNQuads(dataset, options), expected);
+
+    std::map<std::string, std::string> identifiers =
+            RDFCanonicalization::issueCanonicalIdentifiers(dataset, options);
+    EXPECT_EQ(identifiers.size(), 2u);
+    EXPECT_EQ(identifiers["_:e0"], "_:c14n0");
+    EXPECT_EQ(identifiers["_:e1"], "_:c14n1");
+}
+
+TEST(RDFCanonicalizationTest, hash) {
+    std::string input =
+            "<http://example.com/#p> <http://example.com/#r> _:x .\n"
+            "_:x <http://example.com/#t> <http://example.com/#u> .\n"
+            "<http://example.com/#p> <http://example.com/#q> _:y .\n"
+            "_:y <http://example.com/#s> <http://example.com/#u> .\n";
+
+    JsonLdOptions options;
+    RDFDataset dataset = NQuadsSerialization::parse(input);
+
+    EXPECT_EQ(RDFCanonicalization::hash(dataset, options),
+              "197dce9a2a3f3c4bb4591910b3762146423c1a4f6901e3789490d1f28fd5e796");
+
+    // with SHA-384 the first degree hashes sort the other way round, so _:x is _:c14n0
+    options.setHashAlgorithm("SHA384");
+    EXPECT_EQ(RDFCanonicalization::hash(dataset, options),
+              "57521b16f965b21861d02f3f03e1bd6a0b5c761185dc2edd26e0342594dd74e0db2379c72dfd7a91420eff4c59a183e2");
+}
+
+TEST(RDFCanonicalizationTest, shared_first_degree_hashes) {
+    // Example from https://www.w3.org/TR/rdf-canon/#example-shared-hashes
+    std::string input =
+            "<http://example.com/#p> <http://example.com/#q> _:e0 .\n"
+            "<http://example.com/#p> <http://example.com/#q> _:e1 .\n"
+            "_:e0 <http://example.com/#p> _:e2 .\n"
+            "_:e1 <http://example.com/#p> _:e3 .\n"
+            "_:e2 <http://example.com/#r> _:e3 .\n";
+    std::string expected =
+            "<http://example.com/#p> <http://example.com/#q> _:c14n2 .\n"
+            "<http://example.com/#p> <http://example.com/#q> _:c14n3 .\n"
+            "_:c14n0 <http://example.com/#r> _:c14n1 .\n"
+            "_:c14n2 <http://example.com/#p> _:c14n1 .\n"
+            "_:c14n3 <http://example.com/#p> _:c14n0 .\n";
+
+    JsonLdOptions options;
+    RDFDataset dataset = NQuadsSerialization::parse(input);
+
+    EXPECT_EQ(RDFCanonicalization::toCanonicalNQuads(dataset, options), expected);
+}
+
+TEST(RDFCanonicalizationTest, isomorphic_datasets_have_same_canonical_form) {
+    std::string input1 =
+            "_:a <http://example.com/#name> \"Alice\" _:g .\n"
+            "_:a <http://example.com/#knows> _:b _:g .\n"
+            "_:b <http://example.com/#name> \"Bob\"@en _:g .\n"
+            "_:b <http://example.com/#knows> _:a .\n"
+            + cycle("x", 3) + cycle("y", 4);
+    std::string input2 =
+            "_:n0 <http://example.com/#knows> _:n1 .\n"
+            "_:n0 <http://example.com/#name> \"Bob\"@en _:graph .\n"
+            "_:n1 <http://example.com/#name> \"Alice\" _:graph .\n"
+            "_:n1 <http://example.com/#knows> _:n0 _:graph .\n"
+            + cycle("q", 4) + cycle("r", 3);
+
+    JsonLdOptions options;
+    RDFDataset dataset1 = NQuadsSerialization::parse(input1);
+    RDFDataset dataset2 = NQuadsSerialization::parse(input2);
+
+    std::string canonical = RDFCanonicalization::toCanonicalNQuads(dataset1, options);
+    EXPECT_EQ(canonical, RDFCanonicalization::toCanonicalNQuads(dataset2, options));
+    EXPECT_EQ(canonical, NQuadsSerialization::toNQuads(RDFCanonicalization::canonicalize(dataset2, options)));
+    EXPECT_TRUE(areIsomorphic(dataset1, dataset2));
+    EXPECT_TRUE(areIsomorphic(dataset1, RDFCanonicalization::canonicalize(dataset1, options)));
+}
+
+TEST(RDFCanonicalizationTest, literals_are_escaped_canonically) {
+    std::string input =
+            "_:a <http://example.com/#p> \"a\\tb\\\"c\\\\d\\ne\" .\n"
+            "_:a <http://example.com/#q> \"1\"^^<http://www.w3.org/2001/XMLSchema#integer> .\n";
+    std::string expected =
+            "_:c14n0 <http://example.com/#p> \"a\tb\\\"c\\\\d\\ne\" .\n"
+            "_:c14n0 <http://example.com/#q> \"1\"^^<http://www.w3.org/2001/XMLSchema#integer> .\n";
+
+    JsonLdOptions options;
+    EXPECT_EQ(RDFCanonicalization::toCanonicalNQuads(NQuadsSerialization::parse(input), options), expected);
+}
+
+TEST(RDFCanonicalizationTest, sha384) {
+    JsonLdOptions options;
+    options.setHashAlgorithm("SHA384");
+    RDFDataset dataset = NQuadsSerialization::parse(cycle("x", 3) + cycle("y", 2));
+
+    std::string canonical = RDFCanonicalization::toCanonicalNQuads(dataset, options);
+    EXPECT_NE(canonical.find("_:c14n4"), std::string::npos);
+
+    options.setHashAlgorithm("MD5");
+    EXPECT_THROW(RDFCanonicalization::toCanonicalNQuads(dataset, options), JsonLdError);
+}
+
+TEST(RDFCanonicalizationTest, work_limit_exceeded) {
+    // many blank nodes with identical first degree hashes ("poison graph")
+    RDFDataset dataset = NQuadsSerialization::parse(cycle("x", 8) + cycle("y", 8));
+
+    JsonLdOptions options;
+    options.setCanonicalizationWorkLimit(100);
+    try {
+        RDFCanonicalization::toCanonicalNQuads(dataset, options);
+        FAIL() << "expected JsonLdError";
+    }
+    catch (JsonLdError &e) {
+        EXPECT_EQ(std::string(e.what()).find(JsonLdError::CanonicalizationWorkLimitExceeded), 0u);
+    }
+
+    options.setCanonicalizationWorkLimit(0);
+    EXPECT_NO_THROW(RDFCanonicalization::toCanonicalNQuads(dataset, options));
+}
@@ -0,0 +1,248 @@
+#pragma ide diagnostic ignored "cert-err58-cpp"
+#include <jsonld-cpp/RDFCanonicalization.h>
+
+#include <jsonld-cpp/JsonLdError.h>
+#include <jsonld-cpp/RemoteDocument.h>
+#include <jsonld-cpp/RDFDataset.h>
+#include <jsonld-cpp/detail/Sha2.h>
+
+#include "UrdnaManifestLoader.h"
+
+#include <fstream>
+#include <sstream>
+
+#include <gtest/gtest.h>
+#pragma clang diagnostic push
+#pragma GCC diagnostic push
+#pragma clang diagnostic ignored "-Weverything"
+#pragma GCC diagnostic ignored "-Wall"
+#pragma GCC diagnostic ignored "-Wextra"
+#include <rapidcheck/gtest.h>
+#pragma clang diagnostic pop
+#pragma GCC diagnostic pop
+
+
+// test suite fixture class
+class RDFCanonicalizationRdfc10Test : public ::testing::Test {
+public:
+    static void SetUpTestCase() {
+        std::string resource_dir = TEST_RESOURCE_DIR;
+        UrdnaManifestLoader manifestLoader(
+                resource_dir + "test_data/",
+                mainManifestName);
+        testCases = manifestLoader.load();
+    }
+
+    // resources shared by all tests.
+    static std::string mainManifestName;
+    static std::map<std::string, TestCase> testCases;
+
+    // the expected canonical N-Quads must be compared byte for byte, so they are read as
+    // text instead of being loaded as a dataset
+    static std::string readExpectedText(const TestCase &testCase) {
+        std::string path = testCase.testsBase + testCase.expect.substr(testCase.baseUri.size());
+        std::ifstream in(path);
+        std::stringstream ss;
+        ss << in.rdbuf();
+        return ss.str();
+    }
+
+    static void performCanonicalizationTest(TestCase &testCase) {
+        JsonLdOptions options = testCase.getOptions();
+
+        std::cout << "Id: " << testCase.id << std::endl;
+        std::cout << "Name: " << testCase.name << std::endl;
+
+        std::unique_ptr<RemoteDocument> inputDocument =
+                options.getDocumentLoader()->loadDocument(testCase.input);
+        RDF::RDFDataset input = inputDocument->getRDFContent();
+
+        try {
+            if (testCase.type.count("rdfc:RDFC10MapTest")) {
+                std::unique_ptr<RemoteDocument> expectedDocument =
+                        options.getDocumentLoader()->loadDocument(testCase.expect);
+                nlohmann::ordered_json expected = expectedDocument->getJSONContent();
+
+                // the map of the test suite has identifiers without their "_:" prefix
+                std::map<std::string, std::string> identifiers =
+                        RDFCanonicalization::issueCanonicalIdentifiers(input, options);
+                nlohmann::ordered_json actual = nlohmann::ordered_json::object();
+                for (const auto &entry : identifiers)
+                    actual[entry.first.substr(2)] = entry.second.substr(2);
+
+                EXPECT_EQ(actual, expected);
+                return;
+            }
+
+            std::string actual = RDFCanonicalization::toCanonicalNQuads(input, options);
+            if (testCase.type.count("rdfc:RDFC10NegativeEvalTest")) {
+                FAIL() << "We should have failed with the following error: "
+                       << JsonLdError::CanonicalizationWorkLimitExceeded;
+            }
+
+            std::string expected = readExpectedText(testCase);
+            EXPECT_EQ(actual, expected);
+
+            Sha2::Algorithm algorithm = Sha2::algorithmFromName(options.getHashAlgorithm());
+            EXPECT_EQ(RDFCanonicalization::hash(input, options), Sha2::hexDigest(algorithm, expected));
+        }
+        catch (JsonLdError &e) {
+            std::cout << "JsonLdError: " << e.what() << std::endl;
+            if (testCase.type.count("rdfc:RDFC10NegativeEvalTest")) {
+                std::string error = e.what();
+                if (error.find(JsonLdError::CanonicalizationWorkLimitExceeded) != std::string::npos) {
+                    SUCCEED();
+                    return;
+                }
+            }
+            FAIL() << e.what();
+        }
+    }
+
+    void performCanonicalizationTestFromManifest(const std::string& testName) {
+        auto testCase = testCases.at(testName);
+
+        performCanonicalizationTest(testCase);
+    }
+
+};
+
+std::string RDFCanonicalizationRdfc10Test::mainManifestName = "rdfc10-manifest.jsonld";
+std::map<std::string, TestCase> RDFCanonicalizationRdfc10Test::testCases;
+
+
+TEST_F(RDFCanonicalizationRdfc10Test, rdfc10_test001c) {
+    performCanonicalizationTestFromManifest("#test001c");
+}
+
+TEST_F(RDFCanonicalizationRdfc10Test, rdfc10_test002c) {
+    performCanonicalizationTestFromManifest("#test002c");
+}
+
+TEST_F(RDFCanonicalizationRdfc10Test, rdfc10_test003c) {
+    performCanonicalizationTestFromManifest("#test003c");
+}
+
+TEST_F(RDFCanonicalizationRdfc10Test, rdfc10_test004c) {
+    performCanonicalizationTestFromManifest("#test004c");
+}
+
+TEST_F(RDFCanonicalizationRdfc10Test, rdfc10_test005c) {
+    performCanonicalizationTestFromManifest("#test005c");
+}
+
+TEST_F(RDFCanonicalizationRdfc10Test, rdfc10_test006c) {
+    performCanonicalizationTestFromManifest("#test006c");
+}
+
+TEST_F(RDFCanonicalizationRdfc10Test, rdfc10_test007c) {
+    performCanonicalizationTestFromManifest("#test007c");
+}
+
+TEST_F(RDFCanonicalizationRdfc10Test, rdfc10_test008c) {
+    performCanonicalizationTestFromManifest("#test008c");
+}
+
+TEST_F(RDFCanonicalizationRdfc10Test, rdfc10_test009c) {
+    performCanonicalizationTestFromManifest("#test009c");
+}
+
+TEST_F(RDFCanonicalizationRdfc10Test, rdfc10_test010c) {
+    performCanonicalizationTestFromManifest("#test010c");
+}
+
+TEST_F(RDFCanonicalizationRdfc10Test, rdfc10_test011c) {
+    performCanonicalizationTestFromManifest("#test011c");
+}
+
+TEST_F(RDFCanonicalizationRdfc10Test, rdfc10_test012c) {
+    performCanonicalizationTestFromManifest("#test012c");
+}
+
+TEST_F(RDFCanonicalizationRdfc10Test, rdfc10_test013c) {
+    performCanonicalizationTestFromManifest("#test013c");
+}
+
+TEST_F(RDFCanonicalizationRdfc10Test, rdfc10_test014c) {
+    performCanonicalizationTestFromManifest("#test014c");
+}
+
+TEST_F(RDFCanonicalizationRdfc10Test, rdfc10_test015c) {
+    performCanonicalizationTestFromManifest("#test015c");
+}
+
+TEST_F(RDFCanonicalizationRdfc10Test, rdfc10_test016c) {
+    performCanonicalizationTestFromManifest("#test016c");
+}
+
+TEST_F(RDFCanonicalizationRdfc10Test, rdfc10_test017c) {
+    performCanonicalizationTestFromManifest("#test017c");
+}
+
+TEST_F(RDFCanonicalizationRdfc10Test, rdfc10_test018c) {
+    performCanonicalizationTestFromManifest("#test018c");
+}
+
+TEST_F(RDFCanonicalizationRdfc10Test, rdfc10_test019c) {
+    performCanonicalizationTestFromManifest("#test019c");
+}
+
+TEST_F(RDFCanonicalizationRdfc10Test, rdfc10_test020c) {
+    performCanonicalizationTestFromManifest("#test020c");
+}
+
+TEST_F(RDFCanonicalizationRdfc10Test, rdfc10_test021c) {
+    performCanonicalizationTestFromManifest("#test021c");
+}
+
+TEST_F(RDFCanonicalizationRdfc10Test, rdfc10_test022c) {
+    performCanonicalizationTestFromManifest("#test022c");
+}
+
+TEST_F(RDFCanonicalizationRdfc10Test, rdfc10_test023c) {
+    performCanonicalizationTestFromManifest("#test023c");
+}
+
+TEST_F(RDFCanonicalizationRdfc10Test, rdfc10_test024c) {
+    performCanonicalizationTestFromManifest("#test024c");
+}
+
+TEST_F(RDFCanonicalizationRdfc10Test, rdfc10_test025c) {
+    performCanonicalizationTestFromManifest("#test025c");
+}
+
+TEST_F(RDFCanonicalizationRdfc10Test, rdfc10_test026c) {
+    performCanonicalizationTestFromManifest("#test026c");
+}
+
+TEST_F(RDFCanonicalizationRdfc10Test, rdfc10_test027c) {
+    performCanonicalizationTestFromManifest("#test027c");
+}
+
+TEST_F(RDFCanonicalizationRdfc10Test, rdfc10_test028c) {
+    performCanonicalizationTestFromManifest("#test028c");
+}
+
+TEST_F(RDFCanonicalizationRdfc10Test, rdfc10_test029c) {
+    performCanonicalizationTestFromManifest("#test029c");
+}
+
+TEST_F(RDFCanonicalizationRdfc10Test, rdfc10_test030c) {
+    performCanonicalizationTestFromManifest("#test030c");
+}
+
+TEST_F(RDFCanonicalizationRdfc10Test, rdfc10_test031c) {
+    performCanonicalizationTestFromManifest("#test031c");
+}
+
+TEST_F(RDFCanonicalizationRdfc10Test, rdfc10_test032m) {
+    performCanonicalizationTestFromManifest("#test032m");
+}
+
+TEST_F(RDFCanonicalizationRdfc10Test, rdfc10_test033m) {
+    performCanonicalizationTestFromManifest("#test033m");
+}
+
+TEST_F(RDFCanonicalizationRdfc10Test, rdfc10_test034n) {
+    performCanonicalizationTestFromManifest("#test034n");
+}
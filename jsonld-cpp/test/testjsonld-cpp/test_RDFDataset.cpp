@@ -72,3 +72,57 @@ TEST(RDFDatasetTest, add_two_triples_to_two_graphs) {
     EXPECT_EQ(two, result2[0]);
 }
 
+
+TEST(RDFDatasetTest, findGraph_and_getOrCreateGraph_do_not_copy) {
+    JsonLdOptions options;
+    RDFDataset dataset(options);
+
+    std::string oneName = "one";
+    EXPECT_EQ(nullptr, dataset.findGraph(oneName));
+
+    RDFTriple one("http://example.com/subject1", "http://example.com/prop1", "1");
+    RDFGraph & graph = dataset.getOrCreateGraph(oneName);
+    graph.add(one);
+
+    const RDFGraph * found = dataset.findGraph(oneName);
+    ASSERT_NE(nullptr, found);
+    EXPECT_EQ(&graph, found);
+    EXPECT_EQ(1, found->size());
+
+    RDFGraph moved;
+    moved.add(RDFTriple("http://example.com/subject2", "http://example.com/prop2", "2"));
+    dataset.setGraph(std::move(moved), oneName);
+    EXPECT_EQ(1, dataset.findGraph(oneName)->size());
+    EXPECT_EQ("http://example.com/subject2", (*dataset.findGraph(oneName)->begin()).getSubject()->getValue());
+}
+
+TEST(RDFDatasetTest, quads_visits_all_graphs_in_order) {
+    JsonLdOptions options;
+    RDFDataset dataset(options);
+
+    RDFTriple one("http://example.com/subject1", "http://example.com/prop1", "1");
+    RDFTriple two("http://example.com/subject2", "http://example.com/prop2", "2");
+    RDFTriple three("http://example.com/subject3", "http://example.com/prop3", "3");
+    dataset.addTripleToGraph("b", two);
+    dataset.addTripleToGraph("b", three);
+    dataset.getOrCreateGraph("c");
+    dataset.addTripleToGraph("a", one);
+    dataset.getOrCreateGraph("0");
+
+    std::vector<std::string> graphNames;
+    std::vector<RDFTriple> triples;
+    for (const auto & quad : dataset.quads()) {
+        graphNames.push_back(quad.getGraphName());
+        triples.push_back(quad.getTriple());
+    }
+
+    // empty graphs are skipped
+    EXPECT_EQ((std::vector<std::string>{"a", "b", "b"}), graphNames);
+    ASSERT_EQ(3, triples.size());
+    EXPECT_EQ(one, triples[0]);
+    EXPECT_EQ(two, triples[1]);
+    EXPECT_EQ(three, triples[2]);
+
+    RDFDataset empty(options);
+    EXPECT_TRUE(empty.quads().begin() == empty.quads().end());
+}
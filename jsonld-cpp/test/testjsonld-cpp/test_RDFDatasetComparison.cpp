@@ -1,6 +1,6 @@
 #pragma ide diagnostic ignored "cert-err58-cpp"
 #include <jsonld-cpp/RDFDataset.h>
-#include "RDFDatasetComparison.h"
+#include <jsonld-cpp/RDFDatasetComparison.h>
 
 #include <gtest/gtest.h>
 #pragma clang diagnostic push
@@ -16,6 +16,28 @@
 
 using namespace RDF;
 
+namespace {
+
+    // adds a cycle of blank nodes _:<prefix>0 ... _:<prefix><length-1> to the default graph
+    void addCycle(RDFDataset & dataset, const std::string & prefix, int length) {
+        for (int i = 0; i < length; i++)
+            dataset.addTripleToGraph(JsonLdConsts::DEFAULT, RDFTriple(
+                    "_:" + prefix + std::to_string(i), "http://example.com/next",
+                    "_:" + prefix + std::to_string((i + 1) % length)));
+    }
+
+    // adds an RDF list of blank nodes with the given items to the default graph
+    void addList(RDFDataset & dataset, const std::string & prefix, const std::vector<std::string> & items) {
+        for (std::size_t i = 0; i < items.size(); i++) {
+            std::string node = "_:" + prefix + std::to_string(i);
+            std::string rest = i + 1 < items.size() ? "_:" + prefix + std::to_string(i + 1) : JsonLdConsts::RDF_NIL;
+            dataset.addTripleToGraph(JsonLdConsts::DEFAULT, RDFTriple(node, JsonLdConsts::RDF_FIRST, items[i]));
+            dataset.addTripleToGraph(JsonLdConsts::DEFAULT, RDFTriple(node, JsonLdConsts::RDF_REST, rest));
+        }
+    }
+
+}
+
 TEST(RDFDatasetComparisonTest, areIsomorphic_withEmptyDatasets_isTrue) {
     JsonLdOptions options;
     RDFDataset dataset1(options);
@@ -125,3 +147,112 @@ TEST(RDFDatasetComparisonTest, areIsomorphic_withBlankObjects_isTrue) {
 
 }
 
+
+TEST(RDFDatasetComparisonTest, areIsomorphic_withCyclesOfDifferentLengths_isFalse) {
+    JsonLdOptions options;
+    RDFDataset dataset1(options);
+    RDFDataset dataset2(options);
+
+    // every blank node has the same neighbourhood, so only backtracking can tell these apart
+    addCycle(dataset1, "a", 6);
+    addCycle(dataset2, "b", 3);
+    addCycle(dataset2, "c", 3);
+
+    EXPECT_FALSE(areIsomorphic(dataset1, dataset2));
+    EXPECT_FALSE(areIsomorphic(dataset2, dataset1));
+}
+
+TEST(RDFDatasetComparisonTest, areIsomorphic_withRelabeledCycles_isTrue) {
+    JsonLdOptions options;
+    RDFDataset dataset1(options);
+    RDFDataset dataset2(options);
+
+    addCycle(dataset1, "a", 5);
+    addCycle(dataset1, "b", 7);
+    addCycle(dataset1, "c", 5);
+    addCycle(dataset2, "x", 5);
+    addCycle(dataset2, "y", 5);
+    addCycle(dataset2, "z", 7);
+
+    EXPECT_TRUE(areIsomorphic(dataset1, dataset2));
+}
+
+TEST(RDFDatasetComparisonTest, areIsomorphic_withLongLists) {
+    JsonLdOptions options;
+    RDFDataset dataset1(options);
+    RDFDataset dataset2(options);
+    RDFDataset dataset3(options);
+
+    // identical items, so list nodes only differ by their distance to the end of the list
+    std::vector<std::string> items(500, "http://example.com/item");
+    addList(dataset1, "a", items);
+    addList(dataset2, "b", items);
+    items[250] = "http://example.com/other";
+    addList(dataset3, "c", items);
+
+    EXPECT_TRUE(areIsomorphic(dataset1, dataset2));
+    EXPECT_FALSE(areIsomorphic(dataset1, dataset3));
+}
+
+TEST(RDFDatasetComparisonTest, areIsomorphic_withBlankNodeGraphName) {
+    JsonLdOptions options;
+    RDFDataset dataset1(options);
+    RDFDataset dataset2(options);
+    RDFDataset dataset3(options);
+
+    dataset1.addTripleToGraph("_:g1", RDFTriple("_:a", "http://example.com/prop1", "_:b"));
+    dataset1.addTripleToGraph("_:g2", RDFTriple("_:b", "http://example.com/prop1", "_:a"));
+    dataset2.addTripleToGraph("_:h1", RDFTriple("_:c", "http://example.com/prop1", "_:d"));
+    dataset2.addTripleToGraph("_:h2", RDFTriple("_:d", "http://example.com/prop1", "_:c"));
+    dataset3.addTripleToGraph("_:h1", RDFTriple("_:c", "http://example.com/prop1", "_:d"));
+    dataset3.addTripleToGraph("_:h1", RDFTriple("_:d", "http://example.com/prop1", "_:c"));
+
+    EXPECT_TRUE(areIsomorphic(dataset1, dataset2));
+    EXPECT_FALSE(areIsomorphic(dataset1, dataset3));
+}
+
+TEST(RDFDatasetComparisonTest, areIsomorphic_withManySymmetricBlankNodes) {
+    JsonLdOptions options;
+    RDFDataset dataset1(options);
+    RDFDataset dataset2(options);
+    RDFDataset dataset3(options);
+    RDFGraph & graph1 = dataset1.getOrCreateGraph(JsonLdConsts::DEFAULT);
+    RDFGraph & graph2 = dataset2.getOrCreateGraph(JsonLdConsts::DEFAULT);
+    RDFGraph & graph3 = dataset3.getOrCreateGraph(JsonLdConsts::DEFAULT);
+
+    // refinement can not tell these blank nodes apart, so every one is a candidate for every other
+    const int count = 100000;
+    for (int i = 0; i < count; i++) {
+        graph1.append(RDFTriple("_:a" + std::to_string(i), "http://example.com/p", "http://example.com/o"));
+        graph2.append(RDFTriple("_:b" + std::to_string(count - 1 - i), "http://example.com/p", "http://example.com/o"));
+        graph3.append(RDFTriple("_:c" + std::to_string(i), "http://example.com/p",
+                                i == count / 2 ? "http://example.com/other" : "http://example.com/o"));
+    }
+
+    EXPECT_TRUE(areIsomorphic(dataset1, dataset2));
+    EXPECT_FALSE(areIsomorphic(dataset1, dataset3));
+}
+
+TEST(RDFDatasetComparisonTest, areIsomorphic_withManySymmetricCycles) {
+    JsonLdOptions options;
+    RDFDataset dataset1(options);
+    RDFDataset dataset2(options);
+    RDFDataset dataset3(options);
+    RDFGraph & graph1 = dataset1.getOrCreateGraph(JsonLdConsts::DEFAULT);
+    RDFGraph & graph2 = dataset2.getOrCreateGraph(JsonLdConsts::DEFAULT);
+    RDFGraph & graph3 = dataset3.getOrCreateGraph(JsonLdConsts::DEFAULT);
+
+    // 100000 blank nodes in cycles of two, or of four for dataset3
+    const int count = 100000;
+    for (int i = 0; i < count; i++) {
+        int next2 = i % 2 == 0 ? i + 1 : i - 1;
+        int next4 = i % 4 == 3 ? i - 3 : i + 1;
+        graph1.append(RDFTriple("_:a" + std::to_string(i), "http://example.com/next", "_:a" + std::to_string(next2)));
+        graph2.append(RDFTriple("_:b" + std::to_string(count - 1 - i), "http://example.com/next",
+                                "_:b" + std::to_string(count - 1 - next2)));
+        graph3.append(RDFTriple("_:c" + std::to_string(i), "http://example.com/next", "_:c" + std::to_string(next4)));
+    }
+
+    EXPECT_TRUE(areIsomorphic(dataset1, dataset2));
+    EXPECT_FALSE(areIsomorphic(dataset1, dataset3));
+}
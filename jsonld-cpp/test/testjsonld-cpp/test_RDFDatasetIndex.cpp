@@ -0,0 +1,98 @@
+#pragma ide diagnostic ignored "cert-err58-cpp"
+#include <jsonld-cpp/RDFDatasetIndex.h>
+
+#include <jsonld-cpp/NQuadsSerialization.h>
+#include <jsonld-cpp/RDFDataset.h>
+
+#include <gtest/gtest.h>
+#pragma clang diagnostic push
+#pragma GCC diagnostic push
+#pragma clang diagnostic ignored "-Weverything"
+#pragma GCC diagnostic ignored "-Wall"
+#pragma GCC diagnostic ignored "-Wextra"
+#include <rapidcheck/gtest.h>
+#pragma clang diagnostic pop
+#pragma GCC diagnostic pop
+
+using namespace RDF;
+
+namespace {
+
+    const char NQUADS[] =
+            "<http://example.com/alice> <http://example.com/knows> <http://example.com/bob> .\n"
+            "<http://example.com/alice> <http://example.com/knows> <http://example.com/carol> .\n"
+            "<http://example.com/alice> <http://example.com/name> \"Alice\" .\n"
+            "<http://example.com/bob> <http://example.com/knows> <http://example.com/carol> .\n"
+            "<http://example.com/bob> <http://example.com/name> \"Bob\"@en .\n"
+            "_:c <http://example.com/knows> <http://example.com/alice> <http://example.com/g1> .\n"
+            "<http://example.com/carol> <http://example.com/name> \"Bob\" <http://example.com/g1> .\n";
+
+    std::string toNQuads(const std::vector<RDFQuad> & quads) {
+        std::string result;
+        for (const auto & quad : quads)
+            result += NQuadsSerialization::toNQuad(quad);
+        return result;
+    }
+
+}
+
+TEST(RDFDatasetIndexTest, match_usesAllPermutations) {
+    RDFDatasetIndex index(NQuadsSerialization::parse(NQUADS));
+    EXPECT_EQ(index.numTriples(), 7u);
+
+    IRI alice("http://example.com/alice");
+    IRI bob("http://example.com/bob");
+    IRI carol("http://example.com/carol");
+    IRI knows("http://example.com/knows");
+    IRI name("http://example.com/name");
+
+    // all quads
+    EXPECT_EQ(index.count(nullptr, nullptr, nullptr), 7u);
+
+    // S, SP and SPO
+    EXPECT_EQ(index.count(&alice, nullptr, nullptr), 3u);
+    EXPECT_EQ(toNQuads(index.match(&alice, &knows, nullptr)),
+              "<http://example.com/alice> <http://example.com/knows> <http://example.com/bob> .\n"
+              "<http://example.com/alice> <http://example.com/knows> <http://example.com/carol> .\n");
+    EXPECT_EQ(index.count(&alice, &knows, &carol), 1u);
+    EXPECT_EQ(index.count(&alice, &knows, &alice), 0u);
+
+    // P and PO
+    EXPECT_EQ(index.count(nullptr, &knows, nullptr), 4u);
+    EXPECT_EQ(toNQuads(index.match(nullptr, &knows, &carol)),
+              "<http://example.com/alice> <http://example.com/knows> <http://example.com/carol> .\n"
+              "<http://example.com/bob> <http://example.com/knows> <http://example.com/carol> .\n");
+
+    // O and SO
+    EXPECT_EQ(toNQuads(index.match(nullptr, nullptr, &alice)),
+              "_:c <http://example.com/knows> <http://example.com/alice> <http://example.com/g1> .\n");
+    EXPECT_EQ(index.count(&bob, nullptr, &carol), 1u);
+}
+
+TEST(RDFDatasetIndexTest, match_literalsAndGraphs) {
+    RDFDatasetIndex index(NQuadsSerialization::parse(NQUADS));
+
+    // literals only match with the same datatype and language
+    std::string en = "en";
+    std::string langString = "http://www.w3.org/1999/02/22-rdf-syntax-ns#langString";
+    Literal bob("Bob");
+    Literal bobEn("Bob", &langString, &en);
+    EXPECT_EQ(toNQuads(index.match(nullptr, nullptr, &bob)),
+              "<http://example.com/carol> <http://example.com/name> \"Bob\" <http://example.com/g1> .\n");
+    EXPECT_EQ(index.count(nullptr, nullptr, &bobEn), 1u);
+
+    std::string defaultGraph = "@default";
+    std::string g1 = "http://example.com/g1";
+    std::string g2 = "http://example.com/g2";
+    EXPECT_EQ(index.count(nullptr, nullptr, nullptr, &defaultGraph), 5u);
+    EXPECT_EQ(index.count(nullptr, nullptr, nullptr, &g1), 2u);
+    EXPECT_EQ(index.count(nullptr, nullptr, nullptr, &g2), 0u);
+
+    BlankNode c("_:c");
+    EXPECT_EQ(index.count(&c, nullptr, nullptr, &g1), 1u);
+    EXPECT_EQ(index.count(&c, nullptr, nullptr, &defaultGraph), 0u);
+
+    // terms not in the dataset match nothing
+    IRI dave("http://example.com/dave");
+    EXPECT_TRUE(index.match(&dave, nullptr, nullptr).empty());
+}
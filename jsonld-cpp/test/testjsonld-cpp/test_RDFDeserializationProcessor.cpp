@@ -0,0 +1,157 @@
+#pragma ide diagnostic ignored "cert-err58-cpp"
+#include <jsonld-cpp/detail/RDFDeserializationProcessor.h>
+
+#include <jsonld-cpp/FileLoader.h>
+#include <jsonld-cpp/JsonLdError.h>
+#include <jsonld-cpp/JsonLdOptions.h>
+#include <jsonld-cpp/JsonLdProcessor.h>
+#include <jsonld-cpp/NQuadsSerialization.h>
+#include <jsonld-cpp/RDFDataset.h>
+#include <jsonld-cpp/RDFDatasetComparison.h>
+#include <jsonld-cpp/detail/RDFSerializationProcessor.h>
+
+#include <gtest/gtest.h>
+#pragma clang diagnostic push
+#pragma GCC diagnostic push
+#pragma clang diagnostic ignored "-Weverything"
+#pragma GCC diagnostic ignored "-Wall"
+#pragma GCC diagnostic ignored "-Wextra"
+#include <rapidcheck/gtest.h>
+#pragma clang diagnostic pop
+#pragma GCC diagnostic pop
+
+using json = nlohmann::ordered_json;
+
+namespace {
+
+    std::string resourceLocation(const std::string & name) {
+        return "file://" + std::string(TEST_RESOURCE_DIR) + "test_data/" + name;
+    }
+
+    json fromNQuads(const std::string & nquads, JsonLdOptions & options) {
+        RDF::RDFDataset dataset = NQuadsSerialization::parse(nquads);
+        return JsonLdProcessor::fromRDF(dataset, options);
+    }
+
+}
+
+TEST(RDFDeserializationProcessorTest, fromRDF_convertsListsAndNamedGraphs) {
+    JsonLdOptions options(std::unique_ptr<DocumentLoader>(new FileLoader()));
+    options.setOrdered(true);
+    json result = JsonLdProcessor::fromRDF(resourceLocation("fromrdf-list.nq"), options);
+
+    json expected = json::parse(R"([
+      {
+        "@id": "http://example.com/graphs/g1",
+        "@graph": [
+          {
+            "@id": "http://example.com/people/dave",
+            "http://example.com/vocab#age": [{"@value": "42", "@type": "http://www.w3.org/2001/XMLSchema#integer"}]
+          }
+        ]
+      },
+      {
+        "@id": "http://example.com/people/dave",
+        "http://example.com/vocab#name": [{"@value": "Dave"}],
+        "http://example.com/vocab#tags": [{"@list": [{"@value": "a"}, {"@value": "b"}]}]
+      }
+    ])");
+    EXPECT_EQ(result, expected);
+}
+
+TEST(RDFDeserializationProcessorTest, fromRDF_keepsListNodesReferencedTwice) {
+    JsonLdOptions options;
+    options.setOrdered(true);
+    json result = fromNQuads(
+            "<http://example.com/s> <http://example.com/p> _:l1 .\n"
+            "<http://example.com/s> <http://example.com/q> _:l1 .\n"
+            "_:l1 <http://www.w3.org/1999/02/22-rdf-syntax-ns#first> \"a\" .\n"
+            "_:l1 <http://www.w3.org/1999/02/22-rdf-syntax-ns#rest> <http://www.w3.org/1999/02/22-rdf-syntax-ns#nil> .\n",
+            options);
+
+    // _:l1 is referenced twice, so it is kept as a node and only the empty tail
+    // becomes a list object
+    ASSERT_EQ(result.size(), 2u);
+    EXPECT_EQ(result.at(1).at("http://example.com/p"), json::parse(R"([{"@id": "_:l1"}])"));
+    EXPECT_EQ(result.at(0).at("http://www.w3.org/1999/02/22-rdf-syntax-ns#rest"),
+              json::parse(R"([{"@list": []}])"));
+}
+
+TEST(RDFDeserializationProcessorTest, fromRDF_convertsNestedLists) {
+    JsonLdOptions options;
+    json result = fromNQuads(
+            "<http://example.com/s> <http://example.com/p> _:outer .\n"
+            "_:outer <http://www.w3.org/1999/02/22-rdf-syntax-ns#first> _:inner .\n"
+            "_:outer <http://www.w3.org/1999/02/22-rdf-syntax-ns#rest> <http://www.w3.org/1999/02/22-rdf-syntax-ns#nil> .\n"
+            "_:inner <http://www.w3.org/1999/02/22-rdf-syntax-ns#first> \"a\" .\n"
+            "_:inner <http://www.w3.org/1999/02/22-rdf-syntax-ns#rest> <http://www.w3.org/1999/02/22-rdf-syntax-ns#nil> .\n",
+            options);
+
+    json expected = json::parse(R"([
+      {"@id": "http://example.com/s", "http://example.com/p": [{"@list": [{"@list": [{"@value": "a"}]}]}]}
+    ])");
+    EXPECT_EQ(result, expected);
+}
+
+TEST(RDFDeserializationProcessorTest, fromRDF_rdfTypeAndNativeTypes) {
+    std::string nquads =
+            "<http://example.com/s> <http://www.w3.org/1999/02/22-rdf-syntax-ns#type> <http://example.com/T> .\n"
+            "<http://example.com/s> <http://example.com/n> \"12\"^^<http://www.w3.org/2001/XMLSchema#integer> .\n"
+            "<http://example.com/s> <http://example.com/d> \"1.5E0\"^^<http://www.w3.org/2001/XMLSchema#double> .\n"
+            "<http://example.com/s> <http://example.com/b> \"maybe\"^^<http://www.w3.org/2001/XMLSchema#boolean> .\n"
+            "<http://example.com/s> <http://example.com/l> \"chat\"@fr .\n";
+
+    JsonLdOptions options;
+    options.setUseNativeTypes(true);
+    json result = fromNQuads(nquads, options);
+    ASSERT_EQ(result.size(), 1u);
+    const json & node = result.at(0);
+    EXPECT_EQ(node.at("@type"), json::parse(R"(["http://example.com/T"])"));
+    EXPECT_EQ(node.at("http://example.com/n"), json::parse(R"([{"@value": 12}])"));
+    EXPECT_EQ(node.at("http://example.com/d"), json::parse(R"([{"@value": 1.5}])"));
+    EXPECT_EQ(node.at("http://example.com/b"), json::parse(
+            R"([{"@value": "maybe", "@type": "http://www.w3.org/2001/XMLSchema#boolean"}])"));
+    EXPECT_EQ(node.at("http://example.com/l"), json::parse(R"([{"@value": "chat", "@language": "fr"}])"));
+
+    JsonLdOptions rdfTypeOptions;
+    rdfTypeOptions.setUseRdfType(true);
+    result = fromNQuads(nquads, rdfTypeOptions);
+    EXPECT_FALSE(result.at(0).contains("@type"));
+    EXPECT_EQ(result.at(0).at("http://www.w3.org/1999/02/22-rdf-syntax-ns#type"),
+              json::parse(R"([{"@id": "http://example.com/T"}])"));
+}
+
+TEST(RDFDeserializationProcessorTest, fromRDF_jsonLiteralsAndDirection) {
+    JsonLdOptions options;
+    options.setRdfDirection("i18n-datatype");
+    json result = fromNQuads(
+            "<http://example.com/s> <http://example.com/j> \"{\\\"a\\\":[1,2]}\"^^<http://www.w3.org/1999/02/22-rdf-syntax-ns#JSON> .\n"
+            "<http://example.com/s> <http://example.com/t> \"hello\"^^<https://www.w3.org/ns/i18n#en_rtl> .\n",
+            options);
+
+    const json & node = result.at(0);
+    EXPECT_EQ(node.at("http://example.com/j"), json::parse(R"([{"@value": {"a": [1, 2]}, "@type": "@json"}])"));
+    EXPECT_EQ(node.at("http://example.com/t"),
+              json::parse(R"([{"@value": "hello", "@language": "en", "@direction": "rtl"}])"));
+
+    try {
+        fromNQuads("<http://example.com/s> <http://example.com/j> \"{\"^^<http://www.w3.org/1999/02/22-rdf-syntax-ns#JSON> .\n",
+                   options);
+        FAIL() << "expected an invalid JSON literal error";
+    }
+    catch (const JsonLdError & e) {
+        EXPECT_EQ(std::string(e.what()).find(JsonLdError::InvalidJsonLiteral), 0u);
+    }
+}
+
+TEST(RDFDeserializationProcessorTest, fromRDF_roundTripsToRDF) {
+    JsonLdOptions options(std::unique_ptr<DocumentLoader>(new FileLoader()));
+    RDF::RDFDataset dataset = JsonLdProcessor::toRDF(resourceLocation("chunked-graph.jsonld"), options);
+
+    JsonLdOptions fromRDFOptions;
+    json result = RDFDeserializationProcessor::fromRDF(dataset, fromRDFOptions);
+    RDF::RDFDataset roundTripped = RDFSerializationProcessor::toRDF(result, fromRDFOptions);
+
+    EXPECT_EQ(roundTripped.numTriples(), dataset.numTriples());
+    EXPECT_TRUE(RDF::areIsomorphic(dataset, roundTripped));
+}
@@ -0,0 +1,155 @@
+#pragma ide diagnostic ignored "cert-err58-cpp"
+#include <jsonld-cpp/ResultCache.h>
+
+#include <map>
+#include <sstream>
+
+#include <jsonld-cpp/DocumentLoader.h>
+#include <jsonld-cpp/JSONDocument.h>
+#include <jsonld-cpp/JsonLdOptions.h>
+#include <jsonld-cpp/JsonLdProcessor.h>
+#include <jsonld-cpp/MediaType.h>
+#include <jsonld-cpp/NQuadsSerialization.h>
+#include <jsonld-cpp/RDFDataset.h>
+
+#include <gtest/gtest.h>
+#pragma clang diagnostic push
+#pragma GCC diagnostic push
+#pragma clang diagnostic ignored "-Weverything"
+#pragma GCC diagnostic ignored "-Wall"
+#pragma GCC diagnostic ignored "-Wextra"
+#include <rapidcheck/gtest.h>
+#pragma clang diagnostic pop
+#pragma GCC diagnostic pop
+
+using json = nlohmann::ordered_json;
+
+namespace {
+
+    // Loads documents from a map shared by its copies, and counts the loads
+    class MemoryLoader : public DocumentLoader {
+    public:
+        std::shared_ptr<std::map<std::string, json>> documents;
+        std::shared_ptr<std::size_t> loads;
+
+        MemoryLoader()
+                : documents(std::make_shared<std::map<std::string, json>>()),
+                  loads(std::make_shared<std::size_t>(0)) {
+        }
+
+        MemoryLoader * clone() const override {
+            return new MemoryLoader(*this);
+        }
+
+        std::unique_ptr<RemoteDocument> loadDocument(const std::string &url) override {
+            (*loads)++;
+            std::stringstream in(documents->at(url).dump());
+            return std::unique_ptr<RemoteDocument>(
+                    new JSONDocument(JSONDocument::of(MediaType::json_ld(), in, url)));
+        }
+    };
+
+    const char DOCUMENT[] = "http://example.com/doc.jsonld";
+    const char CONTEXT[] = "http://example.com/context.jsonld";
+
+    JsonLdOptions makeOptions(const MemoryLoader & loader, const std::shared_ptr<ResultCache> & cache) {
+        JsonLdOptions options(std::unique_ptr<DocumentLoader>(loader.clone()));
+        options.setResultCache(cache);
+        return options;
+    }
+
+}
+
+TEST(ResultCacheTest, expand_returnsCachedResultForSameDocument) {
+    MemoryLoader loader;
+    (*loader.documents)[DOCUMENT] = json::parse(R"({"@context": {"name": "http://schema.org/name"}, "name": "Alice"})");
+    auto cache = std::make_shared<ResultCache>();
+
+    JsonLdOptions options = makeOptions(loader, cache);
+    json expected = JsonLdProcessor::expand(DOCUMENT, options);
+    EXPECT_EQ(cache->getMisses(), 1u);
+    EXPECT_EQ(cache->size(), 1u);
+
+    JsonLdOptions options2 = makeOptions(loader, cache);
+    EXPECT_EQ(JsonLdProcessor::expand(DOCUMENT, options2), expected);
+    EXPECT_EQ(cache->getHits(), 1u);
+
+    // a changed document, or different options, is expanded again
+    (*loader.documents)[DOCUMENT]["name"] = "Bob";
+    JsonLdOptions options3 = makeOptions(loader, cache);
+    EXPECT_EQ(JsonLdProcessor::expand(DOCUMENT, options3)[0]["http://schema.org/name"][0]["@value"], "Bob");
+
+    JsonLdOptions options4 = makeOptions(loader, cache);
+    options4.setBase("http://example.org/");
+    JsonLdProcessor::expand(DOCUMENT, options4);
+    EXPECT_EQ(cache->getHits(), 1u);
+    EXPECT_EQ(cache->size(), 3u);
+}
+
+TEST(ResultCacheTest, toRDF_cachesDatasetAndInvalidatesByContext) {
+    MemoryLoader loader;
+    (*loader.documents)[CONTEXT] = json::parse(R"({"@context": {"knows": {"@id": "http://schema.org/knows", "@type": "@id"}}})");
+    (*loader.documents)[DOCUMENT] = json::parse(
+            R"({"@context": "http://example.com/context.jsonld", "@id": "http://example.com/alice", "knows": {"knows": "http://example.com/bob"}})");
+    auto cache = std::make_shared<ResultCache>();
+
+    JsonLdOptions options = makeOptions(loader, cache);
+    std::string expected = NQuadsSerialization::toNQuads(JsonLdProcessor::toRDF(DOCUMENT, options));
+    EXPECT_EQ(*loader.loads, 2u);
+
+    // only the document is loaded again, to find its hash
+    JsonLdOptions options2 = makeOptions(loader, cache);
+    EXPECT_EQ(NQuadsSerialization::toNQuads(JsonLdProcessor::toRDF(DOCUMENT, options2)), expected);
+    EXPECT_EQ(*loader.loads, 3u);
+
+    // the expanded document was cached along with the dataset
+    JsonLdOptions options3 = makeOptions(loader, cache);
+    options3.setOrdered(false);
+    JsonLdProcessor::expand(DOCUMENT, options3);
+    EXPECT_EQ(*loader.loads, 4u);
+    EXPECT_EQ(cache->getHits(), 2u);
+
+    // changing the context requires invalidating the results that used it
+    (*loader.documents)[CONTEXT] = json::parse(R"({"@context": {"knows": "http://xmlns.com/foaf/0.1/knows"}})");
+    cache->invalidate(CONTEXT);
+    EXPECT_EQ(cache->size(), 0u);
+    JsonLdOptions options4 = makeOptions(loader, cache);
+    std::string changed = NQuadsSerialization::toNQuads(JsonLdProcessor::toRDF(DOCUMENT, options4));
+    EXPECT_NE(changed, expected);
+    EXPECT_NE(changed.find("http://xmlns.com/foaf/0.1/knows"), std::string::npos);
+}
+
+TEST(ResultCacheTest, evictsLeastRecentlyUsedWithinBudget) {
+    json expanded = json::array({{{"@id", "http://example.com/a"}, {"http://example.com/p", json::array({{{"@value", std::string(200, 'x')}}})}}});
+    ResultCache probe;
+    probe.addExpanded("a", expanded, {});
+    std::size_t entryBytes = probe.getBytes();
+    ASSERT_GT(entryBytes, 200u);
+
+    // room for three results
+    ResultCache cache(3 * entryBytes);
+    cache.addExpanded("a", expanded, {});
+    cache.addExpanded("b", expanded, {});
+    cache.addExpanded("c", expanded, {});
+    EXPECT_EQ(cache.size(), 3u);
+    EXPECT_NE(cache.findExpanded("a"), nullptr);
+
+    // "b" is now the least recently used
+    cache.addExpanded("d", expanded, {});
+    EXPECT_EQ(cache.size(), 3u);
+    EXPECT_EQ(cache.getBytes(), 3 * entryBytes);
+    EXPECT_EQ(cache.findExpanded("b"), nullptr);
+    EXPECT_NE(cache.findExpanded("a"), nullptr);
+    EXPECT_NE(cache.findExpanded("c"), nullptr);
+    EXPECT_NE(cache.findExpanded("d"), nullptr);
+
+    // results larger than the budget are not cached
+    cache.addExpanded("e", json::array({std::string(3 * entryBytes, 'x')}), {});
+    EXPECT_EQ(cache.findExpanded("e"), nullptr);
+    EXPECT_EQ(cache.size(), 3u);
+
+    cache.clear();
+    EXPECT_EQ(cache.size(), 0u);
+    EXPECT_EQ(cache.getBytes(), 0u);
+    EXPECT_EQ(cache.getHits(), 0u);
+}
@@ -0,0 +1,123 @@
+#pragma ide diagnostic ignored "cert-err58-cpp"
+#include <jsonld-cpp/detail/Sha2.h>
+#include <jsonld-cpp/JsonLdError.h>
+
+#include <vector>
+
+#include <gtest/gtest.h>
+#pragma clang diagnostic push
+#pragma GCC diagnostic push
+#pragma clang diagnostic ignored "-Weverything"
+#pragma GCC diagnostic ignored "-Wall"
+#pragma GCC diagnostic ignored "-Wextra"
+#include <rapidcheck/gtest.h>
+#pragma clang diagnostic pop
+#pragma GCC diagnostic pop
+
+namespace {
+
+    // the implementations that can run on this processor, so each test vector is checked
+    // with the SHA-NI code as well as the portable code when possible
+    std::vector<Sha2::Implementation> implementations(Sha2::Algorithm algorithm) {
+        std::vector<Sha2::Implementation> result;
+        for (auto implementation : {Sha2::Implementation::Portable, Sha2::Implementation::ShaExtensions}) {
+            if (Sha2::isSupported(algorithm, implementation))
+                result.push_back(implementation);
+        }
+        return result;
+    }
+
+    std::string hexDigest(Sha2::Algorithm algorithm, Sha2::Implementation implementation, const std::string & data) {
+        Sha2 sha(algorithm, implementation);
+        sha.update(data);
+        return sha.hexDigest();
+    }
+
+    void expectDigest(Sha2::Algorithm algorithm, const std::string & data, const std::string & expected) {
+        for (auto implementation : implementations(algorithm))
+            EXPECT_EQ(hexDigest(algorithm, implementation, data), expected)
+                    << "implementation " << static_cast<int>(implementation);
+    }
+
+}
+
+TEST(Sha2Test, sha256_empty) {
+    expectDigest(Sha2::Algorithm::SHA256, "",
+                 "e3b0c44298fc1c149afbf4c8996fb92427ae41e4649b934ca495991b7852b855");
+}
+
+TEST(Sha2Test, sha256_abc) {
+    expectDigest(Sha2::Algorithm::SHA256, "abc",
+                 "ba7816bf8f01cfea414140de5dae2223b00361a396177a9cb410ff61f20015ad");
+}
+
+TEST(Sha2Test, sha256_two_blocks) {
+    expectDigest(Sha2::Algorithm::SHA256, "abcdbcdecdefdefgefghfghighijhijkijkljklmklmnlmnomnopnopq",
+                 "248d6a61d20638b8e5c026930c3e6039a33ce45964ff2167f6ecedd419db06c1");
+}
+
+TEST(Sha2Test, sha256_million_a) {
+    expectDigest(Sha2::Algorithm::SHA256, std::string(1000000, 'a'),
+                 "cdc76e5c9914fb9281a1c7e284d73e67f1809a48a497200e046d39ccc7112cd0");
+}
+
+TEST(Sha2Test, sha384_abc) {
+    expectDigest(Sha2::Algorithm::SHA384, "abc",
+                 "cb00753f45a35e8bb5a03d699ac65007272c32ab0eded1631a8b605a43ff5bed8086072ba1e7cc2358baeca134c825a7");
+}
+
+TEST(Sha2Test, sha384_empty) {
+    expectDigest(Sha2::Algorithm::SHA384, "",
+                 "38b060a751ac96384cd9327eb1b1e36a21fdb71114be07434c0cc7bf63f6e1da274edebfe76f65fbd51ad2f14898b95b");
+}
+
+TEST(Sha2Test, implementations_agree_on_every_length) {
+    // covers every position of the padding and length in the last one or two blocks
+    std::string message;
+    for (std::size_t length = 0; length < 300; length++) {
+        std::string portable = hexDigest(Sha2::Algorithm::SHA256, Sha2::Implementation::Portable, message);
+        for (auto implementation : implementations(Sha2::Algorithm::SHA256))
+            EXPECT_EQ(hexDigest(Sha2::Algorithm::SHA256, implementation, message), portable) << "length " << length;
+        message.push_back(static_cast<char>('a' + length % 26));
+    }
+}
+
+TEST(Sha2Test, automatic_implementation) {
+    Sha2 sha256(Sha2::Algorithm::SHA256);
+    EXPECT_EQ(sha256.getImplementation(),
+              Sha2::isSupported(Sha2::Algorithm::SHA256, Sha2::Implementation::ShaExtensions) ?
+              Sha2::Implementation::ShaExtensions : Sha2::Implementation::Portable);
+
+    Sha2 sha384(Sha2::Algorithm::SHA384);
+    EXPECT_EQ(sha384.getImplementation(), Sha2::Implementation::Portable);
+
+    EXPECT_FALSE(Sha2::isSupported(Sha2::Algorithm::SHA384, Sha2::Implementation::ShaExtensions));
+    EXPECT_THROW(Sha2(Sha2::Algorithm::SHA384, Sha2::Implementation::ShaExtensions), JsonLdError);
+}
+
+TEST(Sha2Test, incremental_update_matches_single_update) {
+    std::string message(1000, 'a');
+    for (auto algorithm : {Sha2::Algorithm::SHA256, Sha2::Algorithm::SHA384}) {
+        for (auto implementation : implementations(algorithm)) {
+            Sha2 sha(algorithm, implementation);
+            for (std::size_t i = 0; i < message.size(); i += 7)
+                sha.update(message.data() + i, std::min<std::size_t>(7, message.size() - i));
+            EXPECT_EQ(sha.hexDigest(), Sha2::hexDigest(algorithm, message));
+        }
+    }
+}
+
+TEST(Sha2Test, hexDigest_resets) {
+    Sha2 sha;
+    sha.update("abc");
+    sha.hexDigest();
+    sha.update("abc");
+    EXPECT_EQ(sha.hexDigest(), "ba7816bf8f01cfea414140de5dae2223b00361a396177a9cb410ff61f20015ad");
+}
+
+TEST(Sha2Test, algorithmFromName) {
+    EXPECT_EQ(Sha2::algorithmFromName(""), Sha2::Algorithm::SHA256);
+    EXPECT_EQ(Sha2::algorithmFromName("SHA256"), Sha2::Algorithm::SHA256);
+    EXPECT_EQ(Sha2::algorithmFromName("SHA384"), Sha2::Algorithm::SHA384);
+    EXPECT_THROW(Sha2::algorithmFromName("MD5"), JsonLdError);
+}